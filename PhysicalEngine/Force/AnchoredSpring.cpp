@@ -1,6 +1,7 @@
 #include "AnchoredSpring.h"
 
 #include "../Scene/Components/PhysicalComponent/Particle/Particle.h"
+#include "../Utility/imGuiUtility.h"
 #include "imgui/imgui.h"
 #include "../Scene/Scene.h"
 
@@ -13,7 +14,7 @@ AnchoredSpring::AnchoredSpring() {
 AnchoredSpring::~AnchoredSpring() {
 }
 
-AnchoredSpring::AnchoredSpring(const Vector3d &anchor, float k, float restLength) {
+AnchoredSpring::AnchoredSpring(const Vector3d &anchor, real k, real restLength) {
     m_anchor = anchor;
     m_k = k;
     m_restLength = restLength;
@@ -27,7 +28,7 @@ AnchoredSpring::AnchoredSpring(const AnchoredSpring &aSpring) {
 
 void AnchoredSpring::addForce(PhysicalComponent *physicalComponent) {
     Vector3d pos = physicalComponent->getPosition();
-    float delta = pos.distance(m_anchor);
+    real delta = pos.distance(m_anchor);
     Vector3d F;
     if (delta > m_restLength) {
         F = (pos - m_anchor).normalize() * (-m_k) * (delta - m_restLength);
@@ -44,7 +45,7 @@ void AnchoredSpring::addForce(PhysicalComponent *physicalComponent) {
 
 Vector3d AnchoredSpring::getForceValue(PhysicalComponent* physicalComponent) {
     Vector3d pos = physicalComponent->getPosition();
-    float delta = pos.distance(m_anchor);
+    real delta = pos.distance(m_anchor);
     Vector3d F;
     if (delta > m_restLength) {
         F = (pos - m_anchor).normalize() * (-m_k) * (delta - m_restLength);
@@ -62,25 +63,39 @@ void AnchoredSpring::drawGui(Scene *scene) {
             ImGui::TableNextColumn();
             ImGui::Text("X:");
             ImGui::SameLine();
-            ImGui::InputFloat("##AnchorX", &m_anchor.x);
+            ImGuiUtility::InputReal("##AnchorX", &m_anchor.x);
             ImGui::TableNextColumn();
             ImGui::Text("Y:");
             ImGui::SameLine();
-            ImGui::InputFloat("##AnchorY", &m_anchor.y);
+            ImGuiUtility::InputReal("##AnchorY", &m_anchor.y);
             ImGui::TableNextColumn();
             ImGui::Text("Z:");
             ImGui::SameLine();
-            ImGui::InputFloat("##AnchorZ", &m_anchor.z);
+            ImGuiUtility::InputReal("##AnchorZ", &m_anchor.z);
             ImGui::EndTable();
         }
         ImGui::Text("K: ");
         ImGui::SameLine();
-        ImGui::InputFloat("##AnchorKCoeff", &m_k);
+        ImGuiUtility::InputReal("##AnchorKCoeff", &m_k);
         ImGui::Text("Rest Length: ");
         ImGui::SameLine();
-        ImGui::InputFloat("##AnchorRestLengtgh", &m_restLength);
+        ImGuiUtility::InputReal("##AnchorRestLengtgh", &m_restLength);
     }
 }
 void AnchoredSpring::translate(const Vector3d &translation) {
     m_anchor = m_anchor + translation;
 }
+
+void AnchoredSpring::getParameters(real parameters[PARAMETERS_COUNT]) const {
+    parameters[0] = m_k;
+    parameters[1] = m_restLength;
+    parameters[2] = m_anchor.x;
+    parameters[3] = m_anchor.y;
+    parameters[4] = m_anchor.z;
+}
+
+void AnchoredSpring::setParameters(const real parameters[PARAMETERS_COUNT]) {
+    m_k = parameters[0];
+    m_restLength = parameters[1];
+    m_anchor = Vector3d(parameters[2], parameters[3], parameters[4]);
+}
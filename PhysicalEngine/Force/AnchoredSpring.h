@@ -9,15 +9,15 @@ private:
     static constexpr const char *FORCE_TYPE = ANCHORED_SPRING_FORCE;
 
     Vector3d m_anchor;
-    float m_k;
-    float m_restLength;
+    real m_k;
+    real m_restLength;
 
 public:
     AnchoredSpring();
 
     ~AnchoredSpring();
 
-    AnchoredSpring(const Vector3d &anchor, float k, float restLength);
+    AnchoredSpring(const Vector3d &anchor, real k, real restLength);
 
     AnchoredSpring(const AnchoredSpring &aSpring);
 
@@ -30,6 +30,10 @@ public:
     void translate(const Vector3d &translation);
 
     std::string getName() const override;
+
+    void getParameters(real parameters[PARAMETERS_COUNT]) const override;
+
+    void setParameters(const real parameters[PARAMETERS_COUNT]) override;
 };
 
 #endif /* ANCHOREDSPRING_H */
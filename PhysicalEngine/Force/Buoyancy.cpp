@@ -1,6 +1,7 @@
 #include "Buoyancy.h"
 
 #include "../Scene/Components/PhysicalComponent/Particle/Particle.h"
+#include "../Utility/imGuiUtility.h"
 #include "imgui/imgui.h"
 #include "../Scene/Scene.h"
 
@@ -11,7 +12,7 @@ Buoyancy::Buoyancy() {
     m_liquidDensity = 0;
 }
 
-Buoyancy::Buoyancy(float maxDepth, float volume, float waterHeight, float liquidDensity) {
+Buoyancy::Buoyancy(real maxDepth, real volume, real waterHeight, real liquidDensity) {
     m_maxDepth = maxDepth;
     m_volume = volume;
     m_waterHeight = waterHeight;
@@ -26,7 +27,7 @@ Buoyancy::Buoyancy(const Buoyancy &buoyancy) {
 }
 
 void Buoyancy::addForce(PhysicalComponent *physicalComponent) {
-    float d = (physicalComponent->getPosition().gety() - m_waterHeight - m_maxDepth) / 2 * m_maxDepth;
+    real d = (physicalComponent->getPosition().gety() - m_waterHeight - m_maxDepth) / 2 * m_maxDepth;
     Vector3d F(0, 1, 0);
     if (d <= 0) {
         F * 0;
@@ -43,16 +44,16 @@ void Buoyancy::drawGui(Scene *scene) {
     if (ImGui::CollapsingHeader(BUOYANCY_FORCE)) {
         ImGui::Text("Max Depth: ");
         ImGui::SameLine();
-        ImGui::InputFloat("##BuyoncyMaxDepth", &m_maxDepth);
+        ImGuiUtility::InputReal("##BuyoncyMaxDepth", &m_maxDepth);
         ImGui::Text("Volume: ");
         ImGui::SameLine();
-        ImGui::InputFloat("##BuyoncyVolume", &m_volume);
+        ImGuiUtility::InputReal("##BuyoncyVolume", &m_volume);
         ImGui::Text("Water height: ");
         ImGui::SameLine();
-        ImGui::InputFloat("##BuyoncyWaterHeight", &m_waterHeight);
+        ImGuiUtility::InputReal("##BuyoncyWaterHeight", &m_waterHeight);
         ImGui::Text("Liquid Density: ");
         ImGui::SameLine();
-        ImGui::InputFloat("##BuyoncyLiquidDensity", &m_liquidDensity);
+        ImGuiUtility::InputReal("##BuyoncyLiquidDensity", &m_liquidDensity);
 
     }
 }
@@ -60,3 +61,17 @@ void Buoyancy::drawGui(Scene *scene) {
 std::string Buoyancy::getName() const {
     return FORCE_TYPE;
 }
+
+void Buoyancy::getParameters(real parameters[PARAMETERS_COUNT]) const {
+    parameters[0] = m_maxDepth;
+    parameters[1] = m_volume;
+    parameters[2] = m_waterHeight;
+    parameters[3] = m_liquidDensity;
+}
+
+void Buoyancy::setParameters(const real parameters[PARAMETERS_COUNT]) {
+    m_maxDepth = parameters[0];
+    m_volume = parameters[1];
+    m_waterHeight = parameters[2];
+    m_liquidDensity = parameters[3];
+}
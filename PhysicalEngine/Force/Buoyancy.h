@@ -8,15 +8,15 @@ public:
     static constexpr const char *FORCE_TYPE = BUOYANCY_FORCE;
 
 private:
-    float m_maxDepth;
-    float m_volume;
-    float m_waterHeight;
-    float m_liquidDensity;
+    real m_maxDepth;
+    real m_volume;
+    real m_waterHeight;
+    real m_liquidDensity;
 
 public:
     Buoyancy();
 
-    Buoyancy(float maxDepth, float volume, float waterHeight, float liquidDensity);
+    Buoyancy(real maxDepth, real volume, real waterHeight, real liquidDensity);
 
     Buoyancy(const Buoyancy &buoyancy);
 
@@ -26,6 +26,10 @@ public:
 
 public:
     std::string getName() const override;
+
+    void getParameters(real parameters[PARAMETERS_COUNT]) const override;
+
+    void setParameters(const real parameters[PARAMETERS_COUNT]) override;
 };
 
 #endif /* BUOYANCY_H */
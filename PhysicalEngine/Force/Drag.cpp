@@ -1,6 +1,7 @@
 #include "Drag.h"
 
 #include "../Scene/Components/PhysicalComponent/Particle/Particle.h"
+#include "../Utility/imGuiUtility.h"
 #include "imgui/imgui.h"
 #include "../Scene/Scene.h"
 
@@ -9,7 +10,7 @@ Drag::Drag() {
     m_k2 = 0;
 }
 
-Drag::Drag(float k1, float k2) {
+Drag::Drag(real k1, real k2) {
     m_k1 = k1;
     m_k2 = k2;
 }
@@ -30,13 +31,23 @@ void Drag::drawGui(Scene *scene) {
     if (ImGui::CollapsingHeader(DRAG_FORCE)) {
         ImGui::Text("K1: ");
         ImGui::SameLine();
-        ImGui::InputFloat("##DragK1", &m_k1);
+        ImGuiUtility::InputReal("##DragK1", &m_k1);
         ImGui::Text("K2: ");
         ImGui::SameLine();
-        ImGui::InputFloat("##DragK2", &m_k2);
+        ImGuiUtility::InputReal("##DragK2", &m_k2);
     }
 }
 
 std::string Drag::getName() const {
     return FORCE_TYPE;
 }
+
+void Drag::getParameters(real parameters[PARAMETERS_COUNT]) const {
+    parameters[0] = m_k1;
+    parameters[1] = m_k2;
+}
+
+void Drag::setParameters(const real parameters[PARAMETERS_COUNT]) {
+    m_k1 = parameters[0];
+    m_k2 = parameters[1];
+}
@@ -8,13 +8,13 @@ public:
     static constexpr const char *FORCE_TYPE = DRAG_FORCE;
 
 private:
-    float m_k1;
-    float m_k2;
+    real m_k1;
+    real m_k2;
 
 public:
     Drag();
 
-    Drag(float k1, float k2);
+    Drag(real k1, real k2);
 
     Drag(const Drag &drag);
 
@@ -24,6 +24,10 @@ public:
 
 public:
     std::string getName() const override;
+
+    void getParameters(real parameters[PARAMETERS_COUNT]) const override;
+
+    void setParameters(const real parameters[PARAMETERS_COUNT]) override;
 };
 
 #endif /* DRAG_H */
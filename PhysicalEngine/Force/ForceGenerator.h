@@ -24,6 +24,8 @@ class ForceGenerator {
 public:
     static const char *forcesNamesList[4];
 
+    static constexpr int PARAMETERS_COUNT = 6;
+
 private:
     static constexpr const char *FORCE_TYPE = "ForceGenerator";
 
@@ -48,6 +50,14 @@ public:
 
     virtual std::string getName() const = 0;
 
+    /// <summary>
+    /// Paramètres de la force (raideur, longueur au repos, ...) utilisés par les snapshots de scène,
+    /// les emplacements inutilisés sont laissés tels quels
+    /// </summary>
+    virtual void getParameters(real parameters[PARAMETERS_COUNT]) const = 0;
+
+    virtual void setParameters(const real parameters[PARAMETERS_COUNT]) = 0;
+
 public:
     static ForceGenerator *createForceGenerator(const std::string &name, GameObject *gameObject);
 
@@ -1,6 +1,7 @@
 #include "Gravity.h"
 
 #include "../Scene/Components/PhysicalComponent/Particle/Particle.h"
+#include "../Utility/imGuiUtility.h"
 #include "imgui/imgui.h"
 #include "../Scene/Scene.h"
 
@@ -24,18 +25,18 @@ void Gravity::drawGui(Scene *scene) {
         ImGui::TableNextColumn();
         ImGui::Text("X:");
         ImGui::SameLine();
-        ImGui::InputFloat("##GravityX", &m_gravity.x);
+        ImGuiUtility::InputReal("##GravityX", &m_gravity.x);
         ImGui::SameLine();
         ImGui::TableNextColumn();
         ImGui::Text("Y:");
         ImGui::SameLine();
-        ImGui::InputFloat("##GravityY", &m_gravity.y);
+        ImGuiUtility::InputReal("##GravityY", &m_gravity.y);
         ImGui::SameLine();
         ImGui::TableNextColumn();
         ImGui::SameLine();
         ImGui::Text("Z:");
         ImGui::SameLine();
-        ImGui::InputFloat("##GravityZ", &m_gravity.z);
+        ImGuiUtility::InputReal("##GravityZ", &m_gravity.z);
         ImGui::EndTable();
     }
 }
@@ -47,3 +48,13 @@ std::string Gravity::getName() const {
 Vector3d &Gravity::getGravityRef() {
     return m_gravity;
 }
+
+void Gravity::getParameters(real parameters[PARAMETERS_COUNT]) const {
+    parameters[0] = m_gravity.x;
+    parameters[1] = m_gravity.y;
+    parameters[2] = m_gravity.z;
+}
+
+void Gravity::setParameters(const real parameters[PARAMETERS_COUNT]) {
+    m_gravity = Vector3d(parameters[0], parameters[1], parameters[2]);
+}
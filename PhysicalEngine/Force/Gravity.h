@@ -23,6 +23,10 @@ public:
 public:
     std::string getName() const override;
 
+    void getParameters(real parameters[PARAMETERS_COUNT]) const override;
+
+    void setParameters(const real parameters[PARAMETERS_COUNT]) override;
+
     Vector3d &getGravityRef();
 };
 
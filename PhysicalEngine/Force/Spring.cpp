@@ -12,12 +12,12 @@ Spring::Spring(GameObject* gameObject) : ForceGenerator(gameObject) {
     m_restLength = 0;
 }
 
-Spring::Spring(GameObject* gameObject, float k, float restLength) : ForceGenerator(gameObject) {
+Spring::Spring(GameObject* gameObject, real k, real restLength) : ForceGenerator(gameObject) {
     m_k = k;
     m_restLength = restLength;
 }
 
-// Spring::Spring(Particle *otherParticle, float k, float restLength) {
+// Spring::Spring(Particle *otherParticle, real k, real restLength) {
 //     m_otherParticle = otherParticle;
 //     m_k = k;
 //     m_restLength = restLength;
@@ -48,7 +48,7 @@ void Spring::addForce(PhysicalComponent* physicalComponent) {
 
 
 void Spring::calculateForce(PhysicalComponent* physicalComponent, PhysicalComponent* otherPhysicalComponent) {
-    float delta = otherPhysicalComponent->distance(*physicalComponent);
+    real delta = otherPhysicalComponent->distance(*physicalComponent);
 
     Vector3d F;
     if (delta > m_restLength)
@@ -72,7 +72,7 @@ Vector3d Spring::getForceValue(PhysicalComponent* physicalComponent) {
         return Vector3d();
 
     // Calculate force from this particle to other particle
-    float delta = otherPhysicalComponent->distance(*physicalComponent);
+    real delta = otherPhysicalComponent->distance(*physicalComponent);
 
     Vector3d F;
     if (delta > m_restLength)
@@ -89,10 +89,10 @@ void Spring::drawGui(Scene* scene) {
     {
         ImGui::Text("K: ");
         ImGui::SameLine();
-        ImGui::InputFloat("##SpringK", &m_k);
+        ImGuiUtility::InputReal("##SpringK", &m_k);
         ImGui::Text("Rest Length: ");
         ImGui::SameLine();
-        ImGui::InputFloat("##SpringRestLength", &m_restLength);
+        ImGuiUtility::InputReal("##SpringRestLength", &m_restLength);
 
         ImGui::Text("Select Particle: ");
         if (ImGuiUtility::ButtonCenteredOnLine("Select other particle", 0.5f))
@@ -127,3 +127,17 @@ std::string Spring::getName() const {
 void Spring::setOtherGameObject(GameObject* otherGameObject) {
     m_otherGameObject = otherGameObject;
 }
+
+GameObject* Spring::getOtherGameObject() const {
+    return m_otherGameObject;
+}
+
+void Spring::getParameters(real parameters[PARAMETERS_COUNT]) const {
+    parameters[0] = m_k;
+    parameters[1] = m_restLength;
+}
+
+void Spring::setParameters(const real parameters[PARAMETERS_COUNT]) {
+    m_k = parameters[0];
+    m_restLength = parameters[1];
+}
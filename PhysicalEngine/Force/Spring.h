@@ -10,15 +10,15 @@ private:
     static constexpr const char* FORCE_TYPE = SPRING_FORCE;
 
 private:
-    float m_k;
-    float m_restLength;
+    real m_k;
+    real m_restLength;
     //    Particle *m_otherParticle = nullptr;
     GameObject* m_otherGameObject = nullptr;
 
 public:
     explicit Spring(GameObject* gameObject);
 
-    Spring(GameObject* gameObject, float k, float restLength);
+    Spring(GameObject* gameObject, real k, real restLength);
 
     //    Spring(const Spring &spring);
 
@@ -34,8 +34,14 @@ public:
 
     void setOtherGameObject(GameObject* otherGameObject);
 
+    GameObject* getOtherGameObject() const;
+
 public:
     std::string getName() const override;
+
+    void getParameters(real parameters[PARAMETERS_COUNT]) const override;
+
+    void setParameters(const real parameters[PARAMETERS_COUNT]) override;
 };
 
 #endif /* SPRING_H */
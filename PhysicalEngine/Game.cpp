@@ -25,7 +25,7 @@ void Game::start(Scene* s) {
     //    rigidbody->addForceToPointList(new AnchoredSpring(Vector3d(0, 12, 0), 3, 3), Vector3d(5, 0, 0));
     //
     //    auto* rigidbodyPrefab2 = new RigidbodyPrefab(scene, new Cylinder(8, 12, 10));
-    //    rigidbodyPrefab2->transform.positionX = -20;
+    //    rigidbodyPrefab2->transform.setPosition(-20, 0, 0);
     //    scene->addGameObject(rigidbodyPrefab2);
     //    Rigidbody* rigidbody2;
     //    rigidbodyPrefab2->getComponentByClass(rigidbody2);
@@ -60,9 +60,7 @@ void Game::start(Scene* s) {
     auto* rigidbodyPrefab = new RigidbodyPrefab(scene);
     rigidbodyPrefab->mesh->setColor({ 1.0f, 0.0f, 0, 1.0f });
     scene->addGameObject(rigidbodyPrefab);
-    rigidbodyPrefab->transform.positionX = -1.5;
-    rigidbodyPrefab->transform.positionY = 3;
-    rigidbodyPrefab->transform.positionZ = 0;
+    rigidbodyPrefab->transform.setPosition(-1.5, 3, 0);
     Rigidbody* rigidbody;
     rigidbodyPrefab->getComponentByClass(rigidbody);
     rigidbody->setAngularSpeed({ 0, 1, 0 });
@@ -71,9 +69,7 @@ void Game::start(Scene* s) {
 
     auto* rigidbodyPrefab2 = new RigidbodyPrefab(scene);
     rigidbodyPrefab2->mesh->setColor({ 0, 0.0f, 0.8f, 1.0f });
-    rigidbodyPrefab2->transform.positionX = 1.5;
-    rigidbodyPrefab2->transform.positionY = 3;
-    rigidbodyPrefab2->transform.positionZ = -3;
+    rigidbodyPrefab2->transform.setPosition(1.5, 3, -3);
     scene->addGameObject(rigidbodyPrefab2);
     Rigidbody* rigidbody2;
     rigidbodyPrefab2->getComponentByClass(rigidbody2);
@@ -83,9 +79,7 @@ void Game::start(Scene* s) {
 
     auto* rigidbodyPrefab3 = new RigidbodyPrefab(scene);
     rigidbodyPrefab3->mesh->setColor({ 0, 0.8f, 0, 1.0f });
-    rigidbodyPrefab3->transform.positionX = 3;
-    rigidbodyPrefab3->transform.positionY = 3;
-    rigidbodyPrefab3->transform.positionZ = 0;
+    rigidbodyPrefab3->transform.setPosition(3, 3, 0);
     scene->addGameObject(rigidbodyPrefab3);
     Rigidbody* rigidbody3;
     rigidbodyPrefab3->getComponentByClass(rigidbody3);
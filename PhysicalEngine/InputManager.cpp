@@ -5,6 +5,7 @@
 
 #include "PhysicalEngineLauncher.h"
 #include "Scene/Scene.h"
+#include "Utility/TraceRecorder.h"
 #include "Utility/Vector3d.h"
 
 bool InputManager::mouseRightButtonPressed = false;
@@ -44,6 +45,17 @@ void InputManager::keyPressed(GLFWwindow *window, int key, PhysicalEngineLaunche
         case GLFW_KEY_ESCAPE: {
             glfwSetWindowShouldClose(window, GLFW_TRUE);
             break;
+        }
+        case GLFW_KEY_F9: {
+            // Start a trace, or stop it and export it
+            if (TraceRecorder::isRecording()) {
+                TraceRecorder::stop();
+                if (TraceRecorder::flush(TRACE_FILE_NAME))
+                    std::cout << "Trace written to " << TRACE_FILE_NAME << std::endl;
+            } else {
+                TraceRecorder::start();
+            }
+            break;
         }
             //    case GLFW_KEY_UP: {
             //        camera->moveForward();
@@ -179,3 +191,18 @@ bool InputManager::isUpKeyPressed() {
 bool InputManager::isDownKeyPressed() {
     return glfwGetKey(m_window, GLFW_KEY_PAGE_DOWN) == GLFW_PRESS;
 }
+
+void InputManager::updateCamera(Camera *camera) {
+    if (isForwardKeyPressed())
+        camera->moveForward();
+    if (isBackwardKeyPressed())
+        camera->moveBackward();
+    if (isLeftKeyPressed())
+        camera->moveLeft();
+    if (isRightKeyPressed())
+        camera->moveRight();
+    if (isUpKeyPressed())
+        camera->moveUp();
+    if (isDownKeyPressed())
+        camera->moveDown();
+}
@@ -1,10 +1,14 @@
 #ifndef INPUT_MANAGER_H
 #define INPUT_MANAGER_H
 
+#define TRACE_FILE_NAME "physics_trace.json"
+
 struct GLFWwindow;
 
 class PhysicalEngineLauncher;
 
+class Camera;
+
 class InputManager {
 
 private:
@@ -39,6 +43,11 @@ public:
     static bool isRightKeyPressed();
     static bool isUpKeyPressed();
     static bool isDownKeyPressed();
+
+    /// <summary>
+    /// Transmet les touches de déplacement maintenues à la caméra, à appeler avant Scene::update
+    /// </summary>
+    static void updateCamera(Camera* camera);
 };
 
 #endif // INPUT_MANAGER_H
@@ -0,0 +1,40 @@
+#include "Integrator.h"
+
+#include "RungeKutta4.h"
+#include "SymplecticEuler.h"
+#include "VelocityVerlet.h"
+#include <iostream>
+
+const char *Integrator::integratorsNamesList[] = {SYMPLECTIC_EULER_INTEGRATOR, VELOCITY_VERLET_INTEGRATOR,
+                                                  RUNGE_KUTTA_4_INTEGRATOR};
+
+Integrator *Integrator::createIntegrator(const std::string &name) {
+    int index = 0;
+
+    for (auto &integratorName: Integrator::integratorsNamesList) {
+        if (integratorName == name) {
+            switch (index) {
+                case 0:
+                    return new SymplecticEuler();
+                case 1:
+                    return new VelocityVerlet();
+                case 2:
+                    return new RungeKutta4();
+                default:
+                    break;
+            }
+        }
+        index++;
+    }
+    std::cerr << "Integrator::createIntegrator: Unknown integrator name" << std::endl;
+    return nullptr;
+}
+
+PhysicalState Integrator::advance(const PhysicalState &state, const PhysicalDerivative &derivative, real deltaTime) {
+    PhysicalState res = state;
+    res.position += derivative.linearSpeed * deltaTime;
+    res.linearSpeed += derivative.linearAcceleration * deltaTime;
+    res.orientation.updateByAngularSpeed(derivative.angularSpeed, deltaTime);
+    res.angularSpeed += derivative.angularAcceleration * deltaTime;
+    return res;
+}
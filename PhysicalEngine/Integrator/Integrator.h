@@ -0,0 +1,41 @@
+#ifndef INTEGRATOR_H
+#define INTEGRATOR_H
+
+#define SYMPLECTIC_EULER_INTEGRATOR "Symplectic Euler"
+#define VELOCITY_VERLET_INTEGRATOR "Velocity Verlet"
+#define RUNGE_KUTTA_4_INTEGRATOR "Runge-Kutta 4"
+
+#include "../Scene/Components/PhysicalComponent/PhysicalState.h"
+#include <string>
+#include <vector>
+
+class PhysicalComponent;
+
+class Integrator {
+public:
+    static const char *integratorsNamesList[3];
+
+public:
+    virtual ~Integrator() = default;
+
+    /// <summary>
+    /// Avance l'état des composants de deltaTime. Chaque étape est évaluée pour tous les composants avant d'en
+    /// modifier un seul, les forces couplées (ressorts, ...) ne dépendent donc pas de l'ordre des composants
+    /// </summary>
+    /// <param name="physicalComponents"></param>
+    /// <param name="deltaTime"></param>
+    virtual void integrate(const std::vector<PhysicalComponent *> &physicalComponents, real deltaTime) = 0;
+
+    virtual std::string getName() const = 0;
+
+public:
+    static Integrator *createIntegrator(const std::string &name);
+
+protected:
+    /// <summary>
+    /// Etat obtenu en suivant la dérivée pendant deltaTime (pas d'Euler explicite)
+    /// </summary>
+    static PhysicalState advance(const PhysicalState &state, const PhysicalDerivative &derivative, real deltaTime);
+};
+
+#endif // INTEGRATOR_H
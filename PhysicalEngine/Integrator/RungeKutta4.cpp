@@ -0,0 +1,60 @@
+#include "RungeKutta4.h"
+
+#include "../Scene/Components/PhysicalComponent/PhysicalComponent.h"
+
+void RungeKutta4::integrate(const std::vector<PhysicalComponent *> &physicalComponents, real deltaTime) {
+    size_t count = physicalComponents.size();
+    real halfDeltaTime = deltaTime / 2;
+    states.resize(count);
+    k1.resize(count);
+    k2.resize(count);
+    k3.resize(count);
+    k4.resize(count);
+
+    // Every stage is evaluated for all the components before any of them moves to the next stage
+    for (size_t i = 0; i < count; i++) {
+        states[i] = physicalComponents[i]->getState();
+    }
+    for (size_t i = 0; i < count; i++) {
+        k1[i] = physicalComponents[i]->evaluate();
+    }
+    for (size_t i = 0; i < count; i++) {
+        physicalComponents[i]->setState(advance(states[i], k1[i], halfDeltaTime));
+    }
+    for (size_t i = 0; i < count; i++) {
+        k2[i] = physicalComponents[i]->evaluate();
+    }
+    for (size_t i = 0; i < count; i++) {
+        physicalComponents[i]->setState(advance(states[i], k2[i], halfDeltaTime));
+    }
+    for (size_t i = 0; i < count; i++) {
+        k3[i] = physicalComponents[i]->evaluate();
+    }
+    for (size_t i = 0; i < count; i++) {
+        physicalComponents[i]->setState(advance(states[i], k3[i], deltaTime));
+    }
+    for (size_t i = 0; i < count; i++) {
+        k4[i] = physicalComponents[i]->evaluate();
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        // (k1 + 2 * k2 + 2 * k3 + k4) / 6
+        PhysicalDerivative derivative;
+        derivative.linearSpeed =
+                (k1[i].linearSpeed + (k2[i].linearSpeed + k3[i].linearSpeed) * 2 + k4[i].linearSpeed) / 6;
+        derivative.linearAcceleration = (k1[i].linearAcceleration +
+                                         (k2[i].linearAcceleration + k3[i].linearAcceleration) * 2 +
+                                         k4[i].linearAcceleration) / 6;
+        derivative.angularSpeed =
+                (k1[i].angularSpeed + (k2[i].angularSpeed + k3[i].angularSpeed) * 2 + k4[i].angularSpeed) / 6;
+        derivative.angularAcceleration = (k1[i].angularAcceleration +
+                                          (k2[i].angularAcceleration + k3[i].angularAcceleration) * 2 +
+                                          k4[i].angularAcceleration) / 6;
+
+        physicalComponents[i]->setState(advance(states[i], derivative, deltaTime));
+    }
+}
+
+std::string RungeKutta4::getName() const {
+    return INTEGRATOR_TYPE;
+}
@@ -0,0 +1,26 @@
+#ifndef RUNGE_KUTTA_4_H
+#define RUNGE_KUTTA_4_H
+
+#include "Integrator.h"
+
+/// <summary>
+/// Runge-Kutta d'ordre 4 : moyenne pondérée de 4 évaluations de la dérivée, stable pour des pas plus grands
+/// </summary>
+class RungeKutta4 : public Integrator {
+private:
+    static constexpr const char *INTEGRATOR_TYPE = RUNGE_KUTTA_4_INTEGRATOR;
+
+    // Kept between steps so that integrating does not allocate
+    std::vector<PhysicalState> states;
+    std::vector<PhysicalDerivative> k1;
+    std::vector<PhysicalDerivative> k2;
+    std::vector<PhysicalDerivative> k3;
+    std::vector<PhysicalDerivative> k4;
+
+public:
+    void integrate(const std::vector<PhysicalComponent *> &physicalComponents, real deltaTime) override;
+
+    std::string getName() const override;
+};
+
+#endif // RUNGE_KUTTA_4_H
@@ -0,0 +1,29 @@
+#include "SymplecticEuler.h"
+
+#include "../Scene/Components/PhysicalComponent/PhysicalComponent.h"
+
+void SymplecticEuler::integrate(const std::vector<PhysicalComponent *> &physicalComponents, real deltaTime) {
+    size_t count = physicalComponents.size();
+    derivatives.resize(count);
+
+    // Evaluate all the forces before moving anything
+    for (size_t i = 0; i < count; i++) {
+        derivatives[i] = physicalComponents[i]->evaluate();
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        PhysicalState state = physicalComponents[i]->getState();
+
+        // Update the speeds first, then move with the new speeds
+        state.linearSpeed += derivatives[i].linearAcceleration * deltaTime;
+        state.angularSpeed += derivatives[i].angularAcceleration * deltaTime;
+        state.position += state.linearSpeed * deltaTime;
+        state.orientation.updateByAngularSpeed(state.angularSpeed, deltaTime);
+
+        physicalComponents[i]->setState(state);
+    }
+}
+
+std::string SymplecticEuler::getName() const {
+    return INTEGRATOR_TYPE;
+}
@@ -0,0 +1,22 @@
+#ifndef SYMPLECTIC_EULER_H
+#define SYMPLECTIC_EULER_H
+
+#include "Integrator.h"
+
+/// <summary>
+/// Euler semi-implicite : la vitesse est mise à jour avant la position (ordre 1, conserve l'énergie)
+/// </summary>
+class SymplecticEuler : public Integrator {
+private:
+    static constexpr const char *INTEGRATOR_TYPE = SYMPLECTIC_EULER_INTEGRATOR;
+
+    // Kept between steps so that integrating does not allocate
+    std::vector<PhysicalDerivative> derivatives;
+
+public:
+    void integrate(const std::vector<PhysicalComponent *> &physicalComponents, real deltaTime) override;
+
+    std::string getName() const override;
+};
+
+#endif // SYMPLECTIC_EULER_H
@@ -0,0 +1,51 @@
+#include "VelocityVerlet.h"
+
+#include "../Scene/Components/PhysicalComponent/PhysicalComponent.h"
+
+void VelocityVerlet::integrate(const std::vector<PhysicalComponent *> &physicalComponents, real deltaTime) {
+    size_t count = physicalComponents.size();
+    real halfDeltaTime = deltaTime / 2;
+    states.resize(count);
+    starts.resize(count);
+    ends.resize(count);
+
+    for (size_t i = 0; i < count; i++) {
+        states[i] = physicalComponents[i]->getState();
+    }
+    for (size_t i = 0; i < count; i++) {
+        starts[i] = physicalComponents[i]->evaluate();
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const PhysicalState &state = states[i];
+        const PhysicalDerivative &start = starts[i];
+
+        // Move with the speed at the middle of the step
+        PhysicalState next = state;
+        next.position += (state.linearSpeed + start.linearAcceleration * halfDeltaTime) * deltaTime;
+        next.orientation.updateByAngularSpeed(state.angularSpeed + start.angularAcceleration * halfDeltaTime,
+                                              deltaTime);
+
+        // Predict the speeds for the speed dependent forces (drag, ...)
+        next.linearSpeed += start.linearAcceleration * deltaTime;
+        next.angularSpeed += start.angularAcceleration * deltaTime;
+        physicalComponents[i]->setState(next);
+    }
+
+    // All the components are at the end of the step, average both accelerations
+    for (size_t i = 0; i < count; i++) {
+        ends[i] = physicalComponents[i]->evaluate();
+    }
+    for (size_t i = 0; i < count; i++) {
+        const PhysicalDerivative &end = ends[i];
+        PhysicalState next = physicalComponents[i]->getState();
+        next.linearSpeed = states[i].linearSpeed + (starts[i].linearAcceleration + end.linearAcceleration) * halfDeltaTime;
+        next.angularSpeed =
+                states[i].angularSpeed + (starts[i].angularAcceleration + end.angularAcceleration) * halfDeltaTime;
+        physicalComponents[i]->setState(next);
+    }
+}
+
+std::string VelocityVerlet::getName() const {
+    return INTEGRATOR_TYPE;
+}
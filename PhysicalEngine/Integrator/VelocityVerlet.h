@@ -0,0 +1,24 @@
+#ifndef VELOCITY_VERLET_H
+#define VELOCITY_VERLET_H
+
+#include "Integrator.h"
+
+/// <summary>
+/// Verlet vitesse : position au second ordre, vitesse avec la moyenne des accélérations de début et de fin de pas
+/// </summary>
+class VelocityVerlet : public Integrator {
+private:
+    static constexpr const char *INTEGRATOR_TYPE = VELOCITY_VERLET_INTEGRATOR;
+
+    // Kept between steps so that integrating does not allocate
+    std::vector<PhysicalState> states;
+    std::vector<PhysicalDerivative> starts;
+    std::vector<PhysicalDerivative> ends;
+
+public:
+    void integrate(const std::vector<PhysicalComponent *> &physicalComponents, real deltaTime) override;
+
+    std::string getName() const override;
+};
+
+#endif // VELOCITY_VERLET_H
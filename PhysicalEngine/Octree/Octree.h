@@ -3,11 +3,15 @@
 
 #include "../RigidbodyContact/RigidbodyContactGeneratorRegistry.h"
 #include "../Scene/Components/Collider/RigidbodyCollider/RigidbodyPrimitiveCollider.h"
+#include "../Scene/Frustum.h"
 #include "../Utility/Vector3d.h"
+#include <deque>
+#include <vector>
 
 struct Object {
     Vector3d center;     // Center point for object
-    float radius;        // Radius of object bounding sphere
+    real radius;         // Radius of object bounding sphere
+    real drawRadius;     // Radius around center holding the drawn mesh, at least radius
     Object* pNextObject; // Pointer to next object when linked into list
     RigidbodyPrimitiveCollider* Collider;
 };
@@ -15,7 +19,7 @@ struct Object {
 // Octree node data structure
 struct Node {
     Vector3d center;            // Center point of octree node
-    float halfWidth;            // Half the width of the node volume
+    real halfWidth;             // Half the width of the node volume
     Node* pChild[8];            // Pointers to the eight children nodes
     Object* pObjList = nullptr; // Linked list of objects contained at this node
 };
@@ -25,13 +29,17 @@ class Octree {
 private:
     RigidbodyContactGeneratorRegistry contactRegistry;
 
+    // Objects are recycled from one frame to the next, the deque keeps their addresses stable when it grows
+    std::deque<Object> objectPool;
+    size_t objectPoolUsed = 0;
+
 public:
     Octree(RigidbodyContactGeneratorRegistry ContactRegistry);
 
     Node* root;
 
     // Preallocates an octree down to a specific depth
-    Node* BuildOctree(Vector3d center, float halfWidth, int stopDepth) {
+    Node* BuildOctree(Vector3d center, real halfWidth, int stopDepth) {
         if (stopDepth < 0)
             return nullptr;
         else
@@ -43,7 +51,7 @@ public:
             pNode->pObjList = nullptr;
             // Recursively construct the eight children of the subtree
             Vector3d offset;
-            float step = halfWidth * 0.5f;
+            real step = halfWidth * 0.5f;
             for (int i = 0; i < 8; i++)
             {
                 offset.x = ((i & 1) ? step : -step);
@@ -83,13 +91,32 @@ public:
         }
     }
 
+    // Empties every node and gives all the pooled objects back
+    void Clear() {
+        CleanOctree(root);
+        objectPoolUsed = 0;
+    }
+
+    // Takes an object from the pool, the pool only allocates when more colliders are inserted than in any previous frame
+    Object* NewObject(const Vector3d& center, real radius, RigidbodyPrimitiveCollider* collider) {
+        if (objectPoolUsed == objectPool.size())
+            objectPool.emplace_back();
+        Object* pObject = &objectPool[objectPoolUsed++];
+        pObject->center = center;
+        pObject->radius = radius;
+        pObject->drawRadius = radius;
+        pObject->pNextObject = nullptr;
+        pObject->Collider = collider;
+        return pObject;
+    }
+
     void InsertObject(Node* pTree, Object* pObject) {
         int index = 0, straddle = 0;
         // Compute the octant number [0..7] the object sphere center is in
         // If straddling any of the dividing x, y, or z planes, exit directly
         for (int i = 0; i < 3; i++)
         {
-            float delta = 0;
+            real delta = 0;
             if (i == 0)
                 delta = pObject->center.getx() - pTree->center.getx();
             if (i == 1)
@@ -119,6 +146,27 @@ public:
         }
     }
 
+    // Appends the objects whose drawn sphere touches the frustum. The objects of a node (but the root) are inside its
+    // cube, which is grown by margin, the largest drawRadius - radius, to hold their drawn spheres: a node outside the
+    // frustum is skipped with its subtree, a node inside it is taken whole without testing its objects
+    void QueryFrustum(Node* pTree, const Frustum& frustum, real margin, std::vector<Object*>& visible,
+                      bool inside = false) {
+        if (!inside && pTree != root)
+        {
+            if (!frustum.intersectsCube(pTree->center, pTree->halfWidth + margin))
+                return;
+            inside = frustum.containsCube(pTree->center, pTree->halfWidth + margin);
+        }
+        for (Object* pObject = pTree->pObjList; pObject; pObject = pObject->pNextObject)
+        {
+            if (inside || frustum.intersectsSphere(pObject->center, pObject->drawRadius))
+                visible.push_back(pObject);
+        }
+        for (int i = 0; i < 8; i++)
+            if (pTree->pChild[i])
+                QueryFrustum(pTree->pChild[i], frustum, margin, visible, inside);
+    }
+
     // Tests all objects that could possibly overlap due to cell ancestry and coexistence
     // in the same cell. Assumes objects exist in a single cell only, and fully inside it
     void TestAllCollisions(Node* pTree) {
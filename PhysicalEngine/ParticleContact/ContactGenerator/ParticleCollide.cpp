@@ -2,7 +2,10 @@
 
 #include "../../Scene/GameObject.h"
 
-ParticleCollide::ParticleCollide(float elast) {
+#include <algorithm>
+#include <cmath>
+
+ParticleCollide::ParticleCollide(real elast) {
     elasticity = elast;
 }
 
@@ -11,49 +14,98 @@ void ParticleCollide::addCollider(ParticleCollider* particleCollider) {
 }
 
 int ParticleCollide::addContact(ParticleContact* particleContact, unsigned int limit, unsigned int current) {
-    for (int i = 0; i < m_colliders.size(); i++)
+    m_candidatePairCount = 0;
+
+    // Get the particle of each collider once, colliders without particle are skipped
+    m_particles.resize(m_colliders.size());
+    m_positions.resize(m_colliders.size());
+    real maxRadius = 0;
+    for (size_t i = 0; i < m_colliders.size(); i++)
+    {
+        m_particles[i] = nullptr;
+        if (m_colliders[i] == nullptr)
+            continue;
+        m_colliders[i]->getGameObject()->getComponentByClass(m_particles[i]);
+        if (m_particles[i] == nullptr)
+            continue;
+        m_positions[i] = m_particles[i]->getPosition();
+        maxRadius = std::max(maxRadius, m_colliders[i]->getRadius());
+    }
+    if (maxRadius <= 0)
+        return current;
+
+    // Sort the particles by cell, two colliding particles are at most one cell apart
+    real cellSize = 2 * maxRadius;
+    m_cells.clear();
+    for (size_t i = 0; i < m_colliders.size(); i++)
+    {
+        if (m_particles[i] == nullptr)
+            continue;
+        m_cells.push_back({ getCellKey(std::llround(std::floor(m_positions[i].x / cellSize)),
+                                       std::llround(std::floor(m_positions[i].y / cellSize)),
+                                       std::llround(std::floor(m_positions[i].z / cellSize))),
+                            static_cast<unsigned int>(i) });
+    }
+    std::sort(m_cells.begin(), m_cells.end(), [](const CellEntry& a, const CellEntry& b) {
+        return a.cell < b.cell || (a.cell == b.cell && a.index < b.index);
+    });
+
+    for (const CellEntry& entry : m_cells)
     {
-        for (int j = i + 1; j < m_colliders.size(); j++)
+        unsigned int i = entry.index;
+        long long cellX = std::llround(std::floor(m_positions[i].x / cellSize));
+        long long cellY = std::llround(std::floor(m_positions[i].y / cellSize));
+        long long cellZ = std::llround(std::floor(m_positions[i].z / cellSize));
+        for (int dx = -1; dx <= 1; dx++)
         {
-            if (current < limit)
+            for (int dy = -1; dy <= 1; dy++)
             {
-                // Check if the
-                if (m_colliders[i] == nullptr || m_colliders[j] == nullptr)
-                    continue;
-
-                // Get the two particles
-                Particle* particle0 = nullptr;
-                m_colliders[i]->getGameObject()->getComponentByClass(particle0);
-                Particle* particle1 = nullptr;
-                m_colliders[j]->getGameObject()->getComponentByClass(particle1);
-
-                // Check if the particles have colliders if not, skip these particles
-                //                Particle* particle0 = m_colliders[i]->getParticle();
-                //                Particle* particle1 = m_colliders[j]->getParticle();
-                if (particle0 == nullptr || particle1 == nullptr)
-                    continue;
-
-                // Check if the particles are colliding
-                float distance = particle0->getPosition().distance(particle1->getPosition());
-                float sumRadius = m_colliders[i]->getRadius() + m_colliders[j]->getRadius();
-                if (distance < sumRadius)
+                for (int dz = -1; dz <= 1; dz++)
                 {
-                    particleContact[current].SetParticles(particle0, particle1);
-                    particleContact[current].setPenetration(sumRadius - distance);
-                    particleContact[current].setElasticity(elasticity);
-                    Vector3d normalParticle = particle0->getPosition() - particle1->getPosition();
-                    particleContact[current].setContactNormal(normalParticle);
-                    current += 1;
+                    std::uint64_t cell = getCellKey(cellX + dx, cellY + dy, cellZ + dz);
+                    auto it = std::lower_bound(m_cells.begin(), m_cells.end(), cell,
+                                               [](const CellEntry& a, std::uint64_t key) { return a.cell < key; });
+                    for (; it != m_cells.end() && it->cell == cell; ++it)
+                    {
+                        // Each pair is tested once, from its lowest index
+                        unsigned int j = it->index;
+                        if (j <= i)
+                            continue;
+                        if (current >= limit)
+                            return current;
+
+                        // Check if the particles are colliding
+                        m_candidatePairCount++;
+                        real distance = m_positions[i].distance(m_positions[j]);
+                        real sumRadius = m_colliders[i]->getRadius() + m_colliders[j]->getRadius();
+                        if (distance < sumRadius)
+                        {
+                            particleContact[current].SetParticles(m_particles[i], m_particles[j]);
+                            particleContact[current].setPenetration(sumRadius - distance);
+                            particleContact[current].setElasticity(elasticity);
+                            Vector3d normalParticle = m_positions[i] - m_positions[j];
+                            particleContact[current].setContactNormal(normalParticle);
+                            current += 1;
+                        }
+                    }
                 }
             }
-            else
-            {
-                return current;
-            }
         }
     }
     return current;
 }
+
 void ParticleCollide::cleanColliders() {
     m_colliders.clear();
 }
+
+unsigned int ParticleCollide::getCandidatePairCount() const {
+    return m_candidatePairCount;
+}
+
+std::uint64_t ParticleCollide::getCellKey(long long x, long long y, long long z) {
+    // 21 bits per axis, far cells may share a key which only adds candidates
+    const std::uint64_t mask = (std::uint64_t(1) << 21) - 1;
+    return ((static_cast<std::uint64_t>(x) & mask) << 42) | ((static_cast<std::uint64_t>(y) & mask) << 21) |
+           (static_cast<std::uint64_t>(z) & mask);
+}
@@ -5,23 +5,50 @@
 
 #include "../../Scene/Components/Collider/ParticleCollider/ParticleCollider.h"
 
+#include <cstdint>
 #include <vector>
 
+class Particle;
+
+/// <summary>
+/// Génère les contacts entre les particules ayant un ParticleCollider.
+/// Broadphase : grille uniforme dont les cellules font le diamètre de la plus grosse particule,
+/// les particules sont triées par cellule et chacune n'est testée qu'avec les 27 cellules voisines.
+/// </summary>
 class ParticleCollide : public ParticleContactGenerator {
 
 private:
     std::vector<ParticleCollider*> m_colliders;
 
-    float elasticity;
+    real elasticity;
+
+    unsigned int m_candidatePairCount = 0;
+
+    // Broadphase buffers, kept between frames
+    struct CellEntry {
+        std::uint64_t cell;
+        unsigned int index;
+    };
+    std::vector<Particle*> m_particles;
+    std::vector<Vector3d> m_positions;
+    std::vector<CellEntry> m_cells;
 
 public:
-    explicit ParticleCollide(float elast);
+    explicit ParticleCollide(real elast);
 
     void addCollider(ParticleCollider* particleCollider);
 
     int addContact(ParticleContact* particleContact, unsigned int limit, unsigned int current) override;
 
     void cleanColliders();
+
+    /// <summary>
+    /// Nombre de paires de particules testées lors du dernier addContact
+    /// </summary>
+    unsigned int getCandidatePairCount() const;
+
+private:
+    static std::uint64_t getCellKey(long long x, long long y, long long z);
 };
 
 #endif // !PARTICLECOLLIDE_H
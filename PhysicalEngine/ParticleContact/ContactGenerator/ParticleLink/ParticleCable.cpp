@@ -1,13 +1,13 @@
 #include "ParticleCable.h"
 
-ParticleCable::ParticleCable(Particle *particle1, Particle *particle2, float max_length, float restitution)
+ParticleCable::ParticleCable(Particle *particle1, Particle *particle2, real max_length, real restitution)
         : ParticleLink(particle1, particle2) {
     m_maxLength = max_length;
     m_restitution = restitution;
 }
 
 int ParticleCable::addContact(ParticleContact *particleContact, unsigned int limit, unsigned int current) {
-    float distance = m_particles[0]->getPosition().distance(m_particles[1]->getPosition());
+    real distance = m_particles[0]->getPosition().distance(m_particles[1]->getPosition());
     Vector3d normalParticle = m_particles[0]->getPosition() - m_particles[1]->getPosition();
     if (distance <= m_maxLength) {
         return current;
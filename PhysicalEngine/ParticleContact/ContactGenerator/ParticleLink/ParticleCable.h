@@ -6,12 +6,12 @@
 class ParticleCable : public ParticleLink {
 
 private:
-    float m_maxLength;
-    float m_restitution;
+    real m_maxLength;
+    real m_restitution;
 
 public:
 
-    ParticleCable(Particle *particle1, Particle *particle2, float max_length, float restitution);
+    ParticleCable(Particle *particle1, Particle *particle2, real max_length, real restitution);
 
     int addContact(ParticleContact *particleContact, unsigned int limit, unsigned int current) override;
 };
@@ -1,6 +1,6 @@
 #include "ParticleLink.h"
 
-float ParticleLink::currentLength() const {
+real ParticleLink::currentLength() const {
     return m_particles[0]->getPosition().distance(m_particles[1]->getPosition());
 
 }
@@ -9,7 +9,7 @@ protected:
     Particle *m_particles[2];
 
 public:
-    float currentLength() const;
+    real currentLength() const;
 
     ParticleLink(Particle *particle1, Particle *particle2);
 
@@ -6,10 +6,10 @@
 class ParticleRode : public ParticleLink {
 
 private:
-    float m_length;
+    real m_length;
 
 public:
-    ParticleRode(Particle *particle1, Particle *particle2, float length);
+    ParticleRode(Particle *particle1, Particle *particle2, real length);
 
     int addContact(ParticleContact *particleContact, unsigned int limit, unsigned int current) override;
 };
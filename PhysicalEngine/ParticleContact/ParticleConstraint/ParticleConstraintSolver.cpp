@@ -0,0 +1,265 @@
+#include "ParticleConstraintSolver.h"
+
+#include "../../Scene/Components/PhysicalComponent/Particle/Particle.h"
+#include "imgui/imgui.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+    struct SolveBatch {
+        ParticleConstraintSolver *solver;
+        unsigned int offset;
+        real inverseDeltaTime2;
+    };
+}
+
+ParticleConstraintSolver::ParticleConstraintSolver(JobSystem &jobSystem) : m_jobSystem(jobSystem) {
+}
+
+void ParticleConstraintSolver::addRode(Particle *particle1, Particle *particle2, real length, real compliance) {
+    addConstraint(particle1, particle2, length, compliance, false);
+}
+
+void ParticleConstraintSolver::addCable(Particle *particle1, Particle *particle2, real maxLength, real compliance) {
+    addConstraint(particle1, particle2, maxLength, compliance, true);
+}
+
+void ParticleConstraintSolver::addConstraint(Particle *particle1, Particle *particle2, real length, real compliance,
+                                             bool isCable) {
+    if (particle1 == nullptr || particle2 == nullptr || particle1 == particle2)
+        return;
+    unsigned int index1 = getParticleIndex(particle1);
+    unsigned int index2 = getParticleIndex(particle2);
+    m_constraints.push_back(ParticleDistanceConstraint{ { index1, index2 }, length, compliance, isCable, 0 });
+    m_colorsDirty = true;
+}
+
+unsigned int ParticleConstraintSolver::getParticleIndex(Particle *particle) {
+    auto it = m_particleIndices.find(particle);
+    if (it != m_particleIndices.end())
+        return it->second;
+    auto index = static_cast<unsigned int>(m_particles.size());
+    m_particleIndices[particle] = index;
+    m_particles.push_back(particle);
+    m_positions.emplace_back();
+    m_previousPositions.emplace_back();
+    m_inverseMasses.push_back(0);
+    return index;
+}
+
+void ParticleConstraintSolver::removeConstraints(Particle *particle) {
+    auto it = m_particleIndices.find(particle);
+    if (it == m_particleIndices.end())
+        return;
+    // The particle may be deleted right after, only its slot is kept until the compaction
+    m_particles[it->second] = nullptr;
+    m_particleIndices.erase(it);
+    m_hasRemovedParticles = true;
+}
+
+void ParticleConstraintSolver::compact() {
+    if (!m_hasRemovedParticles)
+        return;
+
+    // Keep the particles of the remaining constraints, in their order so that they only move down
+    const unsigned int noIndex = std::numeric_limits<unsigned int>::max();
+    std::vector<unsigned int> newIndices(m_particles.size(), noIndex);
+    for (const ParticleDistanceConstraint &constraint: m_constraints) {
+        if (m_particles[constraint.particles[0]] == nullptr || m_particles[constraint.particles[1]] == nullptr)
+            continue;
+        newIndices[constraint.particles[0]] = 0;
+        newIndices[constraint.particles[1]] = 0;
+    }
+    m_particleIndices.clear();
+    unsigned int particleCount = 0;
+    for (size_t i = 0; i < m_particles.size(); i++) {
+        if (newIndices[i] == noIndex)
+            continue;
+        newIndices[i] = particleCount;
+        m_particles[particleCount] = m_particles[i];
+        m_particleIndices[m_particles[particleCount]] = particleCount;
+        particleCount++;
+    }
+
+    // Drop the constraints of the removed particles and renumber the others, the order of the colors is kept
+    size_t constraintCount = 0;
+    for (const ParticleDistanceConstraint &constraint: m_constraints) {
+        if (newIndices[constraint.particles[0]] == noIndex || newIndices[constraint.particles[1]] == noIndex)
+            continue;
+        ParticleDistanceConstraint &kept = m_constraints[constraintCount++];
+        kept = constraint;
+        for (unsigned int &index: kept.particles) {
+            index = newIndices[index];
+        }
+    }
+
+    m_constraints.resize(constraintCount);
+    m_particles.resize(particleCount);
+    m_positions.resize(particleCount);
+    m_previousPositions.resize(particleCount);
+    m_inverseMasses.resize(particleCount);
+    m_colorsDirty = true;
+    m_hasRemovedParticles = false;
+}
+
+void ParticleConstraintSolver::clear() {
+    m_particles.clear();
+    m_particleIndices.clear();
+    m_positions.clear();
+    m_previousPositions.clear();
+    m_inverseMasses.clear();
+    m_constraints.clear();
+    m_colorOffsets.clear();
+    m_colorsDirty = false;
+    m_hasRemovedParticles = false;
+}
+
+void ParticleConstraintSolver::reserve(unsigned int constraintCount) {
+    // A constraint brings at most two new particles
+    std::size_t particleCount = m_particles.size() + 2 * static_cast<std::size_t>(constraintCount);
+    m_particles.reserve(particleCount);
+    m_particleIndices.reserve(particleCount);
+    m_positions.reserve(particleCount);
+    m_previousPositions.reserve(particleCount);
+    m_inverseMasses.reserve(particleCount);
+    m_constraints.reserve(m_constraints.size() + constraintCount);
+}
+
+void ParticleConstraintSolver::beginStep() {
+    compact();
+    for (size_t i = 0; i < m_particles.size(); i++) {
+        m_previousPositions[i] = m_particles[i]->getPosition();
+    }
+}
+
+void ParticleConstraintSolver::solve(real deltaTime) {
+    compact();
+    if (m_constraints.empty() || deltaTime <= 0)
+        return;
+    if (m_colorsDirty)
+        buildColors();
+
+    // Gather the integrated positions, kinematic particles are not moved by the constraints
+    for (size_t i = 0; i < m_particles.size(); i++) {
+        Particle *particle = m_particles[i];
+        m_positions[i] = particle->getPosition();
+        m_inverseMasses[i] = (particle->getIsKinematic() || particle->getMass() <= 0) ? 0 : 1 / particle->getMass();
+    }
+    for (ParticleDistanceConstraint &constraint: m_constraints) {
+        constraint.lambda = 0;
+    }
+
+    SolveBatch batch{ this, 0, 1 / (deltaTime * deltaTime) };
+    unsigned int iterations = m_iterations.load(std::memory_order_relaxed);
+    for (unsigned int iteration = 0; iteration < iterations; iteration++) {
+        for (size_t color = 0; color + 1 < m_colorOffsets.size(); color++) {
+            batch.offset = m_colorOffsets[color];
+            m_jobSystem.parallelFor(m_colorOffsets[color + 1] - m_colorOffsets[color], GRAIN_SIZE,
+                                    &ParticleConstraintSolver::solveConstraints, &batch);
+        }
+    }
+
+    // Write back the positions, the speed is the displacement over the step
+    for (size_t i = 0; i < m_particles.size(); i++) {
+        if (m_inverseMasses[i] == 0)
+            continue;
+        m_particles[i]->setPosition(m_positions[i]);
+        m_particles[i]->setLinearSpeed((m_positions[i] - m_previousPositions[i]) / deltaTime);
+    }
+}
+
+void ParticleConstraintSolver::solveConstraints(void *context, unsigned int begin, unsigned int end) {
+    auto *batch = static_cast<SolveBatch *>(context);
+    ParticleConstraintSolver *solver = batch->solver;
+    for (unsigned int i = batch->offset + begin; i < batch->offset + end; i++) {
+        ParticleDistanceConstraint &constraint = solver->m_constraints[i];
+        Vector3d &position1 = solver->m_positions[constraint.particles[0]];
+        Vector3d &position2 = solver->m_positions[constraint.particles[1]];
+        real w1 = solver->m_inverseMasses[constraint.particles[0]];
+        real w2 = solver->m_inverseMasses[constraint.particles[1]];
+
+        Vector3d delta = position1 - position2;
+        real distance = delta.norm();
+        real c = distance - constraint.restLength;
+        if (distance == 0 || (constraint.isCable && c <= 0))
+            continue;
+
+        real alphaTilde = constraint.compliance * batch->inverseDeltaTime2;
+        real denominator = w1 + w2 + alphaTilde;
+        if (denominator == 0)
+            continue;
+        real deltaLambda = (-c - alphaTilde * constraint.lambda) / denominator;
+        constraint.lambda += deltaLambda;
+
+        Vector3d correction = delta * (deltaLambda / distance);
+        position1 += correction * w1;
+        position2 -= correction * w2;
+    }
+}
+
+void ParticleConstraintSolver::buildColors() {
+    // Greedy coloring: each constraint takes the first color not used by its two particles
+    std::vector<std::vector<unsigned int>> particleColors(m_particles.size());
+    std::vector<unsigned int> constraintColors(m_constraints.size());
+    unsigned int colorCount = 0;
+    for (size_t i = 0; i < m_constraints.size(); i++) {
+        const std::vector<unsigned int> &colors1 = particleColors[m_constraints[i].particles[0]];
+        const std::vector<unsigned int> &colors2 = particleColors[m_constraints[i].particles[1]];
+        unsigned int color = 0;
+        while (std::find(colors1.begin(), colors1.end(), color) != colors1.end() ||
+               std::find(colors2.begin(), colors2.end(), color) != colors2.end()) {
+            color++;
+        }
+        constraintColors[i] = color;
+        particleColors[m_constraints[i].particles[0]].push_back(color);
+        particleColors[m_constraints[i].particles[1]].push_back(color);
+        colorCount = std::max(colorCount, color + 1);
+    }
+
+    // Counting sort of the constraints by color
+    m_colorOffsets.assign(colorCount + 1, 0);
+    for (unsigned int color: constraintColors) {
+        m_colorOffsets[color + 1]++;
+    }
+    for (unsigned int color = 0; color < colorCount; color++) {
+        m_colorOffsets[color + 1] += m_colorOffsets[color];
+    }
+    std::vector<unsigned int> insertPosition(m_colorOffsets.begin(), m_colorOffsets.end() - 1);
+    std::vector<ParticleDistanceConstraint> sortedConstraints(m_constraints.size());
+    for (size_t i = 0; i < m_constraints.size(); i++) {
+        sortedConstraints[insertPosition[constraintColors[i]]++] = m_constraints[i];
+    }
+    m_constraints = std::move(sortedConstraints);
+    m_colorsDirty = false;
+}
+
+void ParticleConstraintSolver::drawGui() {
+    int iterations = static_cast<int>(getIterations());
+    ImGui::Text("Solver iterations");
+    if (ImGui::SliderInt("##ParticleConstraintSolverIterations", &iterations, 1, 50))
+        setIterations(static_cast<unsigned int>(iterations));
+}
+
+unsigned int ParticleConstraintSolver::getConstraintCount() const {
+    return static_cast<unsigned int>(m_constraints.size());
+}
+
+const std::vector<ParticleDistanceConstraint> &ParticleConstraintSolver::getConstraints() const {
+    return m_constraints;
+}
+
+Particle *ParticleConstraintSolver::getParticle(unsigned int index) const {
+    return m_particles[index];
+}
+
+unsigned int ParticleConstraintSolver::getColorCount() const {
+    return m_colorOffsets.empty() ? 0 : static_cast<unsigned int>(m_colorOffsets.size() - 1);
+}
+
+unsigned int ParticleConstraintSolver::getIterations() const {
+    return m_iterations.load(std::memory_order_relaxed);
+}
+
+void ParticleConstraintSolver::setIterations(unsigned int iterations) {
+    m_iterations.store(iterations, std::memory_order_relaxed);
+}
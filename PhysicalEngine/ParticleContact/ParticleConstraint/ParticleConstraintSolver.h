@@ -0,0 +1,120 @@
+#ifndef PARTICLECONSTRAINTSOLVER_H
+#define PARTICLECONSTRAINTSOLVER_H
+
+#include "../../Utility/JobSystem.h"
+#include "../../Utility/Vector3d.h"
+#include "ParticleDistanceConstraint.h"
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
+class Particle;
+
+/// <summary>
+/// Solveur XPBD (extended position based dynamics) pour les réseaux de tiges et de câbles entre particules.
+/// Les contraintes sont colorées pour qu'aucune particule ne soit partagée dans une même couleur,
+/// chaque couleur est alors résolue en parallèle par le JobSystem de la scène.
+/// </summary>
+class ParticleConstraintSolver {
+private:
+    static constexpr unsigned int GRAIN_SIZE = 256;
+
+    // Particles referenced by the constraints, stored as arrays for the solve. A removed particle is left as
+    // nullptr with its constraints until compact() runs at the start of the next step
+    std::vector<Particle *> m_particles;
+    std::unordered_map<Particle *, unsigned int> m_particleIndices;
+    std::vector<Vector3d> m_positions;
+    std::vector<Vector3d> m_previousPositions;
+    std::vector<real> m_inverseMasses;
+
+    // Constraints sorted by color, color i is [m_colorOffsets[i], m_colorOffsets[i + 1])
+    std::vector<ParticleDistanceConstraint> m_constraints;
+    std::vector<unsigned int> m_colorOffsets;
+    bool m_colorsDirty = false;
+    bool m_hasRemovedParticles = false;
+
+    // Set by the interface while the physics thread may be solving, read once per solve
+    std::atomic<unsigned int> m_iterations{ 10 };
+
+    // Shared with the other stages of the scene, not owned
+    JobSystem &m_jobSystem;
+
+public:
+    explicit ParticleConstraintSolver(JobSystem &jobSystem);
+
+    /// <summary>
+    /// Tige : la distance entre les particules reste length
+    /// </summary>
+    void addRode(Particle *particle1, Particle *particle2, real length, real compliance = 0);
+
+    /// <summary>
+    /// Câble : la distance entre les particules ne dépasse pas maxLength
+    /// </summary>
+    void addCable(Particle *particle1, Particle *particle2, real maxLength, real compliance = 0);
+
+    /// <summary>
+    /// Supprime toutes les contraintes qui utilisent la particule. Elles sont seulement marquées, la compaction a lieu
+    /// une fois au début du pas suivant, ou lors d'un appel à compact()
+    /// </summary>
+    void removeConstraints(Particle *particle);
+
+    /// <summary>
+    /// Retire les contraintes et les particules marquées par removeConstraints
+    /// </summary>
+    void compact();
+
+    void clear();
+
+    /// <summary>
+    /// Réserve la place de constraintCount contraintes supplémentaires et de leurs particules (chargement en masse)
+    /// </summary>
+    void reserve(unsigned int constraintCount);
+
+    /// <summary>
+    /// Enregistre les positions avant l'intégration, à appeler avant le PhysicHandler
+    /// </summary>
+    void beginStep();
+
+    /// <summary>
+    /// Projette les positions intégrées sur les contraintes puis recalcule les vitesses à partir du déplacement
+    /// </summary>
+    void solve(real deltaTime);
+
+    /// <summary>
+    /// Nombre d'itérations, les nombres de contraintes et de couleurs sont dans les compteurs du Profiler
+    /// </summary>
+    void drawGui();
+
+    /// <summary>
+    /// Nombre de contraintes, celles marquées par removeConstraints comptent jusqu'à la compaction
+    /// </summary>
+    unsigned int getConstraintCount() const;
+
+    /// <summary>
+    /// Contraintes triées par couleur, leurs indices de particules se lisent avec getParticle (nullptr pour une
+    /// particule supprimée qui attend la compaction)
+    /// </summary>
+    const std::vector<ParticleDistanceConstraint> &getConstraints() const;
+
+    Particle *getParticle(unsigned int index) const;
+
+    /// <summary>
+    /// Nombre de couleurs de la dernière résolution, les ajouts et suppressions ne le changent qu'à la suivante
+    /// </summary>
+    unsigned int getColorCount() const;
+
+    unsigned int getIterations() const;
+
+    void setIterations(unsigned int iterations);
+
+private:
+    void addConstraint(Particle *particle1, Particle *particle2, real length, real compliance, bool isCable);
+
+    unsigned int getParticleIndex(Particle *particle);
+
+    void buildColors();
+
+    static void solveConstraints(void *context, unsigned int begin, unsigned int end);
+};
+
+#endif // PARTICLECONSTRAINTSOLVER_H
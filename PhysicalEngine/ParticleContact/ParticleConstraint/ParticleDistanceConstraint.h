@@ -0,0 +1,20 @@
+#ifndef PARTICLEDISTANCECONSTRAINT_H
+#define PARTICLEDISTANCECONSTRAINT_H
+
+#include "../../Utility/Precision.h"
+
+/// <summary>
+/// Contrainte de distance XPBD entre deux particules du ParticleConstraintSolver (indices dans le solveur)
+/// compliance = 0 : tige rigide, compliance > 0 : lien élastique (inverse de la raideur)
+/// </summary>
+struct ParticleDistanceConstraint {
+    unsigned int particles[2];
+    real restLength;
+    real compliance;
+    // A cable only resists stretching, a rode keeps the exact length
+    bool isCable;
+    // Accumulated Lagrange multiplier, reset at each step
+    real lambda;
+};
+
+#endif // PARTICLEDISTANCECONSTRAINT_H
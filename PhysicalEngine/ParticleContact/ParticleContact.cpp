@@ -3,13 +3,13 @@
 
 void ParticleContact::updateAttributes() {
     //m_contactNormal = (m_particules[0]->getPosition() - m_particules[1]->getPosition()).normalize();
-    //float distance = m_particules[0]->getPosition().distance(m_particules[1]->getPosition());
+    //real distance = m_particules[0]->getPosition().distance(m_particules[1]->getPosition());
     //m_penetration = m_particulesCollider[0].getRadius() + m_particulesCollider[0].getRadius() - distance;
 }
 
 void ParticleContact::resolveSpeed() {
     Vector3d vrel;
-    float k, m1, m2;
+    real k, m1, m2;
     m1 = m_particules[0]->getMass();
     m2 = m_particules[1]->getMass();
     vrel = m_particules[0]->getLinearSpeed() - m_particules[1]->getLinearSpeed();
@@ -20,7 +20,7 @@ void ParticleContact::resolveSpeed() {
 
 void ParticleContact::resolveInterpenetration() {
     if (m_penetration > 0) {
-        float dp1, dp2, w1, w2;
+        real dp1, dp2, w1, w2;
         w1 = m_particules[0]->getMass();
         w2 = m_particules[1]->getMass();
         dp1 = (w2 / (w1 + w2)) * m_penetration;
@@ -38,11 +38,11 @@ ParticleContact::ParticleContact() {
 }
 
 
-void ParticleContact::setPenetration(float penetration) {
+void ParticleContact::setPenetration(real penetration) {
     m_penetration = penetration;
 }
 
-void ParticleContact::setElasticity(float elasticity) {
+void ParticleContact::setElasticity(real elasticity) {
     m_collision_elasticity = elasticity;
 }
 
@@ -69,6 +69,6 @@ void ParticleContact::resolve(float time) {
     resolveSpeed();
 }
 
-float ParticleContact::CalculateSeparatingVelocity() {
+real ParticleContact::CalculateSeparatingVelocity() {
     return (m_particules[0]->getLinearSpeed() - m_particules[1]->getLinearSpeed()).dot(m_contactNormal);
 }
@@ -7,9 +7,9 @@ class ParticleContact {
 private:
     Particle *m_particules[2];
 
-    float m_collision_elasticity = 0;
+    real m_collision_elasticity = 0;
 
-    float m_penetration = 0;
+    real m_penetration = 0;
 
     Vector3d m_contactNormal;
 
@@ -24,9 +24,9 @@ public:
 
     ParticleContact();
 
-    void setPenetration(float penetration);
+    void setPenetration(real penetration);
 
-    void setElasticity(float elasticity);
+    void setElasticity(real elasticity);
 
     void setContactNormal(Vector3d normalContact);
 
@@ -38,7 +38,7 @@ public:
 
     void resolve(float time);
 
-    float CalculateSeparatingVelocity();
+    real CalculateSeparatingVelocity();
 
 
 };
@@ -1,26 +1,121 @@
 #include "ParticleContactResolver.h"
 
-ParticleContactResolver::ParticleContactResolver(unsigned int maxIterations) {
+#include <algorithm>
+
+namespace {
+    struct ResolveBatch {
+        ParticleContact *contacts;
+        const unsigned int *order;
+        float time;
+        std::atomic<bool> resolved;
+    };
+}
+
+ParticleContactResolver::ParticleContactResolver(unsigned int maxIterations, JobSystem &jobSystem)
+        : m_jobSystem(jobSystem) {
     m_maxIterations = maxIterations;
 }
 
 void ParticleContactResolver::resolveContact(ParticleContact *particlesContacts, int size, float time) {
-    if (size > 0) {
-        for (unsigned int i = 0; i <= m_maxIterations; i++) {
-            float minSpeed = particlesContacts[0].CalculateSeparatingVelocity();
-            ParticleContact contactToResolve = particlesContacts[0];
-            for (int j = 1; j < size; j++) {
-                float particuleContactSpeed = particlesContacts[j].CalculateSeparatingVelocity();
-                if (particuleContactSpeed < minSpeed) {
-                    minSpeed = particuleContactSpeed;
-                    contactToResolve = particlesContacts[j];
-                }
-            }
-            if (minSpeed >= 0) {
-                return;
-            } else {
-                contactToResolve.resolve(time);
-            }
+    m_lastIterationCount = 0;
+    if (size <= 0)
+        return;
+    auto count = static_cast<unsigned int>(size);
+    buildColors(particlesContacts, count);
+
+    // Each sweep may resolve every contact once, keep the same budget of resolutions as before
+    unsigned int maxSweeps = std::max(1u, m_maxIterations / count);
+    ResolveBatch batch{ particlesContacts, m_order.data(), time, { false } };
+    for (unsigned int sweep = 0; sweep < maxSweeps; sweep++) {
+        m_lastIterationCount++;
+        batch.resolved = false;
+        for (size_t color = 0; color + 1 < m_colorOffsets.size(); color++) {
+            unsigned int begin = m_colorOffsets[color];
+            unsigned int colorSize = m_colorOffsets[color + 1] - begin;
+            if (colorSize == 0)
+                continue;
+            batch.order = m_order.data() + begin;
+            if (color == MAX_COLORS)
+                resolveContacts(&batch, 0, colorSize);
+            else
+                m_jobSystem.parallelFor(colorSize, GRAIN_SIZE, &ParticleContactResolver::resolveContacts, &batch);
         }
+        if (!batch.resolved)
+            return;
     }
 }
+
+void ParticleContactResolver::resolveContacts(void *context, unsigned int begin, unsigned int end) {
+    auto *batch = static_cast<ResolveBatch *>(context);
+    bool resolved = false;
+    for (unsigned int i = begin; i < end; i++) {
+        ParticleContact &contact = batch->contacts[batch->order[i]];
+        if (contact.CalculateSeparatingVelocity() < 0) {
+            contact.resolve(batch->time);
+            resolved = true;
+        }
+    }
+    if (resolved)
+        batch->resolved.store(true, std::memory_order_relaxed);
+}
+
+void ParticleContactResolver::buildColors(ParticleContact *particlesContacts, unsigned int size) {
+    // Greedy coloring: each contact takes the first color used by neither of its particles
+    m_particles.clear();
+    for (unsigned int i = 0; i < size; i++) {
+        Particle **particles = particlesContacts[i].GetParticles();
+        m_particles.push_back(particles[0]);
+        m_particles.push_back(particles[1]);
+    }
+    std::sort(m_particles.begin(), m_particles.end());
+    m_particles.erase(std::unique(m_particles.begin(), m_particles.end()), m_particles.end());
+    m_particleColors.assign(m_particles.size(), 0);
+
+    // Every contact generator (collisions, rods, cables) links two particles
+    m_contactColors.resize(size);
+    m_colorOffsets.assign(MAX_COLORS + 2, 0);
+    for (unsigned int i = 0; i < size; i++) {
+        Particle **particles = particlesContacts[i].GetParticles();
+        std::uint64_t &colors1 = m_particleColors[findParticle(particles[0])];
+        std::uint64_t &colors2 = m_particleColors[findParticle(particles[1])];
+        std::uint64_t usedColors = colors1 | colors2;
+        unsigned int color = 0;
+        while (color < MAX_COLORS && (usedColors & (std::uint64_t(1) << color)) != 0) {
+            color++;
+        }
+        if (color < MAX_COLORS) {
+            colors1 |= std::uint64_t(1) << color;
+            colors2 |= std::uint64_t(1) << color;
+        }
+        m_contactColors[i] = static_cast<unsigned char>(color);
+        m_colorOffsets[color + 1]++;
+    }
+
+    // Counting sort of the contacts by color
+    unsigned int insertPosition[MAX_COLORS + 1];
+    for (unsigned int color = 0; color < MAX_COLORS + 1; color++) {
+        m_colorOffsets[color + 1] += m_colorOffsets[color];
+        insertPosition[color] = m_colorOffsets[color];
+    }
+    m_order.resize(size);
+    for (unsigned int i = 0; i < size; i++) {
+        m_order[insertPosition[m_contactColors[i]]++] = i;
+    }
+}
+
+size_t ParticleContactResolver::findParticle(Particle *particle) const {
+    return std::lower_bound(m_particles.begin(), m_particles.end(), particle) - m_particles.begin();
+}
+
+unsigned int ParticleContactResolver::getColorCount() const {
+    unsigned int colorCount = 0;
+    for (size_t color = 0; color + 1 < m_colorOffsets.size(); color++) {
+        if (m_colorOffsets[color + 1] != m_colorOffsets[color])
+            colorCount++;
+    }
+    return colorCount;
+}
+
+unsigned int ParticleContactResolver::getLastIterationCount() const {
+    return m_lastIterationCount;
+}
@@ -1,20 +1,59 @@
 #ifndef PARTICULE_CONTACT_RESOLVER_H
 #define PARTICULE_CONTACT_RESOLVER_H
 
+#include "../Utility/JobSystem.h"
 #include "ParticleContact.h"
-
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Résolution des contacts par Gauss-Seidel parallèle : les contacts sont colorés pour qu'aucune particule
+/// ne soit partagée dans une même couleur, les couleurs sont résolues l'une après l'autre et les contacts
+/// d'une couleur en parallèle.
+/// </summary>
 class ParticleContactResolver {
-
 private:
+    static constexpr unsigned int GRAIN_SIZE = 256;
+    static constexpr unsigned int MAX_COLORS = 64;
+
     unsigned int m_maxIterations;
+    unsigned int m_lastIterationCount = 0;
 
+    // Contact indices sorted by color, color i is [m_colorOffsets[i], m_colorOffsets[i + 1])
+    // The last color holds the contacts that did not fit in MAX_COLORS, it is resolved sequentially
+    std::vector<unsigned int> m_order;
+    std::vector<unsigned int> m_colorOffsets;
+    std::vector<unsigned char> m_contactColors;
+    // Distinct particles of the contacts, sorted, and the colors already used by each of them
+    // (vectors instead of a map so that nothing is allocated once their capacity is reached)
+    std::vector<Particle *> m_particles;
+    std::vector<std::uint64_t> m_particleColors;
 
-public:
+    // Shared with the other stages of the scene, not owned
+    JobSystem &m_jobSystem;
 
-    explicit ParticleContactResolver(unsigned int maxIterations);
+public:
 
+    ParticleContactResolver(unsigned int maxIterations, JobSystem &jobSystem);
 
+    /// <summary>
+    /// Résout les contacts tant qu'il en reste qui se rapprochent, dans la limite de maxIterations résolutions
+    /// </summary>
     void resolveContact(ParticleContact *particlesContacts, int size, float time);
+
+    unsigned int getColorCount() const;
+
+    /// <summary>
+    /// Nombre de passes sur les couleurs lors du dernier resolveContact
+    /// </summary>
+    unsigned int getLastIterationCount() const;
+
+private:
+    void buildColors(ParticleContact *particlesContacts, unsigned int size);
+
+    size_t findParticle(Particle *particle) const;
+
+    static void resolveContacts(void *context, unsigned int begin, unsigned int end);
 };
 
 #endif // !PARTICULE_CONTACT_RESOLVER_H
@@ -8,6 +8,9 @@
 #include "Scene/Components/Component.h"
 #include "Scene/GameObject.h"
 #include "Scene/Scene.h"
+#include "Scene/SceneLoader.h"
+#include "Utility/AllocationTracker.h"
+#include "Utility/Determinism.h"
 #include "Utility/RollingBuffer.h"
 
 // Dear ImGui
@@ -144,6 +147,8 @@ PhysicalEngineLauncher::PhysicalEngineLauncher() {
 }
 
 PhysicalEngineLauncher::~PhysicalEngineLauncher() {
+    physicsThread.stop();
+    trajectoryRecorder.stop();
     delete scene;
 
     ImGui_ImplOpenGL3_Shutdown();
@@ -156,12 +161,18 @@ PhysicalEngineLauncher::~PhysicalEngineLauncher() {
     glfwTerminate();
 }
 
-void PhysicalEngineLauncher::start() {
+void PhysicalEngineLauncher::start(const char* scenePath) {
     auto start = std::chrono::steady_clock::now();
 
     // Create game (generate game objects into the scene)
     //    game.start(scene.get());
-    game.start(scene);
+    if (scenePath == nullptr || !SceneLoader::loadFromFile(scenePath, *scene))
+        game.start(scene);
+
+#ifndef __EMSCRIPTEN__
+    // The physics runs on its own thread, the frames draw its last published state
+    physicsThread.start(scene);
+#endif
 
     // Game loop
 #ifdef __EMSCRIPTEN__
@@ -199,6 +210,13 @@ void PhysicalEngineLauncher::handleGui() {
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
     if (!isFullScreen) {
+        // The panels show the values of the last published step. The objects, their names and components only change
+        // on this thread, under the scene lock, and are read without it; the lock is only taken by the edits
+        const RenderSnapshot *snapshot = physicsThread.isRunning() ? &physicsThread.acquireSnapshot() : nullptr;
+        const Profiler &profiler = snapshot != nullptr ? snapshot->profiler : scene->getProfiler();
+        // Copied by the inspector for the speed graph
+        bool hasSelectedSpeed = false;
+        Vector3d selectedSpeed;
 
 #ifdef __EMSCRIPTEN__
         static bool startPosition = true;
@@ -266,6 +284,9 @@ void PhysicalEngineLauncher::handleGui() {
                         ImGui::GetIO().Framerate);
             ImGui::Text("Window width: %d", windowWidth);
             ImGui::Text("Window height: %d", windowHeight);
+            ImGui::Text("Draw calls: %u", scene->getDrawCallCount());
+            ImGui::Text("Drawn objects: %zu / %zu", scene->getDrawnObjectCount(), scene->getGameObjects().size());
+            ImGui::Text("Drawn vertices: %zu", scene->getDrawnVertexCount());
             ImGui::End();
         }
         {
@@ -276,13 +297,41 @@ void PhysicalEngineLauncher::handleGui() {
             }
 #endif
             ImGui::Begin("Hierarchy");
-            for (int i = 0; i < scene->getGameObjects().size(); i++) {
-                ImGui::Selectable((scene->getPtrGameObjectByIndex(i)->getName()).c_str(),
-                                  gameObject == scene->getPtrGameObjectByIndex(i));
-                if (ImGui::IsItemClicked()) {
-                    this->gameObject = scene->getPtrGameObjectByIndex(i);
+            gameObjectIndex.update(*scene);
+            ImGui::InputText("Search", hierarchySearch.data(), hierarchySearch.size());
+            const char *componentPreview = hierarchyComponentType == GAMEOBJECTINDEX_ALL_COMPONENTS
+                                           ? "All" : Component::componentsNamesList[hierarchyComponentType];
+            if (ImGui::BeginCombo("Component", componentPreview)) {
+                if (ImGui::Selectable("All", hierarchyComponentType == GAMEOBJECTINDEX_ALL_COMPONENTS)) {
+                    hierarchyComponentType = GAMEOBJECTINDEX_ALL_COMPONENTS;
+                }
+                for (int i = 0; i < GameObjectIndex::getComponentTypeCount(); i++) {
+                    if (ImGui::Selectable(Component::componentsNamesList[i], hierarchyComponentType == i)) {
+                        hierarchyComponentType = i;
+                    }
+                }
+                ImGui::EndCombo();
+            }
+            const std::vector<GameObject *> &listedObjects =
+                    gameObjectIndex.getMatches(hierarchySearch.data(), hierarchyComponentType);
+            ImGui::Text("%zu / %zu objects", listedObjects.size(), scene->getGameObjects().size());
+
+            // Only the rows in view are submitted, the buttons below keep their place
+            float buttonsHeight = ImGui::GetTextLineHeightWithSpacing() + 2 * ImGui::GetFrameHeightWithSpacing();
+            ImGui::BeginChild("##HierarchyList", ImVec2(0, -buttonsHeight), true);
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(listedObjects.size()));
+            while (clipper.Step()) {
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                    GameObject *listedObject = listedObjects[i];
+                    ImGui::PushID(listedObject);
+                    if (ImGui::Selectable(listedObject->getName().c_str(), gameObject == listedObject)) {
+                        this->gameObject = listedObject;
+                    }
+                    ImGui::PopID();
                 }
             }
+            ImGui::EndChild();
 
             ImGui::NewLine();
             if (ImGuiUtility::ButtonCenteredOnLine("Create GameObject", 0.5f)) {
@@ -292,6 +341,7 @@ void PhysicalEngineLauncher::handleGui() {
                 for (auto &gameObjType: Mesh::meshNamesList) {
                     if (ImGui::MenuItem(gameObjType)) {
                         // Create and select game object in hierarchy
+                        std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
                         gameObject = scene->createGameObject(gameObjType);
                     }
                 }
@@ -299,6 +349,7 @@ void PhysicalEngineLauncher::handleGui() {
             }
 
             if (ImGuiUtility::ButtonCenteredOnLine("Delete selected GameObject", 0.5f)) {
+                std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
                 scene->deleteGameObject(gameObject);
                 gameObject = nullptr;
             }
@@ -318,7 +369,71 @@ void PhysicalEngineLauncher::handleGui() {
 #ifndef __EMSCRIPTEN__
             ImGui::Checkbox("Mesh: Fill/Line", scene->getPtrWireFrameState());
 #endif
+            ImGui::Checkbox("Frustum culling", scene->getPtrFrustumCulling());
+            ImGui::Checkbox("Level of detail", scene->getPtrLevelOfDetail());
 //            ImGui::Checkbox("Show axis", scene->getPtrShowAxis());
+            ImGui::NewLine();
+            bool deterministic = Determinism::isEnabled();
+            if (ImGui::Checkbox("Deterministic stepping", &deterministic)) {
+                Determinism::setEnabled(deterministic);
+            }
+            if (deterministic && snapshot != nullptr) {
+                // The hash is published from the next step after the mode is enabled
+                ImGui::Text("Step %llu, state hash %016llx", snapshot->stepCount,
+                            static_cast<unsigned long long>(snapshot->stateHash));
+            } else if (deterministic) {
+                ImGui::Text("Step %llu, state hash %016llx", scene->getStepCount(),
+                            static_cast<unsigned long long>(scene->getStateHash()));
+            }
+            if (ImGui::Button("Save checkpoint")) {
+                std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
+                checkpoint.capture(*scene);
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Restore checkpoint") && checkpoint.isValid()) {
+                // The objects may be rebuilt, the selection would dangle
+                std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
+                gameObject = nullptr;
+                checkpoint.restore(*scene);
+            }
+            if (ImGui::Button("Write to file") && checkpoint.isValid()) {
+                checkpoint.saveToFile(SNAPSHOT_FILE_NAME);
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Load from file") && checkpoint.loadFromFile(SNAPSHOT_FILE_NAME)) {
+                std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
+                gameObject = nullptr;
+                checkpoint.restore(*scene);
+            }
+            bool recordTrajectories = trajectoryRecorder.isRecording();
+            if (ImGui::Checkbox("Record trajectories", &recordTrajectories)) {
+                std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
+                if (recordTrajectories && trajectoryRecorder.start(TRAJECTORY_FILE_NAME, *scene)) {
+                    scene->setTrajectoryRecorder(&trajectoryRecorder);
+                } else {
+                    trajectoryRecorder.stop();
+                    scene->setTrajectoryRecorder(nullptr);
+                }
+            }
+            if (trajectoryRecorder.isRecording()) {
+                ImGui::Text("%zu bodies, %llu frames (%llu dropped)", trajectoryRecorder.getBodyCount(),
+                            trajectoryRecorder.getRecordedFrames(), trajectoryRecorder.getDroppedFrames());
+            }
+            if (!trajectoryPlayer.isOpen()) {
+                if (ImGui::Button("Play trajectories") && !trajectoryRecorder.isRecording())
+                    trajectoryPlayer.open(TRAJECTORY_FILE_NAME);
+            } else if (ImGui::Button("Stop playback")) {
+                trajectoryPlayer.close();
+            }
+            trajectoryPlayer.drawGui();
+            ImGui::NewLine();
+            const char *integratorName = scene->getPhysicHandlerPtr()->drawGui();
+            if (integratorName != nullptr) {
+                std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
+                scene->getPhysicHandlerPtr()->setIntegrator(integratorName);
+            }
+            ImGui::NewLine();
+            scene->getParticleConstraintSolverPtr()->drawGui();
             ImGui::End();
         }
         {
@@ -351,6 +466,13 @@ void PhysicalEngineLauncher::handleGui() {
 #endif
             ImGui::Begin("Inspector");
             if (gameObject != nullptr) {
+                // The components are edited in place, the physics waits for the inspector of the selected object only
+                std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
+                PhysicalComponent *physicalComponent = nullptr;
+                gameObject->getComponentByClass(physicalComponent);
+                hasSelectedSpeed = physicalComponent != nullptr;
+                if (hasSelectedSpeed)
+                    selectedSpeed = physicalComponent->getLinearSpeed();
                 ImGui::Text("Name: %s", gameObject->getName().c_str());
                 if (ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen)) {
                     gameObject->drawTransformGui();
@@ -371,6 +493,8 @@ void PhysicalEngineLauncher::handleGui() {
                     for (auto &componentName: Component::componentsNamesList) {
                         if (ImGui::MenuItem(componentName)) {
                             gameObject->addComponentByName(componentName);
+                            gameObjectIndex.invalidate();
+                            scene->invalidateOctree();
                         }
                     }
                     ImGui::EndPopup();
@@ -382,11 +506,17 @@ void PhysicalEngineLauncher::handleGui() {
                 if (ImGui::BeginPopup("Delete component##DeleteComponentPopup")) {
                     for (auto &component: gameObject->getComponents()) {
                         if (ImGui::MenuItem(component->getName().c_str())) {
-                            gameObject->deleteComponentByName(component->getName());
+                            scene->deleteComponent(gameObject, component->getName());
+                            gameObjectIndex.invalidate();
+                            // The component list changed under the loop
+                            break;
                         }
                     }
                     ImGui::EndPopup();
                 }
+                // A transform or collider being edited is not where the octree of the last step put it
+                if (ImGui::IsAnyItemActive() && ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows))
+                    scene->invalidateOctree();
             }
             ImGui::End();
         }
@@ -407,15 +537,10 @@ void PhysicalEngineLauncher::handleGui() {
                 static float t = 0;
                 t += ImGui::GetIO().DeltaTime;
 
-                PhysicalComponent *pPhysicalComponent = nullptr;
-                if (gameObject != nullptr) {
-                    gameObject->getComponentByClass(pPhysicalComponent);
-                }
-                if (pPhysicalComponent != nullptr) {
-                    Vector3d speed = pPhysicalComponent->getLinearSpeed();
-                    rdata1.AddPoint(t, speed.x);
-                    rdata2.AddPoint(t, speed.y);
-                    rdata3.AddPoint(t, speed.z);
+                if (hasSelectedSpeed) {
+                    rdata1.AddPoint(t, selectedSpeed.x);
+                    rdata2.AddPoint(t, selectedSpeed.y);
+                    rdata3.AddPoint(t, selectedSpeed.z);
                 } else {
                     rdata1.AddPoint(t, 0);
                     rdata2.AddPoint(t, 0);
@@ -445,6 +570,63 @@ void PhysicalEngineLauncher::handleGui() {
             }
             ImGui::End();
         }
+        {
+            ImGui::Begin("Step profiler");
+            {
+                static RollingBuffer stageData[PROFILER_STAGE_COUNT];
+                static RollingBuffer totalData;
+                static float t = 0;
+                t += ImGui::GetIO().DeltaTime;
+
+                for (int i = 0; i < PROFILER_STAGE_COUNT; i++) {
+                    stageData[i].AddPoint(t, profiler.getStageTime(static_cast<ProfilerStage>(i)));
+                }
+                totalData.AddPoint(t, profiler.getTotalTime());
+
+                static float history = 10.0f;
+                static ImPlotAxisFlags flags = ImPlotAxisFlags_NoTickLabels;
+
+                if (ImPlot::BeginPlot("Step stages##Rolling", ImVec2(-1, 200))) {
+                    ImPlot::SetupAxes(nullptr, "ms", flags, ImPlotAxisFlags_AutoFit);
+                    ImPlot::SetupAxisLimits(ImAxis_X1, 0, history, ImGuiCond_Always);
+                    ImPlot::PlotLine("Total##ImPlotStepTotal", &totalData.Data[0].x, &totalData.Data[0].y,
+                                     totalData.Data.size(), 0, 0, 2 * sizeof(float));
+                    for (int i = 0; i < PROFILER_STAGE_COUNT; i++) {
+                        ImPlot::PlotLine(Profiler::stagesNamesList[i], &stageData[i].Data[0].x,
+                                         &stageData[i].Data[0].y, stageData[i].Data.size(), 0, 0,
+                                         2 * sizeof(float));
+                    }
+                    ImPlot::EndPlot();
+                }
+                ImGui::SliderFloat("History##StepProfilerHistory", &history, 1, 30, "%.1f s");
+                for (RollingBuffer &data: stageData) {
+                    data.Span = history;
+                }
+                totalData.Span = history;
+
+                ImGui::Text("Total: %.3f ms", profiler.getTotalTime());
+                for (int i = 0; i < PROFILER_STAGE_COUNT; i++) {
+                    ImGui::Text("%s: %.3f ms", Profiler::stagesNamesList[i],
+                                profiler.getStageTime(static_cast<ProfilerStage>(i)));
+                }
+                ImGui::NewLine();
+                for (int i = 0; i < PROFILER_COUNTER_COUNT; i++) {
+                    ImGui::Text("%s: %u", Profiler::countersNamesList[i],
+                                profiler.getCounter(static_cast<ProfilerCounter>(i)));
+                }
+                if (AllocationTracker::isEnabled()) {
+                    ImGui::NewLine();
+                    ImGui::Text("Allocations: %llu", profiler.getTotalAllocations());
+                    for (int i = 0; i < PROFILER_STAGE_COUNT; i++) {
+                        auto stage = static_cast<ProfilerStage>(i);
+                        ImGui::Text("%s: %llu allocs, %llu bytes, peak %lld bytes", Profiler::stagesNamesList[i],
+                                    profiler.getStageAllocations(stage), profiler.getStageAllocatedBytes(stage),
+                                    profiler.getStagePeakBytes(stage));
+                    }
+                }
+            }
+            ImGui::End();
+        }
         {
             //            ImGui::Begin("Project files");
             //
@@ -480,6 +662,21 @@ void PhysicalEngineLauncher::updateGame(std::chrono::steady_clock::time_point &s
             std::chrono::steady_clock::now() - start)
             .count();
     start = std::chrono::steady_clock::now();
+    InputManager::updateCamera(scene->getCameraPtr());
+    physicsThread.setPaused(trajectoryPlayer.isOpen());
+    if (trajectoryPlayer.isOpen()) {
+        // Playback: the recorded frames place the bodies, no physics step
+        scene->getCameraPtr()->update((float) deltaTime / 1000.0f);
+        // The paused physics thread still publishes the matrices
+        std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
+        trajectoryPlayer.update(*scene);
+        return;
+    }
+    if (physicsThread.isRunning()) {
+        // The physics thread steps the scene, only the camera follows the frames
+        scene->getCameraPtr()->update((float) deltaTime / 1000.0f);
+        return;
+    }
     scene->update((float) deltaTime / 1000.0f);
     //    scene->update(1000.0f / ImGui::GetIO().Framerate);
 }
@@ -508,8 +705,11 @@ void PhysicalEngineLauncher::updateScreen() {
         }
 #endif
 
-        // Draw game
-        scene->draw(display_w, display_h);
+        // Draw game, from the last physics snapshot unless the objects changed since
+        if (!physicsThread.isRunning() || !scene->draw(display_w, display_h, physicsThread.acquireSnapshot())) {
+            std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
+            scene->draw(display_w, display_h);
+        }
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
     }
     // Swap buffers
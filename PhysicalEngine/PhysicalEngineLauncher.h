@@ -18,8 +18,16 @@
 
 #define CONSOLE_BUFFER_SIZE 1024
 
+#define SNAPSHOT_FILE_NAME "scene_snapshot.bin"
+#define TRAJECTORY_FILE_NAME "trajectories.petr"
+
 #include "Game.h"
+#include "Scene/GameObjectIndex.h"
+#include "Scene/PhysicsThread.h"
 #include "Scene/Scene.h"
+#include "Scene/SceneSnapshot.h"
+#include "Scene/TrajectoryPlayer.h"
+#include "Scene/TrajectoryRecorder.h"
 #include <array>
 #include <chrono>
 
@@ -46,6 +54,23 @@ private:
     // Selected GameObject in the scene
     GameObject* gameObject = nullptr;
 
+    // Hierarchy list, filtered by name and by component type through the index
+    GameObjectIndex gameObjectIndex;
+    std::array<char, 64> hierarchySearch = {};
+    int hierarchyComponentType = GAMEOBJECTINDEX_ALL_COMPONENTS;
+
+    // Checkpoint of the scene, restored on demand
+    SceneSnapshot checkpoint;
+
+    // Records the bodies of the scene to TRAJECTORY_FILE_NAME while enabled
+    TrajectoryRecorder trajectoryRecorder;
+
+    // While a trajectory file is open, it drives the transforms instead of the physics
+    TrajectoryPlayer trajectoryPlayer;
+
+    // Steps the scene at its own rate, the panels read its snapshots and only lock the scene to edit it
+    PhysicsThread physicsThread;
+
     // Widgets terminal variables
     std::array<char, CONSOLE_BUFFER_SIZE> consoleBuffer = {};
 
@@ -54,7 +79,10 @@ public:
 
     ~PhysicalEngineLauncher();
 
-    void start();
+    /// <summary>
+    /// Lance la boucle de jeu, avec la scène du fichier scenePath (SceneLoader) ou sinon celle de Game
+    /// </summary>
+    void start(const char* scenePath = nullptr);
 
 private:
     void handleEvents();
@@ -21,3 +21,13 @@ void RigidbodyContact::resolveSpeed() {
 
 void RigidbodyContact::resolveInterpenetration() {
 }
+
+void RigidbodyContact::addPoint(const Vector3d& point, real interpenetration) {
+    if (m_pointCount >= MAX_POINTS)
+    {
+        return;
+    }
+    m_points[m_pointCount] = point;
+    m_interpenetration[m_pointCount] = interpenetration;
+    m_pointCount++;
+}
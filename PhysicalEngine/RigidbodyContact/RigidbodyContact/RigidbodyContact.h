@@ -2,16 +2,23 @@
 #define RIGIDBODYCONTACT_H
 
 #include "../../Scene/Components/PhysicalComponent/Rigidbody/Rigidbody.h"
-#include <vector>
+
 class RigidbodyContact {
+public:
+    /// <summary>
+    /// Nombre maximum de points de contact (les 8 sommets d'un pavé), stockés sans allocation
+    /// </summary>
+    static constexpr unsigned MAX_POINTS = 8;
+
 protected:
     Rigidbody* m_rigidbodies[2];
 
     //    Vector3d m_contactNormal;
 
 public:
-    std::vector<Vector3d> m_points;
-    std::vector<float> m_interpenetration;
+    Vector3d m_points[MAX_POINTS];
+    real m_interpenetration[MAX_POINTS] = {};
+    unsigned m_pointCount = 0;
     Vector3d m_normal;
 
     RigidbodyContact(Rigidbody* rb1);
@@ -20,6 +27,11 @@ public:
 
     void resolveContact();
 
+    /// <summary>
+    /// Ajoute un point de contact, ignoré si les MAX_POINTS emplacements sont déjà utilisés
+    /// </summary>
+    void addPoint(const Vector3d& point, real interpenetration);
+
 private:
     void updateAttributes();
 
@@ -29,13 +41,13 @@ private:
 
 
 public:
-    friend std::ostream& operator<<(std::ostream& stream, const RigidbodyContact contactInfo) {
+    friend std::ostream& operator<<(std::ostream& stream, const RigidbodyContact& contactInfo) {
         Vector3d n = contactInfo.m_normal;
             stream << "  -normal: "
                       << "(" << n.getx() << "," << n.gety() << "," << n.getz() << ")" << std::endl;
-            for (int i = 0; i < contactInfo.m_points.size(); i++) {
+            for (unsigned i = 0; i < contactInfo.m_pointCount; i++) {
                 Vector3d pContact = contactInfo.m_points[i];
-                float interp = contactInfo.m_interpenetration[i];
+                real interp = contactInfo.m_interpenetration[i];
 
                 stream << "  Point " << (i + 1) << " : "
                           << "(" << pContact.getx() << "," << pContact.gety() << "," << pContact.getz() << ")" << std::endl;
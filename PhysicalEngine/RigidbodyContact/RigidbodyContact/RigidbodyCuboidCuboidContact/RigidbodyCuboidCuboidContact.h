@@ -8,7 +8,7 @@ class RigidbodyCuboidCuboidContact : RigidbodyContact{
 
 	public: 
 		std::vector<Vector3d> points;
-        std::vector<float> Interpenetration;
+        std::vector<real> Interpenetration;
         Vector3d normal;
 
 		RigidbodyCuboidCuboidContact(Rigidbody* rb1, Rigidbody* rb2) : RigidbodyContact(rb1,rb2) {
@@ -41,8 +41,9 @@ void RigidbodyContactGeneratorRegistry::calculateContactSphere(RigidbodySphereCo
         Vector3d position2 = otherSphereCollider->getGameObject()->transform.getPosition();
         if (pow(position1.distance(position2), 2) < (rsc->getRadius() + otherSphereCollider->getRadius()))
         {
-            
+#ifdef PHYSICALENGINE_LOG_CONTACTS
             std::cout << "Sphere to sphere contact between " << rsc->getGameObject()->getName() << " and " << otherSphereCollider->getGameObject()->getName() << std::endl;
+#endif
         }
         break;                
     }
@@ -55,18 +56,19 @@ void RigidbodyContactGeneratorRegistry::calculateContactSphere(RigidbodySphereCo
             return;
         }
         RigidbodyContact contactInfo(rigid);
-        float distance = distanceToPlane(rsc->getGameObject()->transform.getPosition(),planeCollider);
+        real distance = distanceToPlane(rsc->getGameObject()->transform.getPosition(),planeCollider);
         
         if (distance <= rsc->getRadius())
         {
             Vector3d normal = planeCollider->getNormalVector().normalize();
             Vector3d pointContact = rsc->getGameObject()->transform.getPosition() - (planeCollider->getNormalVector() * rsc->getRadius());
-            float interpenetration = rsc->getRadius() -distance;
+            real interpenetration = rsc->getRadius() -distance;
             contactInfo.m_normal = normal;
-            contactInfo.m_points.push_back(pointContact);
-            contactInfo.m_interpenetration.push_back(interpenetration);
+            contactInfo.addPoint(pointContact, interpenetration);
+#ifdef PHYSICALENGINE_LOG_CONTACTS
             std::cout << "Contact sphere plan " <<std::endl;
             std::cout << contactInfo << std::endl;
+#endif
             rigid->stop();
 
         }
@@ -91,7 +93,7 @@ void RigidbodyContactGeneratorRegistry::calculateContactCuboid(RigidbodyCuboidRe
         auto* planeCollider = dynamic_cast<RigidbodyPlaneCollider*>(other);
         Vector3d points[8];
         rcrc->getAllPoints(points);
-        Matrix34 transformMatrix = rcrc->getGameObject()->transform.getMatrix();
+        const Matrix34& transformMatrix = rcrc->getGameObject()->transform.getMatrix();
         bool collision = false;
         Rigidbody* rigid = nullptr;
         rcrc->getGameObject()->getComponentByClass(rigid);
@@ -102,16 +104,15 @@ void RigidbodyContactGeneratorRegistry::calculateContactCuboid(RigidbodyCuboidRe
         for (int i = 0; i < 8; i++)
         {
             points[i] = transformMatrix.transformPosition(points[i]);
-            float distance = distanceToPlane(points[i], planeCollider);
+            real distance = distanceToPlane(points[i], planeCollider);
             if (distance < 0)
             {
-                float interpenetration = std::abs(distance);
+                real interpenetration = std::abs(distance);
                 Vector3d normal = planeCollider->getNormalVector().normalize();
                 Vector3d pointContact = points[i];
                 collision = true;
-                contactInfo.m_points.push_back(pointContact);
+                contactInfo.addPoint(pointContact, interpenetration);
                 contactInfo.m_normal = normal;
-                contactInfo.m_interpenetration.push_back(interpenetration);
             }
         }
         if (collision)
@@ -123,8 +124,10 @@ void RigidbodyContactGeneratorRegistry::calculateContactCuboid(RigidbodyCuboidRe
             {
                 rigid->stop();
             }
+#ifdef PHYSICALENGINE_LOG_CONTACTS
             std::cout << "Collision box plane:" << std::endl;
             std::cout << contactInfo << std::endl;
+#endif
         }
     }
     case RIGIDBODY_PRIMITIVE_COLLIDER_TYPE_BOX: {
@@ -158,6 +161,6 @@ void RigidbodyContactGeneratorRegistry::calculateContactPlane(RigidbodyPlaneColl
     }
 }
 
-float RigidbodyContactGeneratorRegistry::distanceToPlane(Vector3d point, RigidbodyPlaneCollider* plane) {
+real RigidbodyContactGeneratorRegistry::distanceToPlane(Vector3d point, RigidbodyPlaneCollider* plane) {
     return point.dot(plane->getNormalVector().normalize()) - plane->getCenter().dot(plane->getNormalVector().normalize());
 }
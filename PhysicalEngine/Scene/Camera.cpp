@@ -1,6 +1,6 @@
 #include "Camera.h"
 
-#include "../InputManager.h"
+#include "glad/glad.h"
 
 Camera::Camera() {
 }
@@ -23,6 +23,14 @@ void Camera::moveRight() {
     cameraPosMovementBuffer += glm::normalize(glm::cross(cameraFront, cameraUp)) * cameraMoveSpeed;
 }
 
+void Camera::moveUp() {
+    cameraPosMovementBuffer += cameraMoveSpeed * cameraUp;
+}
+
+void Camera::moveDown() {
+    cameraPosMovementBuffer -= cameraMoveSpeed * cameraUp;
+}
+
 void Camera::processMouseMovement(float xOffset, float yOffset) {
     xOffset *= cameraSensitivity;
     yOffset *= cameraSensitivity;
@@ -52,33 +60,36 @@ glm::mat4 Camera::getViewMatrix() const {
     return glm::lookAt(cameraPos, cameraPos + cameraFront, cameraUp);
 }
 
+glm::mat4 Camera::getProjectionMatrix(float aspectRatio) const {
+    return glm::perspective(glm::radians(fov / 2), aspectRatio, 0.1f, 100.0f);
+}
 
-void Camera::update(float deltaTime) {
-    if (InputManager::isForwardKeyPressed())
-    {
-        moveForward();
-    }
-    if (InputManager::isBackwardKeyPressed())
-    {
-        moveBackward();
-    }
-    if (InputManager::isLeftKeyPressed())
-    {
-        moveLeft();
-    }
-    if (InputManager::isRightKeyPressed())
-    {
-        moveRight();
-    }
-    if (InputManager::isUpKeyPressed())
-    {
-        cameraPosMovementBuffer += cameraMoveSpeed * cameraUp;
-    }
-    if (InputManager::isDownKeyPressed())
-    {
-        cameraPosMovementBuffer -= cameraMoveSpeed * cameraUp;
-    }
+void Camera::createUniformBuffer() {
+    destroyUniformBuffer();
+    glGenBuffers(1, &uniformBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, uniformBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, 2 * sizeof(glm::mat4), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, CAMERA_UNIFORM_BINDING, uniformBuffer);
+}
 
+void Camera::destroyUniformBuffer() {
+    if (uniformBuffer == 0)
+        return;
+    glDeleteBuffers(1, &uniformBuffer);
+    uniformBuffer = 0;
+}
+
+void Camera::updateUniformBuffer(float aspectRatio) {
+    // std140 layout: two column major mat4 one after the other
+    glm::mat4 matrices[2] = { getViewMatrix(), getProjectionMatrix(aspectRatio) };
+    glBindBuffer(GL_UNIFORM_BUFFER, uniformBuffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(matrices), matrices);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+
+void Camera::update(float deltaTime) {
     cameraPosMovementBuffer += scrollOffset * cameraMoveSpeed * cameraUp;
 
     // Update camera position and rotation
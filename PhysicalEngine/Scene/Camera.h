@@ -7,7 +7,14 @@
 
 #include "../Utility/Vector3d.h"
 
+// Binding point of the "Camera" uniform block (view then projection) shared by the shaders
+#define CAMERA_UNIFORM_BINDING 0
+
 class Camera {
+private:
+    // Uniform buffer of the view and projection matrices, written once per frame
+    unsigned int uniformBuffer = 0;
+
 public:
     const float fov = 90.0f; // In degrees
 
@@ -45,12 +52,35 @@ public:
 
     void moveRight();
 
+    void moveUp();
+
+    void moveDown();
+
     void processMouseMovement(float xOffset, float yOffset);
 
     glm::mat4 getViewMatrix() const;
 
     float getFov() const;
 
+    glm::mat4 getProjectionMatrix(float aspectRatio) const;
+
+    /// <summary>
+    /// Crée le uniform buffer de la caméra et le relie au point CAMERA_UNIFORM_BINDING, à appeler avec un contexte
+    /// OpenGL
+    /// </summary>
+    void createUniformBuffer();
+
+    void destroyUniformBuffer();
+
+    /// <summary>
+    /// Écrit les matrices view et projection dans le uniform buffer, une seule fois par frame pour tous les shaders
+    /// qui déclarent le bloc "Camera"
+    /// </summary>
+    void updateUniformBuffer(float aspectRatio);
+
+    /// <summary>
+    /// Applique les déplacements accumulés (clavier, souris, molette) puis vide les buffers
+    /// </summary>
     void update(float deltaTime);
 
     void setScrollOffset(float offset);
@@ -1,18 +1,23 @@
 #include "ParticleCollider.h"
 #include "../../../GameObject.h"
 #include "../../PhysicalComponent/Particle/Particle.h"
+#include "../../../../Utility/imGuiUtility.h"
 #include <imgui/imgui.h>
 
-ParticleCollider::ParticleCollider(GameObject* gameObject, float radius) : Component(gameObject) {
+ParticleCollider::ParticleCollider(GameObject* gameObject, real radius) : Component(gameObject) {
     m_radius = radius;
     //    m_particle = nullptr;
     //    gameObject->getComponentByClass(m_particle);
 }
 
-float ParticleCollider::getRadius() const {
+real ParticleCollider::getRadius() const {
     return m_radius;
 }
 
+void ParticleCollider::setRadius(real radius) {
+    m_radius = radius;
+}
+
 // Particle* ParticleCollider::getParticle() {
 //     return m_particle;
 // }
@@ -26,5 +31,5 @@ void ParticleCollider::update(float time) {
 
 void ParticleCollider::drawGui() {
     ImGui::Text("Particle Collider");
-    ImGui::DragFloat("Radius", &m_radius, 0.1f, 0.0f, 100.0f);
+    ImGuiUtility::DragReal("Radius", &m_radius, 0.1f, 0.0f, 100.0f);
 }
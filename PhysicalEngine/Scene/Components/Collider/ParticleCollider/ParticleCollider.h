@@ -1,6 +1,7 @@
 #ifndef PARTICLE_COLLIDER_H
 #define PARTICLE_COLLIDER_H
 
+#include "../../../../Utility/Precision.h"
 #include "../../Component.h"
 
 class Particle;
@@ -10,15 +11,17 @@ class Particle;
 class ParticleCollider : public Component {
 private:
     static constexpr const char* COMPONENT_TYPE = PARTICLE_COLLIDER_COMPONENT;
-    float m_radius;
+    real m_radius;
     //    Particle* m_particle;
 
 public:
-    ParticleCollider(GameObject* gameObject, float radius = 1);
+    ParticleCollider(GameObject* gameObject, real radius = 1);
 
 #pragma region Getter setter
 
-    float getRadius() const;
+    real getRadius() const;
+
+    void setRadius(real radius);
 
     //    Particle* getParticle();
 
@@ -1,8 +1,9 @@
 #include "RigidbodyCuboidRectangleCollider.h"
+#include "../../../../../Utility/imGuiUtility.h"
 
 #include <imgui/imgui.h>
 
-RigidbodyCuboidRectangleCollider::RigidbodyCuboidRectangleCollider(GameObject* gameObject, float width, float height, float depth) : RigidbodyPrimitiveCollider(gameObject) {
+RigidbodyCuboidRectangleCollider::RigidbodyCuboidRectangleCollider(GameObject* gameObject, real width, real height, real depth) : RigidbodyPrimitiveCollider(gameObject) {
     m_halfwidth = width;
     m_halfheight = height;
     m_halfdepth = depth;
@@ -11,13 +12,13 @@ RigidbodyCuboidRectangleCollider::RigidbodyCuboidRectangleCollider(GameObject* g
 void RigidbodyCuboidRectangleCollider::drawGui() {
     ImGui::Text("Width  :");
     ImGui::SameLine();
-    ImGui::DragFloat("##Width", &m_halfwidth, 0.1f, 0.0f, 0.0f, "%.1f");
+    ImGuiUtility::DragReal("##Width", &m_halfwidth, 0.1f, 0.0f, 0.0f, "%.1f");
     ImGui::Text("Height :");
     ImGui::SameLine();
-    ImGui::DragFloat("##Height", &m_halfheight, 0.1f, 0.0f, 0.0f, "%.1f");
+    ImGuiUtility::DragReal("##Height", &m_halfheight, 0.1f, 0.0f, 0.0f, "%.1f");
     ImGui::Text("Depth  :");
     ImGui::SameLine();
-    ImGui::DragFloat("##Depth", &m_halfdepth, 0.1f, 0.0f, 0.0f, "%.1f");
+    ImGuiUtility::DragReal("##Depth", &m_halfdepth, 0.1f, 0.0f, 0.0f, "%.1f");
 }
 
 std::string RigidbodyCuboidRectangleCollider::getName() const {
@@ -49,6 +50,6 @@ void RigidbodyCuboidRectangleCollider::getAllPoints(Vector3d points[8]) {
 void RigidbodyCuboidRectangleCollider::update(float time) {
 }
 
-float RigidbodyCuboidRectangleCollider::getRadius() const {
+real RigidbodyCuboidRectangleCollider::getRadius() const {
     return sqrt(m_halfwidth * m_halfwidth + m_halfheight * m_halfheight + m_halfdepth * m_halfdepth);
 }
@@ -5,11 +5,11 @@
 
 class RigidbodyCuboidRectangleCollider : public RigidbodyPrimitiveCollider {
 public:
-    float m_halfwidth = 0;
-    float m_halfheight = 0;
-    float m_halfdepth = 0;
+    real m_halfwidth = 0;
+    real m_halfheight = 0;
+    real m_halfdepth = 0;
 
-    RigidbodyCuboidRectangleCollider(GameObject* gameObject, float width, float height, float depth);
+    RigidbodyCuboidRectangleCollider(GameObject* gameObject, real width, real height, real depth);
 
     void drawGui() override;
 
@@ -23,7 +23,7 @@ public:
 
     void update(float time) override;
 
-    float getRadius() const override;
+    real getRadius() const override;
 
 private:
     static constexpr const char* COMPONENT_TYPE = RIGIDBODY_CUBOID_RECTANGLE_COLLIDER;
@@ -2,17 +2,18 @@
 #include "../../../../../Utility/Matrix33.h"
 #include "../../../../GameObject.h"
 #include "../../../Transform/Transform.h"
+#include "../../../../../Utility/imGuiUtility.h"
 
 #include <imgui/imgui.h>
 
-RigidbodyPlaneCollider::RigidbodyPlaneCollider(GameObject* gameObject, float width, float depth) : RigidbodyPrimitiveCollider(gameObject) {
+RigidbodyPlaneCollider::RigidbodyPlaneCollider(GameObject* gameObject, real width, real depth) : RigidbodyPrimitiveCollider(gameObject) {
     m_width = width;
     m_depth = depth;
 }
 
 void RigidbodyPlaneCollider::drawGui() {
-    ImGui::DragFloat("Width", &m_width, 0.1f, 0.0f, 100.0f);
-    ImGui::DragFloat("Depth", &m_depth, 0.1f, 0.0f, 100.0f);
+    ImGuiUtility::DragReal("Width", &m_width, 0.1f, 0.0f, 100.0f);
+    ImGuiUtility::DragReal("Depth", &m_depth, 0.1f, 0.0f, 100.0f);
 }
 
 std::string RigidbodyPlaneCollider::getName() const {
@@ -25,27 +26,27 @@ RigidbodyPrimitiveColliderType RigidbodyPlaneCollider::getColliderType() const {
 
 Vector3d RigidbodyPlaneCollider::getNormalVector() const {
     Matrix33 rotationMatrix;
-    rotationMatrix.setOrientation(m_gameObject->transform.rotation);
+    rotationMatrix.setOrientation(m_gameObject->transform.getRotation());
     return rotationMatrix * Vector3d(0, 1, 0);
 }
 void RigidbodyPlaneCollider::update(float time) {
 }
 
-float RigidbodyPlaneCollider::getRadius() const {
+real RigidbodyPlaneCollider::getRadius() const {
     return sqrt(m_width * m_width + m_depth * m_depth) / 2;
 }
 
-float RigidbodyPlaneCollider::getWidth() const {
+real RigidbodyPlaneCollider::getWidth() const {
     return m_width;
 }
 
-void RigidbodyPlaneCollider::setWidth(float width) {
+void RigidbodyPlaneCollider::setWidth(real width) {
     m_width = width;
 }
-float RigidbodyPlaneCollider::getDepth() const {
+real RigidbodyPlaneCollider::getDepth() const {
     return m_depth;
 }
 
-void RigidbodyPlaneCollider::setDepth(float depth) {
+void RigidbodyPlaneCollider::setDepth(real depth) {
     m_depth = depth;
 }
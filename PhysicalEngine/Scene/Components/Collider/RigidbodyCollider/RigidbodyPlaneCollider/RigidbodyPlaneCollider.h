@@ -5,11 +5,11 @@
 
 class RigidbodyPlaneCollider : public RigidbodyPrimitiveCollider {
 private:
-    float m_width;
-    float m_depth;
+    real m_width;
+    real m_depth;
 
 public:
-    explicit RigidbodyPlaneCollider(GameObject* gameObject, float width = 1, float depth = 1);
+    explicit RigidbodyPlaneCollider(GameObject* gameObject, real width = 1, real depth = 1);
 
     void drawGui() override;
 
@@ -21,7 +21,7 @@ public:
 
     void update(float time) override;
 
-    float getRadius() const override;
+    real getRadius() const override;
 
 private:
     static constexpr const char* COMPONENT_TYPE = RIGIDBODY_PLANE_COLLIDER;
@@ -29,13 +29,13 @@ private:
     static constexpr const RigidbodyPrimitiveColliderType COLLIDER_TYPE = RIGIDBODY_PRIMITIVE_COLLIDER_TYPE_PLANE;
 
 public:
-    float getWidth() const;
+    real getWidth() const;
 
-    void setWidth(float width);
+    void setWidth(real width);
 
-    float getDepth() const;
+    real getDepth() const;
 
-    void setDepth(float depth);
+    void setDepth(real depth);
 };
 
 
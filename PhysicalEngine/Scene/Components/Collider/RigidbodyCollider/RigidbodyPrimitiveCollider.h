@@ -38,7 +38,7 @@ public:
 
     virtual Vector3d getNormalVector() const = 0;
 
-    virtual float getRadius() const = 0;
+    virtual real getRadius() const = 0;
 
     Vector3d getCenter();
 
@@ -1,8 +1,9 @@
 #include "RigidbodySphereCollider.h"
+#include "../../../../../Utility/imGuiUtility.h"
 
 #include "imgui/imgui.h"
 
-RigidbodySphereCollider::RigidbodySphereCollider(GameObject* gameObject, float radius) : RigidbodyPrimitiveCollider(gameObject) {
+RigidbodySphereCollider::RigidbodySphereCollider(GameObject* gameObject, real radius) : RigidbodyPrimitiveCollider(gameObject) {
     m_gameObject = gameObject;
     m_radius = radius;
 }
@@ -10,14 +11,14 @@ RigidbodySphereCollider::RigidbodySphereCollider(GameObject* gameObject, float r
 void RigidbodySphereCollider::drawGui() {
     ImGui::Text("Radius:");
     ImGui::SameLine();
-    ImGui::DragFloat("##Radius", &m_radius, 0.1f, 0.0f, 0.0f, "%.1f");
+    ImGuiUtility::DragReal("##Radius", &m_radius, 0.1f, 0.0f, 0.0f, "%.1f");
 }
 
 std::string RigidbodySphereCollider::getName() const {
     return this->COMPONENT_TYPE;
 }
 
-float RigidbodySphereCollider::getRadius() const {
+real RigidbodySphereCollider::getRadius() const {
     return m_radius;
 }
 
@@ -5,9 +5,9 @@
 
 class RigidbodySphereCollider : public RigidbodyPrimitiveCollider {
 public:
-    float m_radius = 0;
+    real m_radius = 0;
 
-    RigidbodySphereCollider(GameObject* gameObject, float radius);
+    RigidbodySphereCollider(GameObject* gameObject, real radius);
 
     void drawGui() override;
 
@@ -25,7 +25,7 @@ private:
     static constexpr const RigidbodyPrimitiveColliderType COLLIDER_TYPE = RIGIDBODY_PRIMITIVE_COLLIDER_TYPE_SPHERE;
 
 public:
-    float getRadius() const override;
+    real getRadius() const override;
 };
 
 
@@ -17,9 +17,11 @@ protected:
 public:
     CuboidRectangle(float width = 1, float height = 1, float length = 1);
 
-    Matrix33 getInertiaTensor(float mass) const override;
+    Matrix33 getInertiaTensor(real mass) const override;
 
     const char* getMeshType() const;
+
+    Vector3d getDimensions() const override;
 };
 
 #endif // !CUBOID_RECTANGLE_H
@@ -9,12 +9,25 @@ Cylinder::Cylinder(float radius, float height, int rings) {
     this->radius = radius;
     this->height = height;
 
-    generatePointsNormales(radius, height, rings);
-    generateTriangles(radius, height, rings);
+    geometry = getLevelGeometry(radius, height, rings);
 
     color = glm::vec4(0.0f, 0.5f, 1.0f, 1.0f);
 }
 
+std::shared_ptr<MeshGeometry> Cylinder::getLevelGeometry(float radius, float height, int rings) {
+    return MeshCache::getGeometry(MESH_TYPE, { radius, height, static_cast<float>(rings) },
+                                  [&](MeshGeometry& newGeometry) {
+                                      generatePointsNormales(newGeometry, radius, height, rings);
+                                      generateTriangles(newGeometry, rings);
+                                      if (rings / 2 >= LOD_MIN_SEGMENTS)
+                                      {
+                                          newGeometry.lowerDetail = getLevelGeometry(radius, height, rings / 2);
+                                          newGeometry.lodScreenSize = LOD_PIXELS_PER_SEGMENT * rings /
+                                                                      (2 * static_cast<float>(M_PI));
+                                      }
+                                  });
+}
+
 // Cylinder::Cylinder(float radius, float height) {
 //     this->radius = radius;
 //     this->height = height;
@@ -72,27 +85,31 @@ Cylinder::Cylinder(float radius, float height, int rings) {
 // }
 
 
-Matrix33 Cylinder::getInertiaTensor(float mass) const {
+Matrix33 Cylinder::getInertiaTensor(real mass) const {
     auto r2 = std::pow(radius, 2);
     auto h2 = std::pow(height, 2);
 
-    float Ixx = (1.0F / 12.0F) * mass * h2 + (1.0F / 4.0F) * mass * r2;
-    float Iyy = (1.0F / 2.0F) * mass * r2;
-    float Izz = (1.0F / 12.0F) * mass * h2 + (1.0F / 4.0F) * mass * r2;
+    real Ixx = (1.0F / 12.0F) * mass * h2 + (1.0F / 4.0F) * mass * r2;
+    real Iyy = (1.0F / 2.0F) * mass * r2;
+    real Izz = (1.0F / 12.0F) * mass * h2 + (1.0F / 4.0F) * mass * r2;
 
-    float values[9] = { Ixx, 0.0f, 0.0f,
+    real values[9] = { Ixx, 0.0f, 0.0f,
         0.0f, Iyy, 0.0f,
         0.0f, 0.0f, Izz };
 
     return Matrix33(values);
 }
-void Cylinder::generatePointsNormales(float radius, float height, int rings) {
+void Cylinder::generatePointsNormales(MeshGeometry& geometry, float radius, float height, int rings) {
+    std::vector<float>& vertices = geometry.vertices;
+    std::vector<float>& normals = geometry.normals;
 
     float r2 = radius / 2;
     float h2 = height / 2;
 
     float step = 2 * M_PI / rings;
     float angle = 0;
+    vertices.reserve(6 * rings + 6);
+    normals.reserve(6 * rings + 6);
     for (int i = 0; i < rings; i++)
     {
         float x = r2 * std::cos(angle);
@@ -105,10 +122,19 @@ void Cylinder::generatePointsNormales(float radius, float height, int rings) {
         vertices.push_back(y);
         angle += step;
     }
+    // Centers of the top and bottom caps
+    vertices.push_back(0);
+    vertices.push_back(h2);
+    vertices.push_back(0);
+    vertices.push_back(0);
+    vertices.push_back(-h2);
+    vertices.push_back(0);
     for (auto& normalized : vertices)
         normals.push_back(normalized / r2);
 }
-void Cylinder::generateTriangles(float radius, float height, int rings) {
+void Cylinder::generateTriangles(MeshGeometry& geometry, int rings) {
+    std::vector<unsigned int>& indices = geometry.indices;
+    indices.reserve(12 * rings);
 
     for (int i = 0; i < rings; i++)
     {
@@ -124,7 +150,7 @@ void Cylinder::generateTriangles(float radius, float height, int rings) {
     {
         int next = (i + 1) % rings;
         indices.push_back(i * 2);
-        indices.push_back(i * 2 + 1);
+        indices.push_back(next * 2);
         indices.push_back(rings * 2);
         indices.push_back(i * 2 + 1);
         indices.push_back(next * 2 + 1);
@@ -134,3 +160,7 @@ void Cylinder::generateTriangles(float radius, float height, int rings) {
 const char* Cylinder::getMeshType() const {
     return MESH_TYPE;
 }
+
+Vector3d Cylinder::getDimensions() const {
+    return { radius, height, 0 };
+}
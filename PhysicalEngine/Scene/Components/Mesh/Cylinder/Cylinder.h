@@ -17,12 +17,17 @@ public:
     //    Cylinder(float radius, float height);
     Cylinder(float radius = 1, float height = 1, int rings = 16);
 
-    void generatePointsNormales(float radius, float height, int rings);
-    void generateTriangles(float radius, float height, int rings);
+    static void generatePointsNormales(MeshGeometry& geometry, float radius, float height, int rings);
+    static void generateTriangles(MeshGeometry& geometry, int rings);
 
-    Matrix33 getInertiaTensor(float mass) const override;
+    // Cached geometry, with its coarser levels of detail (half the rings each)
+    static std::shared_ptr<MeshGeometry> getLevelGeometry(float radius, float height, int rings);
+
+    Matrix33 getInertiaTensor(real mass) const override;
 
     const char* getMeshType() const;
+
+    Vector3d getDimensions() const override;
 };
 
 
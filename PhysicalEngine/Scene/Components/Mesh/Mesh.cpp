@@ -15,7 +15,7 @@ const char* Mesh::meshNamesList[3] = { MESHTYPE_CYLINDER, MESHTYPE_SPHERE, MESHT
 
 void Mesh::drawGui() {
     ImGui::Text("Mesh type: %s", getMeshType());
-    ImGui::Text(verticesUseIndices ? "Vertices use indices" : "Vertices don't use indices");
+    ImGui::Text(geometry->verticesUseIndices ? "Vertices use indices" : "Vertices don't use indices");
     ImGui::DragFloat4("Color", &color[0], 0.01f, 0.0f, 1.0f);
     if (ImGui::BeginTable("", 3))
     {
@@ -38,19 +38,26 @@ void Mesh::drawGui() {
 }
 
 const vector<float>& Mesh::getVertices() {
-    return vertices;
+    return geometry->vertices;
 }
 
 const vector<unsigned int>& Mesh::getIndices() {
-    return indices;
+    return geometry->indices;
 }
 
 const vector<float>& Mesh::getNormals() {
-    return normals;
+    return geometry->normals;
 }
 
 const bool& Mesh::getVerticesUseIndices() const {
-    return verticesUseIndices;
+    return geometry->verticesUseIndices;
+}
+
+Mesh::~Mesh() {
+}
+
+MeshGeometry& Mesh::getGeometry() const {
+    return *geometry;
 }
 
 std::string Mesh::getName() const {
@@ -83,3 +90,7 @@ Mesh* Mesh::createMesh(const char* meshType) {
 const char* Mesh::getMeshType() const {
     return MESH_TYPE;
 }
+
+Vector3d Mesh::getDimensions() const {
+    return { 0, 0, 0 };
+}
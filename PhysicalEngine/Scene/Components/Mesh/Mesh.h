@@ -5,14 +5,22 @@
 #include "../../../Utility/Vector3d.h"
 #include "../Component.h"
 #include "../DefaultComponent.h"
+#include "MeshCache.h"
 #include "glm/vec4.hpp"
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include <string>
 
 #define MESH_COMPONENT "Mesh"
 
+// Shortest edge, in pixels, of the silhouette of a level of detail before the next coarser level replaces it
+#define LOD_PIXELS_PER_SEGMENT 8.0f
+
+// Coarsest subdivision of the generated levels of detail
+#define LOD_MIN_SEGMENTS 4
+
 class Mesh : private DefaultComponent {
 private:
     static constexpr const char* COMPONENT_TYPE = MESH_COMPONENT;
@@ -24,14 +32,15 @@ public:
     static const char* meshNamesList[3];
 
 protected:
-    std::vector<float> vertices;
-    std::vector<unsigned int> indices;
-    std::vector<float> normals;
-    bool verticesUseIndices = true;
+    // Vertices, indices and normals, shared with the meshes of same type and dimensions through MeshCache
+    std::shared_ptr<MeshGeometry> geometry;
 
     glm::vec4 color = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
 
 public:
+    // Deleted through Mesh * by GameObject, the shared geometry is released with the derived mesh
+    virtual ~Mesh();
+
     void drawGui() override;
 
 #pragma region Getter
@@ -44,9 +53,11 @@ public:
 
     const bool& getVerticesUseIndices() const;
 
+    MeshGeometry& getGeometry() const;
+
     std::string getName() const override;
 
-    virtual Matrix33 getInertiaTensor(float mass) const = 0;
+    virtual Matrix33 getInertiaTensor(real mass) const = 0;
 
     glm::vec4 getColor() const;
 
@@ -56,6 +67,11 @@ public:
 
     virtual const char* getMeshType() const;
 
+    /// <summary>
+    /// Dimensions passées au constructeur du maillage (rayon, hauteur, ...), utilisées par les snapshots de scène
+    /// </summary>
+    virtual Vector3d getDimensions() const;
+
 #pragma endregion
 };
 
@@ -0,0 +1,89 @@
+#include "MeshCache.h"
+
+#include "../../../Utility/Hash.h"
+#include "glad/glad.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+std::unordered_map<MeshCache::Key, std::weak_ptr<MeshGeometry>, MeshCache::KeyHash> MeshCache::entries;
+
+MeshGeometry::~MeshGeometry() {
+    // The last object using the geometry is gone, its buffers are released with it
+    if (VAO != 0)
+        glDeleteVertexArrays(1, &VAO);
+    if (VBO != 0)
+        glDeleteBuffers(1, &VBO);
+    if (EBO != 0)
+        glDeleteBuffers(1, &EBO);
+}
+
+bool MeshGeometry::hasBuffers() const {
+    return VAO != 0;
+}
+
+std::size_t MeshGeometry::getByteSize() const {
+    return vertices.size() * sizeof(float) + indices.size() * sizeof(unsigned int) + normals.size() * sizeof(float);
+}
+
+void MeshGeometry::computeBoundingRadius() {
+    float squaredRadius = 0;
+    for (std::size_t i = 0; i + 2 < vertices.size(); i += 3) {
+        squaredRadius = std::max(squaredRadius, vertices[i] * vertices[i] + vertices[i + 1] * vertices[i + 1] +
+                                                        vertices[i + 2] * vertices[i + 2]);
+    }
+    boundingRadius = std::sqrt(squaredRadius);
+}
+
+MeshGeometry *MeshGeometry::selectLevel(float screenSize) {
+    MeshGeometry *level = this;
+    while (level->lowerDetail != nullptr && screenSize < level->lodScreenSize && level->lowerDetail->hasBuffers()) {
+        level = level->lowerDetail.get();
+    }
+    return level;
+}
+
+std::size_t MeshGeometry::getVertexCount() const {
+    return verticesUseIndices ? indices.size() : vertices.size() / 3;
+}
+
+bool MeshCache::Key::operator==(const Key &other) const {
+    return std::strcmp(meshType, other.meshType) == 0 &&
+           std::memcmp(parameters, other.parameters, sizeof(parameters)) == 0;
+}
+
+std::size_t MeshCache::KeyHash::operator()(const Key &key) const {
+    std::uint64_t hash = Hash::fnv1a(key.meshType, std::strlen(key.meshType));
+    return static_cast<std::size_t>(Hash::fnv1a(key.parameters, sizeof(key.parameters), hash));
+}
+
+void MeshCache::GeometryDeleter::operator()(MeshGeometry *geometry) const {
+    // A geometry of the same key created since then keeps its entry
+    auto it = entries.find(key);
+    if (it != entries.end() && it->second.expired())
+        entries.erase(it);
+    delete geometry;
+}
+
+std::size_t MeshCache::getGeometryCount() {
+    std::size_t count = 0;
+    for (const auto &entry: entries) {
+        if (!entry.second.expired())
+            count++;
+    }
+    return count;
+}
+
+std::size_t MeshCache::getGeometryBytes() {
+    std::size_t bytes = 0;
+    for (const auto &entry: entries) {
+        if (std::shared_ptr<MeshGeometry> geometry = entry.second.lock())
+            bytes += geometry->getByteSize();
+    }
+    return bytes;
+}
+
+std::size_t MeshCache::getEntryCount() {
+    return entries.size();
+}
@@ -0,0 +1,122 @@
+#ifndef MESHCACHE_H
+#define MESHCACHE_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// Géométrie d'un maillage, partagée par tous les Mesh de même type et de mêmes paramètres
+/// </summary>
+struct MeshGeometry {
+    std::vector<float> vertices;
+    std::vector<unsigned int> indices;
+    std::vector<float> normals;
+    bool verticesUseIndices = true;
+
+    // Radius of the sphere centered on the origin of the mesh holding all its vertices, used to cull the objects
+    float boundingRadius = 0;
+
+    // Coarser tessellation of the same mesh (itself cached), drawn instead of this one for an object covering less
+    // than lodScreenSize pixels on screen
+    std::shared_ptr<MeshGeometry> lowerDetail;
+    float lodScreenSize = 0;
+
+    // OpenGL buffers of the geometry, created by the first GameObject drawing it (0 before)
+    unsigned int VAO = 0, VBO = 0, EBO = 0;
+
+    MeshGeometry() = default;
+
+    MeshGeometry(const MeshGeometry &) = delete;
+
+    MeshGeometry &operator=(const MeshGeometry &) = delete;
+
+    ~MeshGeometry();
+
+    bool hasBuffers() const;
+
+    std::size_t getByteSize() const;
+
+    void computeBoundingRadius();
+
+    /// <summary>
+    /// Niveau de détail à dessiner pour un objet couvrant screenSize pixels : le plus grossier de la chaîne
+    /// lowerDetail dont le seuil est encore atteint
+    /// </summary>
+    MeshGeometry *selectLevel(float screenSize);
+
+    std::size_t getVertexCount() const;
+};
+
+/// <summary>
+/// Cache des géométries indexé par le type de maillage et ses paramètres (dimensions, subdivisions) : un maillage
+/// déjà généré est partagé au lieu d'être recalculé, et libéré avec son entrée par le dernier Mesh qui l'utilise
+/// </summary>
+class MeshCache {
+public:
+    static constexpr int MAX_PARAMETERS = 4;
+
+private:
+    struct Key {
+        const char *meshType;
+        float parameters[MAX_PARAMETERS];
+
+        bool operator==(const Key &other) const;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key &key) const;
+    };
+
+    // Deletes the geometry and erases its entry, so that the map only holds the geometries in use
+    struct GeometryDeleter {
+        Key key;
+
+        void operator()(MeshGeometry *geometry) const;
+    };
+
+    static std::unordered_map<Key, std::weak_ptr<MeshGeometry>, KeyHash> entries;
+
+public:
+    /// <summary>
+    /// Géométrie du type et des paramètres donnés, générée par generate(MeshGeometry &) si elle n'est pas en cache
+    /// </summary>
+    template <typename Generator>
+    static std::shared_ptr<MeshGeometry> getGeometry(const char *meshType, std::initializer_list<float> parameters,
+                                                     Generator generate) {
+        Key key{ meshType, {} };
+        std::size_t count = 0;
+        for (float parameter: parameters) {
+            if (count < MAX_PARAMETERS)
+                key.parameters[count++] = parameter;
+        }
+        std::weak_ptr<MeshGeometry> &entry = entries[key];
+        std::shared_ptr<MeshGeometry> geometry = entry.lock();
+        if (geometry == nullptr) {
+            geometry = std::shared_ptr<MeshGeometry>(new MeshGeometry(), GeometryDeleter{ key });
+            generate(*geometry);
+            geometry->computeBoundingRadius();
+            entry = geometry;
+        }
+        return geometry;
+    }
+
+    /// <summary>
+    /// Nombre de géométries encore utilisées par au moins un Mesh
+    /// </summary>
+    static std::size_t getGeometryCount();
+
+    /// <summary>
+    /// Mémoire des sommets, indices et normales de ces géométries
+    /// </summary>
+    static std::size_t getGeometryBytes();
+
+    /// <summary>
+    /// Entrées du cache, égal au nombre de géométries une fois les générations terminées
+    /// </summary>
+    static std::size_t getEntryCount();
+};
+
+#endif // MESHCACHE_H
@@ -4,9 +4,10 @@
 
 #include <math.h>
 
-void Sphere::generatePointsNormales(float radius, int rings, int sectors) {
-    this->radius = radius;
-    verticesUseIndices = true;
+void Sphere::generatePointsNormales(MeshGeometry& geometry, float radius, int rings, int sectors) {
+    std::vector<float>& vertices = geometry.vertices;
+    std::vector<float>& normals = geometry.normals;
+    geometry.verticesUseIndices = true;
     float x, y, z, xy;                           // vertex position
     float nx, ny, nz, lengthInv = 1.0f / radius; // vertex normal
     // float s, t;									 // vertex texture Coordonn�es
@@ -15,6 +16,9 @@ void Sphere::generatePointsNormales(float radius, int rings, int sectors) {
     float ringStep = pi / rings;
     float sectorAngle, ringAngle;
 
+    // Sized once for the whole mesh
+    vertices.reserve(3 * (rings + 1) * (sectors + 1));
+    normals.reserve(3 * (rings + 1) * (sectors + 1));
     for (int i = 0; i <= rings; ++i)
     {
         ringAngle = pi / 2 - i * ringStep;
@@ -22,7 +26,7 @@ void Sphere::generatePointsNormales(float radius, int rings, int sectors) {
         z = radius * sinf(ringAngle);
 
         // ajoute (sectors+1) par rings
-        for (int j = 0; j <= rings; ++j)
+        for (int j = 0; j <= sectors; ++j)
         {
             sectorAngle = j * sectorStep;
 
@@ -50,12 +54,12 @@ void Sphere::generatePointsNormales(float radius, int rings, int sectors) {
             */
         }
     }
-    color = glm::vec4(1.0f, 0.5f, 0.5f, 1.0f);
 }
 
-void Sphere::generateTriangles(float radius, int rings, int sectors) {
-    this->radius = radius;
+void Sphere::generateTriangles(MeshGeometry& geometry, int rings, int sectors) {
+    std::vector<unsigned int>& indices = geometry.indices;
     unsigned int k1, k2;
+    indices.reserve(6 * rings * sectors);
     for (int i = 0; i < rings; ++i)
     {
         k1 = i * (sectors + 1); // d�but du ring actuel
@@ -83,17 +87,34 @@ void Sphere::generateTriangles(float radius, int rings, int sectors) {
     }
 }
 
+std::shared_ptr<MeshGeometry> Sphere::getLevelGeometry(float radius, int rings, int sectors) {
+    return MeshCache::getGeometry(MESH_TYPE, { radius, static_cast<float>(rings), static_cast<float>(sectors) },
+                                  [&](MeshGeometry& newGeometry) {
+                                      generatePointsNormales(newGeometry, radius, rings, sectors);
+                                      generateTriangles(newGeometry, rings, sectors);
+                                      if (rings / 2 >= LOD_MIN_SEGMENTS && sectors / 2 >= LOD_MIN_SEGMENTS)
+                                      {
+                                          // Replaced once the edges of the coarser level get shorter than
+                                          // LOD_PIXELS_PER_SEGMENT around the silhouette
+                                          newGeometry.lowerDetail = getLevelGeometry(radius, rings / 2, sectors / 2);
+                                          newGeometry.lodScreenSize = LOD_PIXELS_PER_SEGMENT * sectors /
+                                                                      (2 * static_cast<float>(M_PI));
+                                      }
+                                  });
+}
+
 Sphere::Sphere(float radius, int rings, int sectors) {
-    generatePointsNormales(radius, rings, sectors);
-    generateTriangles(radius, rings, sectors);
+    this->radius = radius;
+    geometry = getLevelGeometry(radius, rings, sectors);
+    color = glm::vec4(1.0f, 0.5f, 0.5f, 1.0f);
 }
 
-Matrix33 Sphere::getInertiaTensor(float mass) const {
+Matrix33 Sphere::getInertiaTensor(real mass) const {
     auto Ixx = 2.0f / 5.0f * mass * radius * radius;
     auto Iyy = Ixx;
     auto Izz = Ixx;
 
-    float values[9] = { Ixx, 0.0f, 0.0f,
+    real values[9] = { Ixx, 0.0f, 0.0f,
         0.0f, Iyy, 0.0f,
         0.0f, 0.0f, Izz };
 
@@ -102,3 +123,7 @@ Matrix33 Sphere::getInertiaTensor(float mass) const {
 const char* Sphere::getMeshType() const {
     return MESH_TYPE;
 }
+
+Vector3d Sphere::getDimensions() const {
+    return { radius, 0, 0 };
+}
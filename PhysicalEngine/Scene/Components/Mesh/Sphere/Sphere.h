@@ -13,16 +13,21 @@ private:
     float radius;
 
 private:
-    void generatePointsNormales(float radius, int rings, int sectors);
+    static void generatePointsNormales(MeshGeometry& geometry, float radius, int rings, int sectors);
 
-    void generateTriangles(float radius, int rings, int sectors);
+    static void generateTriangles(MeshGeometry& geometry, int rings, int sectors);
+
+    // Cached geometry, with its coarser levels of detail (half the rings and sectors each)
+    static std::shared_ptr<MeshGeometry> getLevelGeometry(float radius, int rings, int sectors);
 
 public:
     Sphere(float radius = 1, int rings = 16, int sectors = 16);
 
-    Matrix33 getInertiaTensor(float mass) const override;
+    Matrix33 getInertiaTensor(real mass) const override;
 
     const char* getMeshType() const;
+
+    Vector3d getDimensions() const override;
 };
 
 #endif // !SPHERE_H
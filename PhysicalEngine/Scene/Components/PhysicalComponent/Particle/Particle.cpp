@@ -11,7 +11,7 @@ Particle::Particle(GameObject* gameObject) : Component(gameObject) {
     m_mass = 1;
 }
 
-Particle::Particle(GameObject* gameObject, float m) : Component(gameObject) {
+Particle::Particle(GameObject* gameObject, real m) : Component(gameObject) {
     linearSpeed = { 0, 0, 0 };
     linearAcceleration = { 0, 0, 0 };
     m_mass = m;
@@ -31,40 +31,8 @@ Particle::~Particle() {
 //    }
 }
 
-void Particle::update(float deltaTime) {
-    // Update sum of forces
-    if (!isKinematic)
-    {
-        gravity.addForce(this);
-
-        for (ForceGenerator* forceGenerator : forceGeneratorsList)
-        {
-            forceGenerator->addForce(this);
-        }
-    }
-
-    // Update acceleration, linearSpeed and position
-    calculateAcceleration();
-    calculateSpeed(deltaTime);
-
-    // Reset the m_forceAccum for the next frame
-    m_forceAccum = Vector3d();
-}
-
-// float Particle::distance(const Particle& p) {
-//     return (m_gameObject->transform.getPosition() - p.getPosition()).norm();
-// }
-
-// void Particle::calculatePosition(float time) {
-//     m_gameObject->transform.setPosition(m_gameObject->transform.getPosition() + linearSpeed * time);
-// }
-
-void Particle::calculateSpeed(float time) {
-    linearSpeed = linearSpeed + linearAcceleration * time;
-}
-
-void Particle::calculateAcceleration() {
-    linearAcceleration = m_forceAccum / m_mass;
+void Particle::update(float) {
+    // Forces, acceleration, speed and position are integrated by the integrator of the scene (PhysicHandler)
 }
 
 void Particle::drawGui() {
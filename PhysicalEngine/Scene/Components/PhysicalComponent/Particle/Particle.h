@@ -21,7 +21,7 @@ public:
     ///  vitesse et acceleration � 0 par default
     /// </summary>
     /// <param name="pos">: la Position</param>
-    Particle(GameObject *gameObject, float m);
+    Particle(GameObject *gameObject, real m);
 
     /// <summary>
     /// Constructeur de copie de Particle
@@ -33,20 +33,6 @@ public:
 
     void update(float deltaTime) override;
 
-
-    /// <summary>
-    /// Calcule la nouvelle vitesse � partir de l'acc�l�ration de la particule
-    /// et du temps en arguement
-    /// </summary>
-    /// <param name="time"></param>
-    void calculateSpeed(float time);
-
-    /// <summary>
-    /// Calcule la nouvelle accélération � partir de la deuxième loi de Newton
-    /// </summary>
-    /// <param name="time"></param>
-    void calculateAcceleration();
-
     void drawGui() override;
 
     std::string getName() const override;
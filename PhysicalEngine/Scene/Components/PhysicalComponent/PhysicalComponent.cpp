@@ -11,7 +11,7 @@ PhysicalComponent::~PhysicalComponent() {
     }
 }
 
-float PhysicalComponent::distance(const PhysicalComponent& p) {
+real PhysicalComponent::distance(const PhysicalComponent& p) {
     return (m_gameObject->transform.getPosition() - p.m_gameObject->transform.getPosition()).norm();
 }
 
@@ -27,7 +27,7 @@ void PhysicalComponent::setNetForce(const Vector3d& force) {
     m_forceAccum = force;
 }
 
-float PhysicalComponent::getMass() const {
+real PhysicalComponent::getMass() const {
     return m_mass;
 }
 
@@ -44,6 +44,52 @@ void PhysicalComponent::setLinearSpeed(const Vector3d& linearSpeed) {
 }
 
 
+PhysicalState PhysicalComponent::getState() const {
+    return PhysicalState{ m_gameObject->transform.getPosition(), linearSpeed, m_gameObject->transform.getRotation(),
+        Vector3d() };
+}
+
+void PhysicalComponent::setState(const PhysicalState& state) {
+    m_gameObject->transform.setPosition(state.position);
+    linearSpeed = state.linearSpeed;
+}
+
+PhysicalDerivative PhysicalComponent::evaluate(const PhysicalState& state) {
+    setState(state);
+    return evaluate();
+}
+
+PhysicalDerivative PhysicalComponent::evaluate() {
+    clearAccumulator();
+    if (!isKinematic)
+    {
+        accumulateForces();
+    }
+    calculateAcceleration();
+    return getDerivative();
+}
+
+void PhysicalComponent::clearAccumulator() {
+    m_forceAccum = Vector3d();
+}
+
+void PhysicalComponent::accumulateForces() {
+    gravity.addForce(this);
+
+    for (ForceGenerator* forceGenerator : forceGeneratorsList)
+    {
+        forceGenerator->addForce(this);
+    }
+}
+
+void PhysicalComponent::calculateAcceleration() {
+    linearAcceleration = m_forceAccum / m_mass;
+}
+
+PhysicalDerivative PhysicalComponent::getDerivative() const {
+    return PhysicalDerivative{ linearSpeed, linearAcceleration, Vector3d(), Vector3d() };
+}
+
 void PhysicalComponent::addForceToList(ForceGenerator* forceGenerator) {
     forceGeneratorsList.push_back(forceGenerator);
 }
@@ -74,7 +120,7 @@ void PhysicalComponent::drawGui() {
 
     // Weight
     ImGui::Text("Weight");
-    ImGui::DragFloat("##PhysicalComponentWeight", &m_mass, 0.1f, 0.0f, 100.0f);
+    ImGuiUtility::DragReal("##PhysicalComponentWeight", &m_mass, 0.1f, 0.0f, 100.0f);
 
     // Gravity
     gravity.drawGui(m_gameObject->getScenePtr());
@@ -88,15 +134,15 @@ void PhysicalComponent::drawGui() {
         ImGui::TableNextColumn();
         ImGui::Text("X:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentlinearSpeedX", &linearSpeed.x);
+        ImGuiUtility::InputReal("##PhysicalComponentlinearSpeedX", &linearSpeed.x);
         ImGui::TableNextColumn();
         ImGui::Text("Y:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentlinearSpeedY", &linearSpeed.y);
+        ImGuiUtility::InputReal("##PhysicalComponentlinearSpeedY", &linearSpeed.y);
         ImGui::TableNextColumn();
         ImGui::Text("Z:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentlinearSpeedZ", &linearSpeed.z);
+        ImGuiUtility::InputReal("##PhysicalComponentlinearSpeedZ", &linearSpeed.z);
         ImGui::EndTable();
     }
     ImGui::Text("Linear Acceleration");
@@ -105,15 +151,15 @@ void PhysicalComponent::drawGui() {
         ImGui::TableNextColumn();
         ImGui::Text("X:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentAccelerationX", &linearAcceleration.x);
+        ImGuiUtility::InputReal("##PhysicalComponentAccelerationX", &linearAcceleration.x);
         ImGui::TableNextColumn();
         ImGui::Text("Y:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentAccelerationY", &linearAcceleration.y);
+        ImGuiUtility::InputReal("##PhysicalComponentAccelerationY", &linearAcceleration.y);
         ImGui::TableNextColumn();
         ImGui::Text("Z:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentAccelerationZ", &linearAcceleration.z);
+        ImGuiUtility::InputReal("##PhysicalComponentAccelerationZ", &linearAcceleration.z);
         ImGui::EndTable();
     }
     ImGui::NewLine();
@@ -187,3 +233,19 @@ void PhysicalComponent::drawGuiForceGenerators() {
 bool PhysicalComponent::getIsKinematic() const {
     return isKinematic;
 }
+
+void PhysicalComponent::setIsKinematic(bool kinematic) {
+    isKinematic = kinematic;
+}
+
+void PhysicalComponent::setMass(real mass) {
+    m_mass = mass;
+}
+
+Gravity& PhysicalComponent::getGravity() {
+    return gravity;
+}
+
+const std::vector<ForceGenerator*>& PhysicalComponent::getForceGenerators() const {
+    return forceGeneratorsList;
+}
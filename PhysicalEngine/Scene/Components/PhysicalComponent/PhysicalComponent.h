@@ -5,6 +5,7 @@
 #include "../../../Force/Gravity.h"
 #include "../../../Utility/Vector3d.h"
 #include "../Component.h"
+#include "PhysicalState.h"
 #include <vector>
 
 class PhysicalComponent : public virtual Component {
@@ -16,7 +17,7 @@ protected:
     bool isKinematic = true;
 
     Vector3d m_forceAccum;
-    float m_mass;
+    real m_mass;
 
     // Velocity and acceleration
     Vector3d linearSpeed;
@@ -26,13 +27,31 @@ protected:
     Gravity gravity;
     std::vector<ForceGenerator*> forceGeneratorsList;
 
+protected:
+    /// <summary>
+    /// Remet à zéro les accumulateurs de forces
+    /// </summary>
+    virtual void clearAccumulator();
+
+    /// <summary>
+    /// Ajoute la gravité et les forces de la liste aux accumulateurs
+    /// </summary>
+    virtual void accumulateForces();
+
+    /// <summary>
+    /// Calcule les accélérations à partir des accumulateurs (deuxième loi de Newton)
+    /// </summary>
+    virtual void calculateAcceleration();
+
+    virtual PhysicalDerivative getDerivative() const;
+
 private:
     static constexpr const char* COMPONENT_TYPE = "PhysicalComponent";
 
 public:
     void update(float time) override = 0;
 
-    float distance(const PhysicalComponent& p);
+    real distance(const PhysicalComponent& p);
 
     Vector3d getPosition() const;
 
@@ -42,7 +61,7 @@ public:
 
     void setNetForce(const Vector3d& force);
 
-    float getMass() const;
+    real getMass() const;
 
     Vector3d getLinearSpeed() const;
 
@@ -56,6 +75,24 @@ public:
 
     virtual void stop() = 0;
 
+    virtual PhysicalState getState() const;
+
+    virtual void setState(const PhysicalState& state);
+
+    /// <summary>
+    /// Place le composant dans l'état donné et évalue les forces pour obtenir la dérivée de l'état,
+    /// utilisé par les intégrateurs du PhysicHandler
+    /// </summary>
+    /// <param name="state"></param>
+    /// <returns></returns>
+    PhysicalDerivative evaluate(const PhysicalState& state);
+
+    /// <summary>
+    /// Evalue les forces dans l'état courant, les intégrateurs placent d'abord tous les composants dans l'état de
+    /// l'étape pour que les forces entre composants (ressorts, ...) lisent des voisins dans la même étape
+    /// </summary>
+    PhysicalDerivative evaluate();
+
     void addForceToList(ForceGenerator* forceGenerator);
 
     void addForceByName(const std::string& forceName);
@@ -100,6 +137,14 @@ public:
     }
 
     bool getIsKinematic() const;
+
+    void setIsKinematic(bool kinematic);
+
+    void setMass(real mass);
+
+    Gravity& getGravity();
+
+    const std::vector<ForceGenerator*>& getForceGenerators() const;
 };
 
 
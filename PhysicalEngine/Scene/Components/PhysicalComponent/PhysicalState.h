@@ -0,0 +1,27 @@
+#ifndef PHYSICALSTATE_H
+#define PHYSICALSTATE_H
+
+#include "../../../Utility/Quaternion.h"
+#include "../../../Utility/Vector3d.h"
+
+/// <summary>
+/// Etat intégré d'un composant physique (position, orientation et leurs vitesses)
+/// </summary>
+struct PhysicalState {
+    Vector3d position;
+    Vector3d linearSpeed;
+    Quaternion orientation;
+    Vector3d angularSpeed;
+};
+
+/// <summary>
+/// Dérivée de l'état évaluée par le composant : vitesses et accélérations
+/// </summary>
+struct PhysicalDerivative {
+    Vector3d linearSpeed;
+    Vector3d linearAcceleration;
+    Vector3d angularSpeed;
+    Vector3d angularAcceleration;
+};
+
+#endif // PHYSICALSTATE_H
@@ -15,10 +15,8 @@ Rigidbody::Rigidbody(GameObject* gameObject) : Component(gameObject) {
     //    m_speed = { 0, 0, 0 };
     //    m_acceleration = { 0, 0, 0 };
     m_mass = 1;
-    m_rotation = { 0, 0, 0 };
     m_inertiaTensor = Matrix33();
-    m_transformMatrix = Matrix34();
-    m_orientation = Quaternion();
+    m_inverseInertiaTensor = Matrix33();
     m_angularSpeed = Vector3d(0, 0, 0);
     m_angularAcceleration = Vector3d(0, 0, 0);
     m_forceAccum = Vector3d(0, 0, 0);
@@ -38,7 +36,7 @@ Rigidbody::~Rigidbody() {
 
 void Rigidbody::addForceAtPoint(const Vector3d& force, const Vector3d worldPoint) {
     m_forceAccum += force;
-    Vector3d point = m_gameObject->transform.getMatrix().inverse().transformPosition(worldPoint);
+    Vector3d point = m_gameObject->transform.getInverseMatrix().transformPosition(worldPoint);
     m_torqueAccum += point.cross(force);
 }
 
@@ -54,62 +52,58 @@ void Rigidbody::clearAccumulator() {
     m_torqueAccum = Vector3d(0, 0, 0);
 }
 
-void Rigidbody::update(float time) {
-    // Update sum of forces
-    if (!isKinematic)
-    {
-        gravity.addForce(this);
+void Rigidbody::update(float) {
+    // Calculate derivatives, the motion itself is integrated by the integrator of the scene (PhysicHandler)
+    calculateDerivedData();
+}
 
-        // Linear forces
-        for (ForceGenerator* forceGenerator : forceGeneratorsList)
-        {
-            forceGenerator->addForce(this);
-        }
+void Rigidbody::accumulateForces() {
+    // Linear forces
+    PhysicalComponent::accumulateForces();
 
-        // Angular forces
-        for (ForcePoint& forcePoint : pointForceGeneratorsList)
-        {
-            Vector3d forceValue = forcePoint.force->getForceValue(this);
-            addForceAtBodyPoint(forceValue, forcePoint.point);
-        }
+    // Angular forces
+    for (ForcePoint& forcePoint : pointForceGeneratorsList)
+    {
+        Vector3d forceValue = forcePoint.force->getForceValue(this);
+        addForceAtBodyPoint(forceValue, forcePoint.point);
     }
+}
 
-    // Calculate derivatives
-    calculateDerivedData();
+void Rigidbody::calculateAcceleration() {
+    linearAcceleration = m_forceAccum / m_mass;
+    m_angularAcceleration = m_inverseInertiaTensor * m_torqueAccum;
+}
 
-    // Update acceleration, speed and position
-    calculateAcceleration();
-    calculateSpeed(time);
+PhysicalDerivative Rigidbody::getDerivative() const {
+    return PhysicalDerivative{ linearSpeed, linearAcceleration, m_angularSpeed, m_angularAcceleration };
+}
 
-    // Clear accumulators
-    clearAccumulator();
+PhysicalState Rigidbody::getState() const {
+    return PhysicalState{ m_gameObject->transform.getPosition(), linearSpeed, m_gameObject->transform.getRotation(),
+        m_angularSpeed };
 }
 
-void Rigidbody::calculateAcceleration() {
-    linearAcceleration = m_forceAccum / m_mass;
-    m_angularAcceleration = m_inertiaTensor.inverse() * m_torqueAccum;
+void Rigidbody::setState(const PhysicalState& state) {
+    PhysicalComponent::setState(state);
+    m_gameObject->transform.setRotation(state.orientation);
+    m_angularSpeed = state.angularSpeed;
 }
 
 void Rigidbody::calculateDerivedData() {
-    m_transformMatrix.setOrientationAndPosition(m_orientation, getPosition());
-
     Mesh* mesh = m_gameObject->getMesh();
     if (mesh != nullptr)
     {
         m_inertiaTensor = mesh->getInertiaTensor(m_mass);
+        m_inverseInertiaTensor = m_inertiaTensor.inverse();
     }
     else
     {
         std::cerr << "No mesh found for rigidbody" << std::endl;
         m_inertiaTensor = Matrix33();
+        m_inverseInertiaTensor = Matrix33();
     }
 }
 
-void Rigidbody::calculateSpeed(float time) {
-    linearSpeed = linearSpeed + linearAcceleration * time;
-    m_angularSpeed = m_angularSpeed + m_angularAcceleration * time;
-}
-
 Vector3d Rigidbody::getAngularSpeed() const {
     return m_angularSpeed;
 }
@@ -125,12 +119,12 @@ void Rigidbody::deleteForceAtPoint(ForceGenerator* forceGenerator) {
     }
 }
 
-void Rigidbody::addForceToPointList(ForceGenerator* forceGenerator, const Vector3d& point) {
-    pointForceGeneratorsList.emplace_back(ForcePoint{ forceGenerator, point });
+const std::vector<ForcePoint>& Rigidbody::getPointForces() const {
+    return pointForceGeneratorsList;
 }
 
-void Rigidbody::calculateOrientation(float deltaTime) {
-    m_orientation = m_orientation + Quaternion(0, m_angularSpeed.getx(), m_angularSpeed.gety(), m_angularSpeed.getz()) * (deltaTime / 2) * m_orientation;
+void Rigidbody::addForceToPointList(ForceGenerator* forceGenerator, const Vector3d& point) {
+    pointForceGeneratorsList.emplace_back(ForcePoint{ forceGenerator, point });
 }
 
 //     pointForceGeneratorsList.emplace_back(forceGenerator, point);
@@ -160,7 +154,7 @@ void Rigidbody::drawGuiForceGeneratorsAtPoint() {
                 ImGui::Text("Point: ");
                 ImGui::SameLine();
                 std::string pointText = "##RigidbodyAddForcePoint" + forceGenerator.force->getName();
-                ImGui::DragFloat3(pointText.c_str(), &forceGenerator.point.x);
+                ImGuiUtility::DragReal3(pointText.c_str(), &forceGenerator.point.x);
             }
         ImGui::EndPopup();
     }
@@ -218,15 +212,15 @@ void Rigidbody::drawGui() {
         ImGui::TableNextColumn();
         ImGui::Text("X:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentAngularSpeedX", &m_angularSpeed.x);
+        ImGuiUtility::InputReal("##PhysicalComponentAngularSpeedX", &m_angularSpeed.x);
         ImGui::TableNextColumn();
         ImGui::Text("Y:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentAngularSpeedY", &m_angularSpeed.y);
+        ImGuiUtility::InputReal("##PhysicalComponentAngularSpeedY", &m_angularSpeed.y);
         ImGui::TableNextColumn();
         ImGui::Text("Z:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentAngularSpeedZ", &m_angularSpeed.z);
+        ImGuiUtility::InputReal("##PhysicalComponentAngularSpeedZ", &m_angularSpeed.z);
         ImGui::EndTable();
     }
     ImGui::Text("Angular Acceleration");
@@ -235,15 +229,15 @@ void Rigidbody::drawGui() {
         ImGui::TableNextColumn();
         ImGui::Text("X:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentAngularAccelerationX", &m_angularAcceleration.x);
+        ImGuiUtility::InputReal("##PhysicalComponentAngularAccelerationX", &m_angularAcceleration.x);
         ImGui::TableNextColumn();
         ImGui::Text("Y:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentAngularAccelerationY", &m_angularAcceleration.y);
+        ImGuiUtility::InputReal("##PhysicalComponentAngularAccelerationY", &m_angularAcceleration.y);
         ImGui::TableNextColumn();
         ImGui::Text("Z:");
         ImGui::SameLine();
-        ImGui::InputFloat("##PhysicalComponentAngularAccelerationZ", &m_angularAcceleration.z);
+        ImGuiUtility::InputReal("##PhysicalComponentAngularAccelerationZ", &m_angularAcceleration.z);
         ImGui::EndTable();
     }
     ImGui::NewLine();
@@ -27,12 +27,10 @@ protected:
     Vector3d m_angularSpeed;
     Vector3d m_angularAcceleration;
     Matrix33 m_inertiaTensor;
+    // Inverted once per step by calculateDerivedData (zero without a mesh), the integrators evaluate several times per step
+    Matrix33 m_inverseInertiaTensor;
     Vector3d m_torqueAccum;
 
-    Quaternion m_orientation;
-    Vector3d m_rotation;
-    Matrix34 m_transformMatrix;
-
     std::vector<ForcePoint> pointForceGeneratorsList;
 
 public:
@@ -49,11 +47,14 @@ private:
 
     void addForceAtBodyPoint(const Vector3d& force, const Vector3d& LocalPoint);
 
-    void calculateAcceleration();
-    void calculateOrientation(float deltaTime);
-    void calculateSpeed(float time);
+protected:
+    void clearAccumulator() override;
+
+    void accumulateForces() override;
+
+    void calculateAcceleration() override;
 
-    void clearAccumulator();
+    PhysicalDerivative getDerivative() const override;
 
     //    void addForceAtPointToList(ForceGenerator *forceGenerator, const Vector3d &point);
 
@@ -72,8 +73,14 @@ public:
 
     void setAngularSpeed(const Vector3d& angularSpeed);
 
+    PhysicalState getState() const override;
+
+    void setState(const PhysicalState& state) override;
+
     void deleteForceAtPoint(ForceGenerator* forceGenerator);
 
+    const std::vector<ForcePoint>& getPointForces() const;
+
     //    template<class T>
     //    void deleteForceAtPointByClass(T *&comp) {
     //        for (auto it = pointForceGeneratorsList.begin(); it != pointForceGeneratorsList.end(); ++it) {
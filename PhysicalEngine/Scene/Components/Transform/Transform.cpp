@@ -1,8 +1,11 @@
 #include "Transform.h"
 
 #include "../../../Utility/Vector3d.h"
+#include "../../../Utility/imGuiUtility.h"
 #include "imgui/imgui.h"
 
+#include <algorithm>
+
 Transform::Transform() {
     positionX = 0;
     positionY = 0;
@@ -13,6 +16,12 @@ Transform::Transform() {
 }
 
 Transform::~Transform() {
+    setParent(nullptr);
+    for (auto &child : children)
+    {
+        child->parent = nullptr;
+        child->markDirty();
+    }
 }
 
 void Transform::drawGui() {
@@ -22,37 +31,44 @@ void Transform::drawGui() {
         ImGui::TableNextColumn();
         ImGui::Text("X:");
         ImGui::SameLine();
-        ImGui::InputFloat("##TransformPositionX", &positionX);
+        if (ImGuiUtility::InputReal("##TransformPositionX", &positionX))
+            markDirty();
         ImGui::TableNextColumn();
         ImGui::Text("Y:");
         ImGui::SameLine();
-        ImGui::InputFloat("##TransformPositionY", &positionY);
+        if (ImGuiUtility::InputReal("##TransformPositionY", &positionY))
+            markDirty();
         ImGui::TableNextColumn();
         ImGui::Text("Z:");
         ImGui::SameLine();
-        ImGui::InputFloat("##TransformPositionZ", &positionZ);
+        if (ImGuiUtility::InputReal("##TransformPositionZ", &positionZ))
+            markDirty();
         ImGui::EndTable();
     }
     ImGui::Text("Rotation");
     if (ImGui::BeginTable("TransformRotation", 4))
     {
-        float* values = rotation.getValues();
+        real* values = rotation.getValues();
         ImGui::TableNextColumn();
         ImGui::Text("W:");
         ImGui::SameLine();
-        ImGui::InputFloat("##TransformRotationA", &values[0]);
+        if (ImGuiUtility::InputReal("##TransformRotationA", &values[0]))
+            markDirty();
         ImGui::TableNextColumn();
         ImGui::Text("X:");
         ImGui::SameLine();
-        ImGui::InputFloat("##TransformRotationB", &values[1]);
+        if (ImGuiUtility::InputReal("##TransformRotationB", &values[1]))
+            markDirty();
         ImGui::TableNextColumn();
         ImGui::Text("Y:");
         ImGui::SameLine();
-        ImGui::InputFloat("##TransformRotationC", &values[2]);
+        if (ImGuiUtility::InputReal("##TransformRotationC", &values[2]))
+            markDirty();
         ImGui::TableNextColumn();
         ImGui::Text("Z:");
         ImGui::SameLine();
-        ImGui::InputFloat("##TransformRotationD", &values[3]);
+        if (ImGuiUtility::InputReal("##TransformRotationD", &values[3]))
+            markDirty();
         ImGui::EndTable();
     }
     ImGui::Text("Scale");
@@ -61,29 +77,28 @@ void Transform::drawGui() {
         ImGui::TableNextColumn();
         ImGui::Text("X:");
         ImGui::SameLine();
-        ImGui::InputFloat("##TransformScaleX", &scaleX);
+        ImGuiUtility::InputReal("##TransformScaleX", &scaleX);
         ImGui::TableNextColumn();
         ImGui::Text("Y:");
         ImGui::SameLine();
-        ImGui::InputFloat("##TransformScaleY", &scaleY);
+        ImGuiUtility::InputReal("##TransformScaleY", &scaleY);
         ImGui::TableNextColumn();
         ImGui::Text("Z:");
         ImGui::SameLine();
-        ImGui::InputFloat("##TransformScaleZ", &scaleZ);
+        ImGuiUtility::InputReal("##TransformScaleZ", &scaleZ);
         ImGui::EndTable();
     }
 }
 
-void Transform::setPosition(float x, float y, float z) {
+void Transform::setPosition(real x, real y, real z) {
     positionX = x;
     positionY = y;
     positionZ = z;
+    markDirty();
 }
 
 void Transform::setPosition(const Vector3d& position) {
-    positionX = position.getx();
-    positionY = position.gety();
-    positionZ = position.getz();
+    setPosition(position.getx(), position.gety(), position.getz());
 }
 
 Vector3d Transform::getPosition() const {
@@ -92,6 +107,17 @@ Vector3d Transform::getPosition() const {
 
 void Transform::setRotation(const Quaternion& rotation) {
     this->rotation = rotation;
+    markDirty();
+}
+
+void Transform::setScale(real x, real y, real z) {
+    scaleX = x;
+    scaleY = y;
+    scaleZ = z;
+}
+
+Vector3d Transform::getScale() const {
+    return { scaleX, scaleY, scaleZ };
 }
 
 Quaternion Transform::getRotation() const {
@@ -102,8 +128,68 @@ std::string Transform::getName() const {
     return COMPONENT_TYPE;
 }
 
-Matrix34 Transform::getMatrix() const {
-    Matrix34 matrix;
-    matrix.setOrientationAndPosition(rotation, Vector3d(positionX, positionY, positionZ));
-    return matrix;
+const Matrix34& Transform::getMatrix() const {
+    if (worldMatrixDirty)
+    {
+        worldMatrix.setOrientationAndPosition(rotation, Vector3d(positionX, positionY, positionZ));
+        if (parent != nullptr)
+            worldMatrix = parent->getMatrix() * worldMatrix;
+        worldMatrixDirty = false;
+        inverseWorldMatrixDirty = true;
+    }
+    return worldMatrix;
+}
+
+const Matrix34& Transform::getInverseMatrix() const {
+    const Matrix34& matrix = getMatrix();
+    if (inverseWorldMatrixDirty)
+    {
+        inverseWorldMatrix = matrix.inverse();
+        inverseWorldMatrixDirty = false;
+    }
+    return inverseWorldMatrix;
+}
+
+Vector3d Transform::getWorldPosition() const {
+    if (parent == nullptr)
+        return getPosition();
+    const Matrix34& matrix = getMatrix();
+    return { matrix(0, 3), matrix(1, 3), matrix(2, 3) };
+}
+
+void Transform::setParent(Transform* newParent) {
+    if (newParent == parent)
+        return;
+    // getMatrix() walks up the parents, a transform can't become the parent of one of its ancestors
+    for (const Transform* ancestor = newParent; ancestor != nullptr; ancestor = ancestor->parent)
+    {
+        if (ancestor == this)
+            return;
+    }
+    if (parent != nullptr)
+        parent->children.erase(std::remove(parent->children.begin(), parent->children.end(), this), parent->children.end());
+    parent = newParent;
+    if (parent != nullptr)
+        parent->children.push_back(this);
+    markDirty();
+}
+
+Transform* Transform::getParent() const {
+    return parent;
+}
+
+const std::vector<Transform*>& Transform::getChildren() const {
+    return children;
+}
+
+void Transform::markDirty() {
+    // A dirty transform always has dirty children, so the propagation can stop at the first dirty node
+    if (worldMatrixDirty)
+        return;
+    worldMatrixDirty = true;
+    inverseWorldMatrixDirty = true;
+    for (auto& child : children)
+    {
+        child->markDirty();
+    }
 }
@@ -8,38 +8,81 @@
 #include "../Component.h"
 #include "../DefaultComponent.h"
 #include <string>
+#include <vector>
 
 class Transform : private DefaultComponent {
 private:
     static constexpr const char *COMPONENT_TYPE = "Transform";
 
-public:
-    float positionX, positionY, positionZ;
-    float scaleX, scaleY, scaleZ;
+private:
+    // Local values (relative to the parent if any)
+    real positionX, positionY, positionZ;
+    real scaleX, scaleY, scaleZ;
     Quaternion rotation;
 
+    // Hierarchy
+    Transform *parent = nullptr;
+    std::vector<Transform *> children;
+
+    // Cached world matrix and its inverse, rebuilt only when dirty
+    mutable Matrix34 worldMatrix;
+    mutable Matrix34 inverseWorldMatrix;
+    mutable bool worldMatrixDirty = true;
+    mutable bool inverseWorldMatrixDirty = true;
+
 public:
     Transform();
 
+    Transform(const Transform &) = delete;
+
+    Transform &operator=(const Transform &) = delete;
+
     ~Transform();
 
 public:
     void drawGui() override;
 
-    void setPosition(float x, float y, float z);
+    void setPosition(real x, real y, real z);
 
     void setPosition(const Vector3d &position);
 
     void setRotation(const Quaternion &rotation);
 
+    void setScale(real x, real y, real z);
+
     [[nodiscard]] auto getRotation() const -> Quaternion;
 
     [[nodiscard]] auto getPosition() const -> Vector3d;
 
-    [[nodiscard]] auto getMatrix() const -> Matrix34;
+    [[nodiscard]] auto getScale() const -> Vector3d;
+
+    /// <summary>
+    /// Matrice de transformation monde (rotation + translation), recalculée uniquement si la transform a changé
+    /// </summary>
+    [[nodiscard]] auto getMatrix() const -> const Matrix34 &;
+
+    /// <summary>
+    /// Inverse de la matrice monde, mise en cache comme la matrice monde
+    /// </summary>
+    [[nodiscard]] auto getInverseMatrix() const -> const Matrix34 &;
+
+    [[nodiscard]] auto getWorldPosition() const -> Vector3d;
 
     [[nodiscard]] auto getName() const -> std::string override;
 
+public:
+    /// <summary>
+    /// Change le parent de la transform, ignoré si le nouveau parent est la transform elle-même ou l'un de ses descendants
+    /// </summary>
+    void setParent(Transform *newParent);
+
+    [[nodiscard]] auto getParent() const -> Transform *;
+
+    [[nodiscard]] auto getChildren() const -> const std::vector<Transform *> &;
+
+private:
+    void markDirty();
+
     //    virtual Vector3d getForward() const =0;
 };
 
@@ -0,0 +1,78 @@
+#include "Frustum.h"
+
+#include <cmath>
+
+Frustum::Frustum(const glm::mat4 &viewProjection) {
+    // Gribb and Hartmann: every plane is the last row of the matrix plus or minus one of the others
+    glm::mat4 rows = glm::transpose(viewProjection);
+    planes[0] = rows[3] + rows[0];
+    planes[1] = rows[3] - rows[0];
+    planes[2] = rows[3] + rows[1];
+    planes[3] = rows[3] - rows[1];
+    planes[4] = rows[3] + rows[2];
+    planes[5] = rows[3] - rows[2];
+    for (glm::vec4 &plane: planes) {
+        plane /= glm::length(glm::vec3(plane));
+    }
+}
+
+bool Frustum::intersectsSphere(const Vector3d &center, real radius) const {
+    for (const glm::vec4 &plane: planes) {
+        float distance = plane.x * static_cast<float>(center.getx()) + plane.y * static_cast<float>(center.gety()) +
+                         plane.z * static_cast<float>(center.getz()) + plane.w;
+        if (distance < -static_cast<float>(radius))
+            return false;
+    }
+    return true;
+}
+
+bool Frustum::intersectsCube(const Vector3d &center, real halfWidth) const {
+    for (const glm::vec4 &plane: planes) {
+        // Distance of the corner furthest along the normal
+        float extent = static_cast<float>(halfWidth) * (std::abs(plane.x) + std::abs(plane.y) + std::abs(plane.z));
+        float distance = plane.x * static_cast<float>(center.getx()) + plane.y * static_cast<float>(center.gety()) +
+                         plane.z * static_cast<float>(center.getz()) + plane.w;
+        if (distance + extent < 0)
+            return false;
+    }
+    return true;
+}
+
+bool Frustum::containsCube(const Vector3d &center, real halfWidth) const {
+    for (const glm::vec4 &plane: planes) {
+        float extent = static_cast<float>(halfWidth) * (std::abs(plane.x) + std::abs(plane.y) + std::abs(plane.z));
+        float distance = plane.x * static_cast<float>(center.getx()) + plane.y * static_cast<float>(center.gety()) +
+                         plane.z * static_cast<float>(center.getz()) + plane.w;
+        if (distance - extent < 0)
+            return false;
+    }
+    return true;
+}
+
+bool Frustum::intersectsBox(const Vector3d &min, const Vector3d &max) const {
+    glm::vec3 center(static_cast<float>(min.getx() + max.getx()) / 2, static_cast<float>(min.gety() + max.gety()) / 2,
+                     static_cast<float>(min.getz() + max.getz()) / 2);
+    glm::vec3 halfSize(static_cast<float>(max.getx() - min.getx()) / 2, static_cast<float>(max.gety() - min.gety()) / 2,
+                       static_cast<float>(max.getz() - min.getz()) / 2);
+    for (const glm::vec4 &plane: planes) {
+        float extent = halfSize.x * std::abs(plane.x) + halfSize.y * std::abs(plane.y) + halfSize.z * std::abs(plane.z);
+        float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+        if (distance + extent < 0)
+            return false;
+    }
+    return true;
+}
+
+bool Frustum::containsBox(const Vector3d &min, const Vector3d &max) const {
+    glm::vec3 center(static_cast<float>(min.getx() + max.getx()) / 2, static_cast<float>(min.gety() + max.gety()) / 2,
+                     static_cast<float>(min.getz() + max.getz()) / 2);
+    glm::vec3 halfSize(static_cast<float>(max.getx() - min.getx()) / 2, static_cast<float>(max.gety() - min.gety()) / 2,
+                       static_cast<float>(max.getz() - min.getz()) / 2);
+    for (const glm::vec4 &plane: planes) {
+        float extent = halfSize.x * std::abs(plane.x) + halfSize.y * std::abs(plane.y) + halfSize.z * std::abs(plane.z);
+        float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+        if (distance - extent < 0)
+            return false;
+    }
+    return true;
+}
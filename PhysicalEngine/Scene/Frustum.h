@@ -0,0 +1,36 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include "../Utility/Vector3d.h"
+
+#include <glm/glm.hpp>
+
+/// <summary>
+/// Volume vu par la caméra, donné par les six plans extraits de la matrice projection * view
+/// </summary>
+class Frustum {
+private:
+    // Left, right, bottom, top, near and far planes, a point p is inside when dot(normal, p) + d >= 0
+    glm::vec4 planes[6];
+
+public:
+    explicit Frustum(const glm::mat4 &viewProjection);
+
+    bool intersectsSphere(const Vector3d &center, real radius) const;
+
+    /// <summary>
+    /// Vrai si le cube de centre center et de demi-côté halfWidth touche le volume
+    /// </summary>
+    bool intersectsCube(const Vector3d &center, real halfWidth) const;
+
+    /// <summary>
+    /// Vrai si le cube est entièrement dans le volume, son contenu est alors visible sans autre test
+    /// </summary>
+    bool containsCube(const Vector3d &center, real halfWidth) const;
+
+    bool intersectsBox(const Vector3d &min, const Vector3d &max) const;
+
+    bool containsBox(const Vector3d &min, const Vector3d &max) const;
+};
+
+#endif // FRUSTUM_H
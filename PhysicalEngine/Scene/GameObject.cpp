@@ -3,29 +3,80 @@
 #include "glad/glad.h"
 
 #include "../Utility/Matrix34.h"
+#include "Camera.h"
 #include "Components/Component.h"
 #include "Components/PhysicalComponent/Particle/Particle.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 unsigned int GameObject::idCounter = 0;
 
 Shader *GameObject::defaultShader = nullptr;
 
+int GameObject::modelLocation = -1;
+
+int GameObject::colorLocation = -1;
+
 GameObject::GameObject(Scene *scene) {
     if (defaultShader == nullptr) {
         defaultShader = new Shader();
+        defaultShader->bindUniformBlock("Camera", CAMERA_UNIFORM_BINDING);
+        modelLocation = defaultShader->getUniformLocation("model");
+        colorLocation = defaultShader->getUniformLocation("color");
     }
     // defaultShader = new Shader();
 
     id = idCounter++;
     parentScene = scene;
-    gameObjectName = "GameObject";
+    setName("GameObject");
 }
 
 
-GameObject::GameObject(Scene *scene, Mesh *mesh) : GameObject(scene) {
-    mesh->getVerticesUseIndices();
+GameObject::GameObject(Scene *scene, Mesh *mesh) : GameObject(scene, mesh, true) {
+}
+
+GameObject::GameObject(Scene *scene, Mesh *mesh, bool createBuffers) : GameObject(scene) {
     this->mesh = mesh;
-    create();
+    if (createBuffers)
+        create();
+}
+
+void GameObject::createBuffers(GameObject *const *gameObjects, std::size_t count) {
+    // Objects sharing a geometry share its buffers, each geometry is uploaded once
+    std::vector<MeshGeometry *> geometries;
+    std::unordered_set<MeshGeometry *> pending;
+    std::size_t indexedCount = 0;
+    for (std::size_t i = 0; i < count; i++) {
+        // The levels of detail are drawn in place of the geometry, they need their buffers too
+        for (MeshGeometry *geometry = &gameObjects[i]->mesh->getGeometry(); geometry != nullptr;
+             geometry = geometry->lowerDetail.get()) {
+            if (geometry->hasBuffers() || !pending.insert(geometry).second)
+                continue;
+            geometries.push_back(geometry);
+            if (geometry->verticesUseIndices)
+                indexedCount++;
+        }
+    }
+    if (geometries.empty())
+        return;
+
+    // One name generation per buffer type instead of one per geometry
+    std::vector<unsigned int> vertexArrays(geometries.size());
+    std::vector<unsigned int> buffers(geometries.size() + indexedCount);
+    glGenVertexArrays(static_cast<GLsizei>(vertexArrays.size()), vertexArrays.data());
+    glGenBuffers(static_cast<GLsizei>(buffers.size()), buffers.data());
+
+    std::size_t nextBuffer = 0;
+    for (std::size_t i = 0; i < geometries.size(); i++) {
+        MeshGeometry *geometry = geometries[i];
+        geometry->VAO = vertexArrays[i];
+        geometry->VBO = buffers[nextBuffer++];
+        if (geometry->verticesUseIndices)
+            geometry->EBO = buffers[nextBuffer++];
+        uploadBuffers(*geometry);
+    }
+    defaultShader->use();
 }
 
 void GameObject::create() {
@@ -34,13 +85,25 @@ void GameObject::create() {
      *
      * https://www.khronos.org/opengl/wiki/Common_Mistakes#The_Object_Oriented_Language_Problem
      */
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
+    for (MeshGeometry *geometry = &mesh->getGeometry(); geometry != nullptr; geometry = geometry->lowerDetail.get()) {
+        if (geometry->hasBuffers())
+            continue;
+        glGenVertexArrays(1, &geometry->VAO);
+        glGenBuffers(1, &geometry->VBO);
+        if (geometry->verticesUseIndices)
+            glGenBuffers(1, &geometry->EBO);
+
+        uploadBuffers(*geometry);
+    }
+
+    defaultShader->use();
+}
 
-    glBindVertexArray(VAO);
+void GameObject::uploadBuffers(MeshGeometry &geometry) {
+    glBindVertexArray(geometry.VAO);
 
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * mesh->getVertices().size(), mesh->getVertices().data(),
+    glBindBuffer(GL_ARRAY_BUFFER, geometry.VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * geometry.vertices.size(), geometry.vertices.data(),
                  GL_STATIC_DRAW);
 
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void *) 0);
@@ -51,15 +114,12 @@ void GameObject::create() {
     //    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void *) (3 * sizeof(float)));
     //    glEnableVertexAttribArray(1);
 
-    if (mesh->getVerticesUseIndices()) {
-        glGenBuffers(1, &EBO);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * mesh->getIndices().size(),
-                     mesh->getIndices().data(),
+    if (geometry.verticesUseIndices) {
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry.EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * geometry.indices.size(),
+                     geometry.indices.data(),
                      GL_STATIC_DRAW);
     }
-
-    defaultShader->use();
 }
 
 GameObject::~GameObject() {
@@ -71,17 +131,6 @@ GameObject::~GameObject() {
     for (auto &component: components) {
         delete component;
     }
-    destroy();
-}
-
-void GameObject::destroy() {
-    /*
-     * Destroy the VAO, VBO and EBO here to prevent bug in the destructor (read the bug explanation in the link below)
-     *
-     * https://www.khronos.org/opengl/wiki/Common_Mistakes#The_Object_Oriented_Language_Problem
-     */
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
 }
 
 
@@ -91,29 +140,14 @@ void GameObject::update(float deltaTime) {
     }
 }
 
-void GameObject::draw(int display_w, int display_h, glm::mat4 view, float fov) {
-
-    // Matrix calculations
-    auto matrix = transform.getMatrix();
-    // auto m3 = matrix.extractMatrix33();
-    // m3.inverseMat();
-    // Matrix34 m4=matrix.matrix34FromRotationTranslation(m3, Vector3d(matrix(0, 3), matrix(1, 3), matrix(2, 3)));
-
-    glm::mat4 model = convertToGlmMat4(matrix);
-    glm::mat4 projection = glm::mat4(1.0f);
-    projection = glm::perspective(glm::radians(fov / 2), static_cast<float>(display_w) / static_cast<float>(display_h),
-                                  0.1f, 100.0f);
-
-    // Shader use
+void GameObject::draw() {
+    // Shader use, the view and projection come from the camera uniform buffer
     defaultShader->use();
-    defaultShader->setMat4("model", model);
-    defaultShader->setMat4("view", view);
-    defaultShader->setMat4("projection", projection);
-    //    defaultShader->setVec4("color", color);
-    defaultShader->setVec4("color", mesh->getColor());
+    defaultShader->setMat4(modelLocation, convertToGlmMat4(transform.getMatrix()));
+    defaultShader->setVec4(colorLocation, mesh->getColor());
 
     // Handle the VAO, VBO and EBO depending on the mesh type (with or without indices)
-    glBindVertexArray(VAO);
+    glBindVertexArray(mesh->getGeometry().VAO);
     if (mesh->getVerticesUseIndices()) {
         glDrawElements(GL_TRIANGLES, (GLsizei) mesh->getIndices().size(), GL_UNSIGNED_INT, 0);
     } else {
@@ -154,15 +188,43 @@ void GameObject::drawMeshGui() {
     mesh->drawGui();
 }
 
-std::string GameObject::getName() const {
-    return gameObjectName + " " + std::to_string(id);
+const std::string &GameObject::getName() const {
+    return gameObjectName;
+}
+
+void GameObject::setName(const std::string &name) {
+    gameObjectName = name + " " + std::to_string(id);
 }
 
 Scene *GameObject::getScenePtr() const {
     return parentScene;
 }
 
-glm::mat4 GameObject::convertToGlmMat4(Matrix34 &matrix) const {
+void GameObject::setParent(GameObject *parent) {
+    transform.setParent(parent != nullptr ? &parent->transform : nullptr);
+}
+
+Vector3d GameObject::getBoundingCenter() const {
+    const Matrix34 &matrix = transform.getMatrix();
+    return Vector3d(matrix(0, 3), matrix(1, 3), matrix(2, 3));
+}
+
+real GameObject::getBoundingRadius() const {
+    return getBoundingRadius(transform.getMatrix());
+}
+
+real GameObject::getBoundingRadius(const Matrix34 &matrix) const {
+    if (mesh == nullptr)
+        return 0;
+    // The longest axis of the transformation bounds the scale in every direction
+    real scale = 0;
+    for (int column = 0; column < 3; column++) {
+        scale = std::max(scale, Vector3d(matrix(0, column), matrix(1, column), matrix(2, column)).norm());
+    }
+    return scale * mesh->getGeometry().boundingRadius;
+}
+
+glm::mat4 GameObject::convertToGlmMat4(const Matrix34 &matrix) const {
     // remplire colonne par colonne
     return glm::mat4(matrix(0, 0), matrix(1, 0), matrix(2, 0), 0,
                      matrix(0, 1), matrix(1, 1), matrix(2, 1), 0,
@@ -15,15 +15,19 @@ class Scene;
 class Component;
 
 class GameObject {
+    // Names the loaded objects
+    friend class SceneLoader;
+
 private:
     static unsigned int idCounter;
 
 private:
-    // OpenGL variables
-    unsigned int VBO, VAO, EBO;
+    // OpenGL variables, the VAO, VBO and EBO belong to the geometry of the mesh
     //    Shader shader;
     //    static unsigned int shaderCount;
     static Shader* defaultShader;
+    static int modelLocation;
+    static int colorLocation;
 
 
 protected:
@@ -33,7 +37,7 @@ protected:
     // Id
     unsigned int id;
 
-    // Object name
+    // Object name, built once with the id so that getName does not allocate
     std::string gameObjectName;
 
     // Scene containing the object
@@ -43,32 +47,48 @@ protected:
     std::vector<Component*> components;
     std::map<std::string, Component*> componentsMap;
 
+    /// <summary>
+    /// Nomme l'objet "name id", le nom complet est construit une seule fois
+    /// </summary>
+    void setName(const std::string& name);
+
 public:
     // Base components
     Transform transform;
     Mesh* mesh = nullptr;
 
-    // Engine other elements
-    // std::vector<GameObject *> children;
 
 public:
     explicit GameObject(Scene* scene);
 
     explicit GameObject(Scene* scene, Mesh* mesh);
 
+    /// <summary>
+    /// Sans createBuffers, les buffers OpenGL de la géométrie ne sont pas créés : ils le sont ensuite pour tous
+    /// les objets d'un coup par GameObject::createBuffers
+    /// </summary>
+    GameObject(Scene* scene, Mesh* mesh, bool createBuffers);
+
+    /// <summary>
+    /// Crée les VAO, VBO et EBO des géométries sans buffers de count objets, avec un seul appel glGen* par type
+    /// </summary>
+    static void createBuffers(GameObject* const* gameObjects, std::size_t count);
+
 private:
     void create();
 
+    static void uploadBuffers(MeshGeometry& geometry);
+
 public:
     ~GameObject();
 
-private:
-    void destroy();
-
 public:
     void update(float deltaTime);
 
-    void draw(int display_w, int display_h, glm::mat4 view, float fov);
+    /// <summary>
+    /// Dessine l'objet seul, avec les matrices du bloc "Camera" écrites par Camera::updateUniformBuffer
+    /// </summary>
+    void draw();
 
 public:
     void drawTransformGui();
@@ -76,11 +96,13 @@ public:
     void drawMeshGui();
 
 public:
-    std::string getName() const;
+    const std::string& getName() const;
 
     Scene* getScenePtr() const;
 
-    glm::mat4 convertToGlmMat4(Matrix34& matrix) const;
+    void setParent(GameObject* parent);
+
+    glm::mat4 convertToGlmMat4(const Matrix34& matrix) const;
 
 public:
     const std::vector<Component*>& getComponents() const;
@@ -152,6 +174,18 @@ public:
     }
 
     Mesh* getMesh() const;
+
+    /// <summary>
+    /// Centre et rayon de la sphère englobant le maillage dans la scène, à l'échelle de la transformation
+    /// </summary>
+    Vector3d getBoundingCenter() const;
+
+    real getBoundingRadius() const;
+
+    /// <summary>
+    /// Rayon de la sphère englobante pour une autre matrice monde (celle d'un RenderSnapshot)
+    /// </summary>
+    real getBoundingRadius(const Matrix34 &matrix) const;
 };
 
 
@@ -0,0 +1,96 @@
+#include "GameObjectIndex.h"
+
+#include "Components/Component.h"
+#include "GameObject.h"
+#include "Scene.h"
+
+#include <cctype>
+
+GameObjectIndex::GameObjectIndex() : componentObjects(getComponentTypeCount()),
+                                     componentPositions(getComponentTypeCount()) {
+}
+
+bool GameObjectIndex::update(Scene &scene) {
+    if (!stale && structureVersion == scene.getStructureVersion())
+        return false;
+
+    gameObjects = scene.getGameObjects();
+    searchNames.resize(gameObjects.size());
+    for (int i = 0; i < getComponentTypeCount(); i++) {
+        componentObjects[i].clear();
+        componentPositions[i].clear();
+    }
+    for (std::size_t position = 0; position < gameObjects.size(); position++) {
+        GameObject *gameObject = gameObjects[position];
+        toLower(gameObject->getName().c_str(), searchNames[position]);
+        for (Component *component: gameObject->getComponents()) {
+            std::string name = component->getName();
+            for (int i = 0; i < getComponentTypeCount(); i++) {
+                if (name == Component::componentsNamesList[i]) {
+                    componentObjects[i].push_back(gameObject);
+                    componentPositions[i].push_back(position);
+                    break;
+                }
+            }
+        }
+    }
+
+    structureVersion = scene.getStructureVersion();
+    stale = false;
+    matchesStale = true;
+    return true;
+}
+
+void GameObjectIndex::invalidate() {
+    stale = true;
+}
+
+const std::vector<GameObject *> &GameObjectIndex::getMatches(const std::string &search, int componentType) {
+    return getMatches(search.c_str(), componentType);
+}
+
+const std::vector<GameObject *> &GameObjectIndex::getMatches(const char *search, int componentType) {
+    if (componentType < 0 || componentType >= getComponentTypeCount())
+        componentType = GAMEOBJECTINDEX_ALL_COMPONENTS;
+    const std::vector<GameObject *> &objects = getObjects(componentType);
+    // Without a name to look for, the index lists are the result
+    if (search[0] == '\0')
+        return objects;
+
+    if (matchesStale || search != lastSearch || componentType != lastComponentType) {
+        lastSearch = search;
+        lastComponentType = componentType;
+        matchesStale = false;
+        matches.clear();
+        toLower(search, lowerSearch);
+        bool allObjects = componentType == GAMEOBJECTINDEX_ALL_COMPONENTS;
+        for (std::size_t i = 0; i < objects.size(); i++) {
+            std::size_t position = allObjects ? i : componentPositions[componentType][i];
+            if (searchNames[position].find(lowerSearch) != std::string::npos)
+                matches.push_back(gameObjects[position]);
+        }
+    }
+    return matches;
+}
+
+std::size_t GameObjectIndex::getObjectCount(int componentType) const {
+    return getObjects(componentType).size();
+}
+
+int GameObjectIndex::getComponentTypeCount() {
+    return static_cast<int>(sizeof(Component::componentsNamesList) / sizeof(Component::componentsNamesList[0]));
+}
+
+const std::vector<GameObject *> &GameObjectIndex::getObjects(int componentType) const {
+    if (componentType < 0 || componentType >= getComponentTypeCount())
+        return gameObjects;
+    return componentObjects[componentType];
+}
+
+void GameObjectIndex::toLower(const char *text, std::string &lowerText) {
+    // Assigned in place, the string keeps its capacity between two searches
+    lowerText.clear();
+    for (; *text != '\0'; text++) {
+        lowerText.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(*text))));
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef GAMEOBJECTINDEX_H
+#define GAMEOBJECTINDEX_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#define GAMEOBJECTINDEX_ALL_COMPONENTS (-1)
+
+class Scene;
+
+class GameObject;
+
+/// <summary>
+/// Index des gameObjects de la scène par type de composant (ceux de Component::componentsNamesList), pour lister et
+/// filtrer de très grandes scènes sans parcourir tous les objets à chaque frame. L'index est reconstruit quand la
+/// structure de la scène change, le résultat de la dernière recherche est gardé tant qu'elle ne change pas.
+/// </summary>
+class GameObjectIndex {
+private:
+    // Scene version the index was built for, rebuilt on the next update when it differs or after invalidate
+    unsigned long long structureVersion = 0;
+    bool stale = true;
+
+    std::vector<GameObject *> gameObjects;
+    // Lower case names of gameObjects, built with the index so that a search does not convert them again
+    std::vector<std::string> searchNames;
+    // Objects holding each type of Component::componentsNamesList, in the scene order, and their position in
+    // gameObjects
+    std::vector<std::vector<GameObject *>> componentObjects;
+    std::vector<std::vector<std::size_t>> componentPositions;
+
+    // Last query and its result
+    std::string lastSearch;
+    std::string lowerSearch;
+    int lastComponentType = GAMEOBJECTINDEX_ALL_COMPONENTS;
+    bool matchesStale = true;
+    std::vector<GameObject *> matches;
+
+public:
+    GameObjectIndex();
+
+public:
+    /// <summary>
+    /// Reconstruit l'index si la structure de la scène a changé depuis le dernier appel, renvoie true dans ce cas
+    /// </summary>
+    bool update(Scene &scene);
+
+    /// <summary>
+    /// A appeler quand des composants ont été ajoutés ou supprimés, ce qui ne change pas la version de la scène
+    /// </summary>
+    void invalidate();
+
+    /// <summary>
+    /// Objets dont le nom contient search (sans tenir compte de la casse) et ayant un composant du type donné
+    /// (indice dans Component::componentsNamesList ou GAMEOBJECTINDEX_ALL_COMPONENTS)
+    /// </summary>
+    const std::vector<GameObject *> &getMatches(const std::string &search, int componentType);
+
+    /// <summary>
+    /// Même recherche sur le texte d'un champ de saisie, sans le copier dans une std::string temporaire
+    /// </summary>
+    const std::vector<GameObject *> &getMatches(const char *search, int componentType);
+
+    /// <summary>
+    /// Nombre d'objets ayant un composant du type donné
+    /// </summary>
+    std::size_t getObjectCount(int componentType) const;
+
+    static int getComponentTypeCount();
+
+private:
+    const std::vector<GameObject *> &getObjects(int componentType) const;
+
+    static void toLower(const char *text, std::string &lowerText);
+};
+
+#endif // GAMEOBJECTINDEX_H
@@ -0,0 +1,217 @@
+#include "InstancedRenderer.h"
+
+#include "Camera.h"
+#include "Components/Mesh/Mesh.h"
+#include "GameObject.h"
+#include "glad/glad.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+    // Same as the default shader of GameObject, the model matrix and the color come from the instance buffer
+    const char *INSTANCED_VERTEX_SHADER =
+            R"(#version 300 es
+
+precision highp float;
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in mat4 aModel;
+layout (location = 5) in vec4 aColor;
+
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+};
+
+out vec4 ourColor;
+
+void main()
+{
+    gl_Position = projection * view * aModel * vec4(aPos, 1.0f);
+    ourColor = aColor;
+}
+)";
+
+    const char *INSTANCED_FRAGMENT_SHADER =
+            R"(#version 300 es
+
+precision highp float;
+
+in vec4 ourColor;
+
+out vec4 FragColor;
+
+void main()
+{
+    FragColor = ourColor;
+}
+)";
+
+    constexpr unsigned int MODEL_LOCATION = 1;
+    constexpr unsigned int COLOR_LOCATION = 5;
+}
+
+InstancedRenderer::~InstancedRenderer() {
+    destroy();
+}
+
+void InstancedRenderer::create() {
+    destroy();
+    shader = new Shader(INSTANCED_VERTEX_SHADER, INSTANCED_FRAGMENT_SHADER, true);
+    shader->bindUniformBlock("Camera", CAMERA_UNIFORM_BINDING);
+    glGenBuffers(1, &instanceBuffer);
+}
+
+void InstancedRenderer::destroy() {
+    if (shader == nullptr)
+        return;
+    delete shader;
+    shader = nullptr;
+    glDeleteBuffers(1, &instanceBuffer);
+    instanceBuffer = 0;
+}
+
+void InstancedRenderer::draw(const std::vector<GameObject *> &gameObjects,
+                             const std::vector<const Matrix34 *> &matrices, const glm::mat4 &view,
+                             float pixelsPerUnit) {
+    drawCallCount = 0;
+    drawnVertexCount = 0;
+    if (shader == nullptr)
+        return;
+
+    // Group the objects by geometry: count the instances of every batch, then place the batches one after the other
+    for (Batch &batch: batches) {
+        batch.count = 0;
+    }
+    objectBatches.resize(gameObjects.size());
+    for (std::size_t i = 0; i < gameObjects.size(); i++) {
+        Mesh *mesh = gameObjects[i]->getMesh();
+        if (mesh == nullptr || !mesh->getGeometry().hasBuffers()) {
+            objectBatches[i] = SIZE_MAX;
+            continue;
+        }
+        MeshGeometry *geometry = &mesh->getGeometry();
+        if (levelOfDetail && geometry->lowerDetail != nullptr) {
+            // Projected diameter of the bounding sphere, from the depth of its center in front of the camera
+            const Matrix34 &matrix = *matrices[i];
+            float depth = -(view[0][2] * static_cast<float>(matrix(0, 3)) +
+                            view[1][2] * static_cast<float>(matrix(1, 3)) +
+                            view[2][2] * static_cast<float>(matrix(2, 3)) + view[3][2]);
+            if (depth > 0) {
+                float radius = static_cast<float>(gameObjects[i]->getBoundingRadius(matrix));
+                geometry = geometry->selectLevel(2 * radius * pixelsPerUnit / depth);
+            }
+        }
+        auto it = batchIndices.find(geometry);
+        if (it == batchIndices.end()) {
+            it = batchIndices.emplace(geometry, batches.size()).first;
+            batches.push_back({ geometry, 0, 0 });
+        }
+        objectBatches[i] = it->second;
+        batches[it->second].count++;
+    }
+    std::size_t instanceCount = 0;
+    for (Batch &batch: batches) {
+        batch.offset = instanceCount;
+        instanceCount += batch.count;
+    }
+    if (instanceCount == 0)
+        return;
+
+    instances.resize(instanceCount);
+    for (Batch &batch: batches) {
+        // Counted again while the instances are written
+        batch.count = 0;
+    }
+    for (std::size_t i = 0; i < gameObjects.size(); i++) {
+        if (objectBatches[i] == SIZE_MAX)
+            continue;
+        Batch &batch = batches[objectBatches[i]];
+        Instance &instance = instances[batch.offset + batch.count++];
+        const Matrix34 &matrix = *matrices[i];
+        // Column major, as glm and OpenGL expect it
+        for (int column = 0; column < 4; column++) {
+            for (int row = 0; row < 3; row++) {
+                instance.model[column * 4 + row] = static_cast<float>(matrix(row, column));
+            }
+            instance.model[column * 4 + 3] = column == 3 ? 1.0f : 0.0f;
+        }
+        glm::vec4 color = gameObjects[i]->getMesh()->getColor();
+        instance.color[0] = color.r;
+        instance.color[1] = color.g;
+        instance.color[2] = color.b;
+        instance.color[3] = color.a;
+    }
+
+    shader->use();
+
+    // One upload for every instance of the frame
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(instanceCount * sizeof(Instance)), instances.data(),
+                 GL_STREAM_DRAW);
+
+    for (const Batch &batch: batches) {
+        if (batch.count == 0)
+            continue;
+        MeshGeometry &geometry = *batch.geometry;
+        glBindVertexArray(geometry.VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+        std::size_t base = batch.offset * sizeof(Instance);
+        for (unsigned int column = 0; column < 4; column++) {
+            glVertexAttribPointer(MODEL_LOCATION + column, 4, GL_FLOAT, GL_FALSE, sizeof(Instance),
+                                  reinterpret_cast<void *>(base + column * 4 * sizeof(float)));
+            glEnableVertexAttribArray(MODEL_LOCATION + column);
+            glVertexAttribDivisor(MODEL_LOCATION + column, 1);
+        }
+        glVertexAttribPointer(COLOR_LOCATION, 4, GL_FLOAT, GL_FALSE, sizeof(Instance),
+                              reinterpret_cast<void *>(base + offsetof(Instance, color)));
+        glEnableVertexAttribArray(COLOR_LOCATION);
+        glVertexAttribDivisor(COLOR_LOCATION, 1);
+
+        if (geometry.verticesUseIndices) {
+            glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(geometry.indices.size()), GL_UNSIGNED_INT,
+                                    nullptr, static_cast<GLsizei>(batch.count));
+        } else {
+            glDrawArraysInstanced(GL_TRIANGLES, 0, static_cast<GLsizei>(geometry.getVertexCount()),
+                                  static_cast<GLsizei>(batch.count));
+        }
+        drawCallCount++;
+        drawnVertexCount += geometry.getVertexCount() * batch.count;
+    }
+    glBindVertexArray(0);
+
+    // Batches of released geometries are dropped, their address may be reused by a new geometry
+    bool hasEmptyBatch = false;
+    for (const Batch &batch: batches) {
+        hasEmptyBatch = hasEmptyBatch || batch.count == 0;
+    }
+    if (hasEmptyBatch) {
+        std::size_t kept = 0;
+        batchIndices.clear();
+        for (const Batch &batch: batches) {
+            if (batch.count == 0)
+                continue;
+            batchIndices.emplace(batch.geometry, kept);
+            batches[kept++] = batch;
+        }
+        batches.resize(kept);
+    }
+}
+
+unsigned int InstancedRenderer::getDrawCallCount() const {
+    return drawCallCount;
+}
+
+std::size_t InstancedRenderer::getBatchCount() const {
+    return batches.size();
+}
+
+std::size_t InstancedRenderer::getDrawnVertexCount() const {
+    return drawnVertexCount;
+}
+
+bool *InstancedRenderer::getPtrLevelOfDetail() {
+    return &levelOfDetail;
+}
@@ -0,0 +1,88 @@
+#ifndef INSTANCEDRENDERER_H
+#define INSTANCEDRENDERER_H
+
+#include "../Shader/Shader.h"
+#include "../Utility/Matrix34.h"
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+class GameObject;
+
+struct MeshGeometry;
+
+/// <summary>
+/// Dessin des gameObjects regroupés par géométrie partagée : les matrices modèle et les couleurs de tous les objets
+/// sont écrites dans un seul buffer d'instances, puis chaque géométrie est dessinée en un appel instancié.
+/// Le nombre d'appels de dessin dépend donc du nombre de maillages différents, pas du nombre d'objets.
+/// </summary>
+class InstancedRenderer {
+private:
+    // Per instance attributes, read with a divisor of 1 (the model matrix takes the locations 1 to 4)
+    struct Instance {
+        float model[16];
+        float color[4];
+    };
+
+    // Instances of a geometry, stored in [offset, offset + count) of the instance buffer
+    struct Batch {
+        MeshGeometry *geometry;
+        std::size_t count;
+        std::size_t offset;
+    };
+
+    Shader *shader = nullptr;
+    unsigned int instanceBuffer = 0;
+
+    // Kept between frames so that drawing does not allocate once they have reached their size
+    std::vector<Batch> batches;
+    std::unordered_map<MeshGeometry *, std::size_t> batchIndices;
+    std::vector<std::size_t> objectBatches;
+    std::vector<Instance> instances;
+
+    unsigned int drawCallCount = 0;
+    std::size_t drawnVertexCount = 0;
+
+    // Coarser geometries for the objects covering few pixels
+    bool levelOfDetail = true;
+
+public:
+    InstancedRenderer() = default;
+
+    InstancedRenderer(const InstancedRenderer &) = delete;
+
+    InstancedRenderer &operator=(const InstancedRenderer &) = delete;
+
+    ~InstancedRenderer();
+
+    /// <summary>
+    /// Crée le shader et le buffer d'instances, à appeler avec un contexte OpenGL
+    /// </summary>
+    void create();
+
+    void destroy();
+
+    /// <summary>
+    /// Dessine chaque gameObject avec la matrice monde de même indice, la vue et la projection venant du bloc
+    /// "Camera" écrit avant par Camera::updateUniformBuffer. Le niveau de détail de chaque objet est choisi selon
+    /// sa taille à l'écran : pixelsPerUnit pixels pour une longueur de 1 à une distance de 1 devant la caméra view.
+    /// </summary>
+    void draw(const std::vector<GameObject *> &gameObjects, const std::vector<const Matrix34 *> &matrices,
+              const glm::mat4 &view, float pixelsPerUnit);
+
+    /// <summary>
+    /// Appels de dessin du dernier draw
+    /// </summary>
+    unsigned int getDrawCallCount() const;
+
+    std::size_t getBatchCount() const;
+
+    /// <summary>
+    /// Sommets envoyés au dernier draw (indices pour les maillages indexés), toutes instances comprises
+    /// </summary>
+    std::size_t getDrawnVertexCount() const;
+
+    bool *getPtrLevelOfDetail();
+};
+
+#endif // INSTANCEDRENDERER_H
@@ -3,31 +3,51 @@
 //#include "Components/PhysicalComponent/Particle/Particle.h"
 #include "GameObject.h"
 #include "Components/PhysicalComponent/PhysicalComponent.h"
+#include "imgui/imgui.h"
 
 PhysicHandler::PhysicHandler() {
-
+    integrator = Integrator::createIntegrator(SYMPLECTIC_EULER_INTEGRATOR);
 }
 
-void PhysicHandler::update(GameObject *gameObject, float deltaTime) {
-    PhysicalComponent *physicalComponent = nullptr;
-    gameObject->getComponentByClass(physicalComponent);
-    if (physicalComponent != nullptr) {
-        move(gameObject, physicalComponent, deltaTime);
+PhysicHandler::~PhysicHandler() {
+    delete integrator;
+}
 
-        Rigidbody *rigidbody;
-        if (gameObject->hasComponentByClass(rigidbody)) {
-            angularMove(gameObject, rigidbody, deltaTime);
+void PhysicHandler::update(const std::vector<GameObject *> &gameObjects, float deltaTime) {
+    physicalComponents.clear();
+    for (GameObject *gameObject: gameObjects) {
+        PhysicalComponent *physicalComponent = nullptr;
+        gameObject->getComponentByClass(physicalComponent);
+        if (physicalComponent != nullptr) {
+            physicalComponents.push_back(physicalComponent);
         }
     }
+    integrator->integrate(physicalComponents, deltaTime);
 }
 
-void PhysicHandler::move(GameObject *gameObject, PhysicalComponent *physicalComponent, float deltaTime) {
-    gameObject->transform.setPosition(
-            gameObject->transform.getPosition() + physicalComponent->getLinearSpeed() * deltaTime);
+void PhysicHandler::setIntegrator(const std::string &name) {
+    Integrator *newIntegrator = Integrator::createIntegrator(name);
+    if (newIntegrator != nullptr) {
+        delete integrator;
+        integrator = newIntegrator;
+    }
 }
 
-void PhysicHandler::angularMove(GameObject *gameObject, Rigidbody *rigidbody, float deltaTime) {
-    Quaternion rotation = gameObject->transform.getRotation();
-    rotation.updateByAngularSpeed(rigidbody->getAngularSpeed(), deltaTime);
-    gameObject->transform.setRotation(rotation);
+Integrator *PhysicHandler::getIntegrator() const {
+    return integrator;
+}
+
+const char *PhysicHandler::drawGui() const {
+    const char *selectedName = nullptr;
+    ImGui::Text("Integrator");
+    if (ImGui::BeginCombo("##PhysicHandlerIntegrator", integrator->getName().c_str())) {
+        for (auto &integratorName: Integrator::integratorsNamesList) {
+            bool isSelected = integrator->getName() == integratorName;
+            if (ImGui::Selectable(integratorName, isSelected) && !isSelected) {
+                selectedName = integratorName;
+            }
+        }
+        ImGui::EndCombo();
+    }
+    return selectedName;
 }
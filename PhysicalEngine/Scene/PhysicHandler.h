@@ -1,8 +1,9 @@
-#ifndef INTEGRATOR_H
-#define INTEGRATOR_H
+#ifndef PHYSICHANDLER_H
+#define PHYSICHANDLER_H
 
-#include <list>
-#include "Components/PhysicalComponent/Rigidbody/Rigidbody.h"
+#include <string>
+#include <vector>
+#include "../Integrator/Integrator.h"
 
 class PhysicalComponent;
 
@@ -19,17 +20,42 @@ private:
 //    float fixedDeltaTime = 1.0f / fixedUpdatePerSecond;
 //    float timeToAdjustFrameRate = 0;
 
+    Integrator *integrator = nullptr;
+
+    // Physical components of the step, kept between steps so that updating does not allocate
+    std::vector<PhysicalComponent *> physicalComponents;
+
 public:
     PhysicHandler();
 
-    void update(GameObject *gameObject, float deltaTime);
+    PhysicHandler(const PhysicHandler &) = delete;
 
-private:
-    void move(GameObject *gameObject, PhysicalComponent *physicalComponent, float deltaTime);
+    PhysicHandler &operator=(const PhysicHandler &) = delete;
+
+    ~PhysicHandler();
+
+    /// <summary>
+    /// Intègre en une fois les composants physiques des objets, pour que chaque étape de l'intégrateur voie tous
+    /// les objets dans le même état
+    /// </summary>
+    void update(const std::vector<GameObject *> &gameObjects, float deltaTime);
+
+    /// <summary>
+    /// Liste des intégrateurs, renvoie celui choisi (nullptr sinon) pour que l'appelant le change avec setIntegrator
+    /// sous le verrou de la scène
+    /// </summary>
+    const char *drawGui() const;
+
+public:
+    /// <summary>
+    /// Change le schéma d'intégration (voir Integrator::integratorsNamesList)
+    /// </summary>
+    /// <param name="name"></param>
+    void setIntegrator(const std::string &name);
 
-    void angularMove(GameObject *gameObject, Rigidbody *rigidbody, float deltaTime);
+    Integrator *getIntegrator() const;
 
 };
 
 
-#endif // !INTEGRATOR_H
+#endif // !PHYSICHANDLER_H
@@ -0,0 +1,77 @@
+#include "PhysicsThread.h"
+
+#include "Scene.h"
+
+#include <chrono>
+
+PhysicsThread::~PhysicsThread() {
+    stop();
+}
+
+void PhysicsThread::start(Scene *scene) {
+    stop();
+    this->scene = scene;
+    // The first snapshot is ready before the first frame is drawn
+    scene->captureRenderSnapshot(snapshots.getWriteBuffer());
+    snapshots.publish();
+    publishedSnapshotCount.fetch_add(1, std::memory_order_relaxed);
+    running.store(true, std::memory_order_release);
+    thread = std::thread(&PhysicsThread::run, this);
+}
+
+void PhysicsThread::stop() {
+    if (!running.exchange(false, std::memory_order_acq_rel))
+        return;
+    thread.join();
+    scene = nullptr;
+}
+
+bool PhysicsThread::isRunning() const {
+    return running.load(std::memory_order_acquire);
+}
+
+void PhysicsThread::setPaused(bool paused) {
+    this->paused.store(paused, std::memory_order_release);
+}
+
+bool PhysicsThread::isPaused() const {
+    return paused.load(std::memory_order_acquire);
+}
+
+std::unique_lock<std::mutex> PhysicsThread::lockScene() {
+    return std::unique_lock<std::mutex>(sceneMutex);
+}
+
+const RenderSnapshot &PhysicsThread::acquireSnapshot() {
+    snapshots.acquire();
+    return snapshots.getReadBuffer();
+}
+
+unsigned long long PhysicsThread::getPublishedSnapshotCount() const {
+    return publishedSnapshotCount.load(std::memory_order_relaxed);
+}
+
+void PhysicsThread::run() {
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point nextStep = Clock::now();
+    while (running.load(std::memory_order_acquire)) {
+        float timeStep;
+        {
+            std::lock_guard<std::mutex> lock(sceneMutex);
+            timeStep = scene->getFixedTimeStep();
+            if (!paused.load(std::memory_order_acquire))
+                scene->updatePhysics(timeStep);
+            scene->captureRenderSnapshot(snapshots.getWriteBuffer());
+        }
+        snapshots.publish();
+        publishedSnapshotCount.fetch_add(1, std::memory_order_relaxed);
+
+        // Steps keep their own rate: a late step is followed by the missed ones, up to a limit instead of spiraling
+        auto stepDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(timeStep));
+        nextStep += stepDuration;
+        Clock::time_point now = Clock::now();
+        if (now - nextStep > stepDuration * MAX_STEPS_PER_FRAME)
+            nextStep = now;
+        std::this_thread::sleep_until(nextStep);
+    }
+}
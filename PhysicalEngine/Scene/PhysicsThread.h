@@ -0,0 +1,71 @@
+#ifndef PHYSICSTHREAD_H
+#define PHYSICSTHREAD_H
+
+#include "../Utility/TripleBuffer.h"
+#include "RenderSnapshot.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+class Scene;
+
+/// <summary>
+/// Simulation de la scène sur son propre thread, à un pas fixe indépendant des frames : après chaque pas les
+/// matrices des objets sont publiées dans un triple buffer que le dessin lit sans attendre la physique.
+/// Les modifications de la scène (interface, chargement, snapshots) se font sous lockScene, qui ne bloque la
+/// simulation que le temps de la modification ; les valeurs simulées se lisent dans les snapshots publiés.
+/// </summary>
+class PhysicsThread {
+private:
+    Scene *scene = nullptr;
+    std::thread thread;
+    std::atomic<bool> running{ false };
+    std::atomic<bool> paused{ false };
+
+    // Held by the physics thread during each step, and by the other threads while they use the scene
+    std::mutex sceneMutex;
+
+    TripleBuffer<RenderSnapshot> snapshots;
+    std::atomic<unsigned long long> publishedSnapshotCount{ 0 };
+
+public:
+    PhysicsThread() = default;
+
+    PhysicsThread(const PhysicsThread &) = delete;
+
+    PhysicsThread &operator=(const PhysicsThread &) = delete;
+
+    ~PhysicsThread();
+
+    /// <summary>
+    /// Démarre la simulation de scene, qui ne doit plus être modifiée hors de lockScene avant stop
+    /// </summary>
+    void start(Scene *scene);
+
+    void stop();
+
+    bool isRunning() const;
+
+    /// <summary>
+    /// En pause, les pas ne sont plus simulés mais les matrices sont toujours publiées (lecture d'une trajectoire,
+    /// édition dans l'inspecteur)
+    /// </summary>
+    void setPaused(bool paused);
+
+    bool isPaused() const;
+
+    std::unique_lock<std::mutex> lockScene();
+
+    /// <summary>
+    /// Dernières matrices publiées, côté thread de dessin uniquement
+    /// </summary>
+    const RenderSnapshot &acquireSnapshot();
+
+    unsigned long long getPublishedSnapshotCount() const;
+
+private:
+    void run();
+};
+
+#endif // PHYSICSTHREAD_H
@@ -7,7 +7,7 @@
 
 
 ParticlePrefab::ParticlePrefab(Scene* scene) : GameObject(scene, new Sphere(1, 20, 20)) {
-    gameObjectName = "Particle";
+    setName("Particle");
     auto* particle = new Particle(this);
     particle->addForceToList(new AnchoredSpring({ 0, 0, 0 }, 0.5f, 0.5f));
     addComponent(particle);
@@ -8,7 +8,7 @@
 RigidbodyPrefab::RigidbodyPrefab(Scene* scene) : GameObject(scene, new CuboidRectangle(2, 1, 1)) {
     // RigidbodyPrefab::RigidbodyPrefab(Scene* scene) : GameObject(scene, new Cylinder(2, 4, 10)) {
     //  RigidbodyPrefab::RigidbodyPrefab(Scene *scene) : GameObject(scene, new Cube(1)) {
-    gameObjectName = "Rigidbody";
+    setName("Rigidbody");
     auto* rigidbody = new Rigidbody(this);
     addComponent(rigidbody);
 }
@@ -16,7 +16,7 @@ RigidbodyPrefab::RigidbodyPrefab(Scene* scene) : GameObject(scene, new CuboidRec
 
 
 RigidbodyPrefab::RigidbodyPrefab(Scene* scene, Mesh* mesh) : GameObject(scene, mesh) {
-    gameObjectName = "Rigidbody";
+    setName("Rigidbody");
     auto* rigidbody = new Rigidbody(this);
     addComponent(rigidbody);
 }
@@ -0,0 +1,38 @@
+#ifndef RENDERSNAPSHOT_H
+#define RENDERSNAPSHOT_H
+
+#include "../Utility/Matrix34.h"
+#include "../Utility/Profiler.h"
+#include "../Utility/Vector3d.h"
+
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Boîte englobante d'un groupe d'objets proches, dont les indices sont order[begin, end) du RenderSnapshot
+/// </summary>
+struct RenderCluster {
+    Vector3d min;
+    Vector3d max;
+    unsigned int begin;
+    unsigned int end;
+};
+
+/// <summary>
+/// Matrices monde des gameObjects à la fin d'un pas, dans l'ordre de la scène : le dessin les lit sans toucher aux
+/// transformations que le thread physique modifie. Les panneaux lisent de même le profiler et le hash copiés.
+/// </summary>
+struct RenderSnapshot {
+    // Scene::getStructureVersion at the capture, the snapshot only applies to a scene with the same objects
+    unsigned long long structureVersion = 0;
+    unsigned long long stepCount = 0;
+    // Scene::getStateHash in deterministic mode, 0 otherwise
+    std::uint64_t stateHash = 0;
+    Profiler profiler;
+    std::vector<Matrix34> transforms;
+    // Indices of the objects grouped by cluster, the draw tests a cluster before its objects
+    std::vector<unsigned int> order;
+    std::vector<RenderCluster> clusters;
+};
+
+#endif // RENDERSNAPSHOT_H
@@ -0,0 +1,196 @@
+#include "RollbackBuffer.h"
+
+#include <cstring>
+#include <iostream>
+
+namespace {
+    // Granularity of the comparison, the snapshot sections are aligned on it
+    constexpr std::size_t DELTA_BLOCK_SIZE = 16;
+
+    // Run of changed blocks, followed by its bytes
+    struct DeltaRun {
+        std::uint32_t offset;
+        std::uint32_t size;
+    };
+
+    bool sameStructure(const SnapshotHeader &previous, const SnapshotHeader &current) {
+        return previous.totalSize == current.totalSize && previous.objectCount == current.objectCount &&
+               previous.forceCount == current.forceCount && previous.constraintCount == current.constraintCount;
+    }
+
+    void appendBytes(std::vector<unsigned char> &bytes, const void *source, std::size_t size) {
+        std::size_t offset = bytes.size();
+        bytes.resize(offset + size);
+        std::memcpy(bytes.data() + offset, source, size);
+    }
+}
+
+RollbackBuffer::RollbackBuffer(std::size_t capacity) : frames(capacity > 1 ? capacity : 2) {
+}
+
+void RollbackBuffer::record(Scene &scene) {
+    snapshot.capture(scene);
+    const unsigned char *current = snapshot.getData();
+    std::size_t size = snapshot.getSize();
+    unsigned long long stepCount = scene.getStepCount();
+
+    // Frames at or after the recorded one belong to a timeline that was left
+    bool truncated = false;
+    while (count > 0 && getFrame(count - 1).stepCount >= stepCount) {
+        count--;
+        truncated = true;
+    }
+
+    if (count == 0) {
+        Frame &frame = getFrame(0);
+        frame.stepCount = stepCount;
+        frame.isKeyframe = true;
+        frame.bytes.clear();
+        base.assign(current, current + size);
+        latest.assign(current, current + size);
+        count = 1;
+        return;
+    }
+
+    if (count == frames.size()) {
+        // The second oldest frame becomes the base
+        applyDelta(base, getFrame(1));
+        first = (first + 1) % frames.size();
+        count--;
+    }
+
+    Frame &frame = getFrame(count);
+    frame.stepCount = stepCount;
+    if (truncated) {
+        // latest holds a dropped frame, the new one is stored whole
+        frame.isKeyframe = true;
+        frame.bytes.assign(current, current + size);
+    } else {
+        encodeDelta(latest, current, size, frame);
+    }
+    latest.assign(current, current + size);
+    count++;
+}
+
+bool RollbackBuffer::rewind(Scene &scene, unsigned long long stepCount) {
+    std::size_t index = 0;
+    while (index < count && getFrame(index).stepCount != stepCount) {
+        index++;
+    }
+    if (index == count) {
+        std::cerr << "Frame " << stepCount << " is not in the rollback buffer" << std::endl;
+        return false;
+    }
+
+    scratch.assign(base.begin(), base.end());
+    for (std::size_t i = 1; i <= index; i++) {
+        applyDelta(scratch, getFrame(i));
+    }
+
+    SceneSnapshot view;
+    if (!view.setView(scratch.data(), scratch.size()) || !view.restore(scene))
+        return false;
+    count = index + 1;
+    latest.swap(scratch);
+    return true;
+}
+
+void RollbackBuffer::clear() {
+    first = 0;
+    count = 0;
+}
+
+bool RollbackBuffer::contains(unsigned long long stepCount) const {
+    for (std::size_t i = 0; i < count; i++) {
+        if (getFrame(i).stepCount == stepCount)
+            return true;
+    }
+    return false;
+}
+
+std::size_t RollbackBuffer::getCapacity() const {
+    return frames.size();
+}
+
+std::size_t RollbackBuffer::getFrameCount() const {
+    return count;
+}
+
+unsigned long long RollbackBuffer::getOldestFrame() const {
+    return count > 0 ? getFrame(0).stepCount : 0;
+}
+
+unsigned long long RollbackBuffer::getNewestFrame() const {
+    return count > 0 ? getFrame(count - 1).stepCount : 0;
+}
+
+std::size_t RollbackBuffer::getStoredBytes() const {
+    if (count == 0)
+        return 0;
+    std::size_t bytes = base.size();
+    for (std::size_t i = 1; i < count; i++) {
+        bytes += getFrame(i).bytes.size();
+    }
+    return bytes;
+}
+
+std::size_t RollbackBuffer::getLastFrameBytes() const {
+    if (count == 0)
+        return 0;
+    return count == 1 ? base.size() : getFrame(count - 1).bytes.size();
+}
+
+RollbackBuffer::Frame &RollbackBuffer::getFrame(std::size_t index) {
+    return frames[(first + index) % frames.size()];
+}
+
+const RollbackBuffer::Frame &RollbackBuffer::getFrame(std::size_t index) const {
+    return frames[(first + index) % frames.size()];
+}
+
+void RollbackBuffer::encodeDelta(const std::vector<unsigned char> &previous, const unsigned char *current,
+                                 std::size_t size, Frame &frame) {
+    frame.bytes.clear();
+    frame.isKeyframe = previous.size() != size ||
+                       !sameStructure(*reinterpret_cast<const SnapshotHeader *>(previous.data()),
+                                      *reinterpret_cast<const SnapshotHeader *>(current));
+
+    // Same layout: only the runs of blocks that differ (header, moving bodies, tuned forces) are kept.
+    // Static fields of a moving body (mesh, colliders, mass) stay out of the delta.
+    std::size_t offset = 0;
+    while (!frame.isKeyframe && offset < size) {
+        if (std::memcmp(previous.data() + offset, current + offset, DELTA_BLOCK_SIZE) == 0) {
+            offset += DELTA_BLOCK_SIZE;
+            continue;
+        }
+        std::size_t end = offset + DELTA_BLOCK_SIZE;
+        while (end < size && std::memcmp(previous.data() + end, current + end, DELTA_BLOCK_SIZE) != 0) {
+            end += DELTA_BLOCK_SIZE;
+        }
+        DeltaRun run = { static_cast<std::uint32_t>(offset), static_cast<std::uint32_t>(end - offset) };
+        appendBytes(frame.bytes, &run, sizeof(run));
+        appendBytes(frame.bytes, current + offset, run.size);
+        offset = end;
+        // Past this point the whole state is cheaper
+        frame.isKeyframe = frame.bytes.size() >= size;
+    }
+
+    if (frame.isKeyframe)
+        frame.bytes.assign(current, current + size);
+}
+
+void RollbackBuffer::applyDelta(std::vector<unsigned char> &state, const Frame &frame) {
+    if (frame.isKeyframe) {
+        state.assign(frame.bytes.begin(), frame.bytes.end());
+        return;
+    }
+
+    std::size_t position = 0;
+    while (position < frame.bytes.size()) {
+        DeltaRun run{};
+        std::memcpy(&run, frame.bytes.data() + position, sizeof(run));
+        position += sizeof(run);
+        std::memcpy(state.data() + run.offset, frame.bytes.data() + position, run.size);
+        position += run.size;
+    }
+}
@@ -0,0 +1,106 @@
+#ifndef ROLLBACKBUFFER_H
+#define ROLLBACKBUFFER_H
+
+#include "../Utility/Determinism.h"
+#include "Scene.h"
+#include "SceneSnapshot.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define ROLLBACK_DEFAULT_CAPACITY 120
+
+/// <summary>
+/// Historique circulaire des derniers états de la scène, pour revenir à une frame passée et la resimuler
+/// (entrées arrivées en retard en réseau par exemple).
+/// Seule la frame la plus ancienne est gardée en entier, les suivantes ne stockent que les enregistrements
+/// (objets, forces, contraintes) qui ont changé depuis la frame précédente.
+/// </summary>
+class RollbackBuffer {
+private:
+    struct Frame {
+        unsigned long long stepCount = 0;
+        // Full blob when the structure of the scene changed, list of changed records otherwise
+        bool isKeyframe = false;
+        std::vector<unsigned char> bytes;
+    };
+
+    std::vector<Frame> frames;
+    std::size_t first = 0;
+    std::size_t count = 0;
+
+    // Full state of the oldest and of the newest frame
+    std::vector<unsigned char> base;
+    std::vector<unsigned char> latest;
+    std::vector<unsigned char> scratch;
+    SceneSnapshot snapshot;
+
+public:
+    explicit RollbackBuffer(std::size_t capacity = ROLLBACK_DEFAULT_CAPACITY);
+
+public:
+    /// <summary>
+    /// Enregistre l'état courant de la scène comme frame getStepCount(). Les frames plus récentes ou égales
+    /// (après un retour en arrière extérieur) sont oubliées.
+    /// </summary>
+    void record(Scene &scene);
+
+    /// <summary>
+    /// Remet la scène dans l'état de la frame demandée, les frames suivantes sont oubliées
+    /// </summary>
+    bool rewind(Scene &scene, unsigned long long stepCount);
+
+    /// <summary>
+    /// Revient à la frame demandée puis resimule jusqu'à la frame la plus récente par pas fixes,
+    /// applyInputs(scene, stepCount) est appelé avant chaque pas pour rejouer les entrées (éventuellement corrigées)
+    /// </summary>
+    template <typename ApplyInputs>
+    bool resimulate(Scene &scene, unsigned long long stepCount, ApplyInputs applyInputs) {
+        unsigned long long newestFrame = getNewestFrame();
+        if (!rewind(scene, stepCount))
+            return false;
+        float timeStep = scene.getFixedTimeStep();
+        while (scene.getStepCount() < newestFrame) {
+            applyInputs(scene, scene.getStepCount());
+            if (Determinism::isEnabled()) {
+                DeterministicFloatingPointScope floatingPointScope;
+                scene.step(timeStep);
+            } else {
+                scene.step(timeStep);
+            }
+            record(scene);
+        }
+        return true;
+    }
+
+    void clear();
+
+    bool contains(unsigned long long stepCount) const;
+
+    std::size_t getCapacity() const;
+
+    std::size_t getFrameCount() const;
+
+    unsigned long long getOldestFrame() const;
+
+    unsigned long long getNewestFrame() const;
+
+    /// <summary>
+    /// Mémoire utilisée par les états stockés (frame de base et deltas)
+    /// </summary>
+    std::size_t getStoredBytes() const;
+
+    std::size_t getLastFrameBytes() const;
+
+private:
+    Frame &getFrame(std::size_t index);
+
+    const Frame &getFrame(std::size_t index) const;
+
+    static void encodeDelta(const std::vector<unsigned char> &previous, const unsigned char *current,
+                            std::size_t size, Frame &frame);
+
+    static void applyDelta(std::vector<unsigned char> &state, const Frame &frame);
+};
+
+#endif // ROLLBACKBUFFER_H
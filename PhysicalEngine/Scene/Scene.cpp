@@ -1,13 +1,21 @@
 #include "Scene.h"
 
+#include "../Utility/Determinism.h"
+#include "../Utility/Hash.h"
+#include "../Utility/TraceRecorder.h"
+#include "Frustum.h"
 #include "Components/Mesh/Cuboid/Cube.h"
 #include "Components/Mesh/Cuboid/CuboidRectangle.h"
 #include "Components/Mesh/Mesh.h"
 #include "Components/Mesh/Sphere/Sphere.h"
 #include "Components/PhysicalComponent/Particle/Particle.h"
 #include "GameObject.h"
+#include "TrajectoryRecorder.h"
 #include "glad/glad.h"
 
+#include <algorithm>
+#include <iostream>
+
 Scene::Scene(int windowWidth, int windowHeight) : particleCollide(1), octree(RigidbodyContactGeneratorRegistry()) {
     this->windowWidth = windowWidth;
     this->windowHeight = windowHeight;
@@ -46,6 +54,9 @@ void Scene::create() {
     if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
         std::cout << "ERROR::FRAMEBUFFER:: Framebuffer is not complete!" << std::endl;
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    camera.createUniformBuffer();
+    renderer.create();
 }
 
 Scene::~Scene() {
@@ -56,69 +67,334 @@ Scene::~Scene() {
 }
 
 void Scene::destroy() {
+    renderer.destroy();
+    camera.destroyUniformBuffer();
     glDeleteFramebuffers(1, &fbo);
 }
 
 void Scene::update(float deltaTime) {
-    camera.update(deltaTime);
+    TraceScope frameTrace("Frame");
+    profiler.beginFrame();
 
-    //    physicalUpdateTimer += deltaTime;
+    {
+        ScopedTimer timer(profiler, PROFILER_STAGE_CAMERA);
+        camera.update(deltaTime);
+    }
 
-    // Update the game objects (particles, ...)
-    for (GameObject *gameObject: gameObjects) {
-        gameObject->update(deltaTime);
+    simulate(deltaTime);
+}
+
+void Scene::updatePhysics(float deltaTime) {
+    TraceScope frameTrace("Physics frame");
+    profiler.beginFrame();
+    simulate(deltaTime);
+}
+
+void Scene::simulate(float deltaTime) {
+    octreeDrawable = false;
+
+    if (!Determinism::isEnabled()) {
+        step(deltaTime);
+        return;
     }
 
-    //    if (physicalUpdateTimer >= 1.0f / PHYSIC_UPDATE_PER_SECOND)
-    //    {
-    //    physicalUpdateTimer = 0;
+    // Deterministic mode: the frame time only decides how many fixed steps are run
+    DeterministicFloatingPointScope floatingPointScope;
+    physicalUpdateTimer += deltaTime;
+    unsigned int stepsThisFrame = 0;
+    // The small margin keeps a frame time equal to the fixed step from skipping steps because of rounding
+    while (physicalUpdateTimer + fixedTimeStep * 0.001f >= fixedTimeStep) {
+        if (stepsThisFrame == MAX_STEPS_PER_FRAME) {
+            // Too slow to catch up, drop the remaining time instead of spiraling
+            physicalUpdateTimer = 0;
+            break;
+        }
+        step(fixedTimeStep);
+        physicalUpdateTimer -= fixedTimeStep;
+        stepsThisFrame++;
+    }
+}
 
+void Scene::step(float deltaTime) {
+    stepCount++;
+
+    // Update the game objects (particles, ...)
+    {
+        ScopedTimer timer(profiler, PROFILER_STAGE_COMPONENTS);
+        for (GameObject *gameObject: gameObjects) {
+            gameObject->update(deltaTime);
+        }
+    }
 
     // Move gameObjects
-    for (GameObject *gameObject: gameObjects) {
-        physicHandler.update(gameObject, deltaTime);
+    particleConstraintSolver.beginStep();
+    {
+        ScopedTimer timer(profiler, PROFILER_STAGE_PHYSIC_HANDLER);
+        physicHandler.update(gameObjects, deltaTime);
     }
 
+    // Project the particles on the rodes and cables
+    {
+        ScopedTimer timer(profiler, PROFILER_STAGE_CONSTRAINTS);
+        particleConstraintSolver.solve(deltaTime);
+    }
+    profiler.setCounter(PROFILER_COUNTER_CONSTRAINTS, particleConstraintSolver.getConstraintCount());
+    profiler.setCounter(PROFILER_COUNTER_CONSTRAINT_COLORS, particleConstraintSolver.getColorCount());
+
     // Detect particles collision
-    collectParticleColliders();
-    ParticleContact *particleContacts = particleContactGeneratorRegistry.generateAllContacts();
+    {
+        ScopedTimer timer(profiler, PROFILER_STAGE_COLLECT_COLLIDERS);
+        collectParticleColliders();
+    }
+    ParticleContact *particleContacts;
+    {
+        ScopedTimer timer(profiler, PROFILER_STAGE_GENERATE_CONTACTS);
+        particleContacts = particleContactGeneratorRegistry.generateAllContacts();
+    }
+    profiler.setCounter(PROFILER_COUNTER_CANDIDATE_PAIRS, particleCollide.getCandidatePairCount());
+    profiler.setCounter(PROFILER_COUNTER_CONTACTS, particleContactGeneratorRegistry.getSize());
 
     // Resolve collisions
-    ParticleContact test = particleContacts[0];
-    particleContactResolver.resolveContact(particleContacts, particleContactGeneratorRegistry.getSize(), deltaTime);
+    {
+        ScopedTimer timer(profiler, PROFILER_STAGE_RESOLVE_CONTACTS);
+        particleContactResolver.resolveContact(particleContacts, particleContactGeneratorRegistry.getSize(), deltaTime);
+    }
+    profiler.setCounter(PROFILER_COUNTER_SOLVER_ITERATIONS, particleContactResolver.getLastIterationCount());
     cleanParticleColliders();
 
     // Clean octree
-    octree.CleanOctree(octree.root);
+    {
+        ScopedTimer timer(profiler, PROFILER_STAGE_OCTREE_CLEAN);
+        octree.Clear();
+    }
     // Insert all objects
+    {
+        ScopedTimer timer(profiler, PROFILER_STAGE_OCTREE_INSERT);
+        insertOctreeObjects();
+    }
+    // Test collisions
+    {
+        ScopedTimer timer(profiler, PROFILER_STAGE_OCTREE_TEST);
+        octree.TestAllCollisions(octree.root);
+    }
+    octreeDrawable = true;
+
+    if (trajectoryRecorder != nullptr)
+        trajectoryRecorder->recordFrame(*this);
+}
+
+void Scene::insertOctreeObjects() {
+    unindexedGameObjects.clear();
+    octreeDrawMargin = 0;
     for (GameObject *gameObject: gameObjects) {
         RigidbodyPrimitiveCollider *collider = nullptr;
         gameObject->getComponentByClass(collider);
-        if (collider != nullptr) {
-            Object *obj = new Object{collider->getCenter(), collider->getRadius(), NULL, collider};
-            octree.InsertObject(octree.root, obj);
+        if (collider == nullptr) {
+            unindexedGameObjects.push_back(gameObject);
+            continue;
         }
+        Object *obj = octree.NewObject(collider->getCenter(), collider->getRadius(), collider);
+        // The mesh is centered on the transform, the collider may be offset from it or smaller
+        real drawRadius = gameObject->getBoundingCenter().distance(obj->center) + gameObject->getBoundingRadius();
+        if (drawRadius > obj->radius) {
+            obj->drawRadius = drawRadius;
+            octreeDrawMargin = std::max(octreeDrawMargin, drawRadius - obj->radius);
+        }
+        octree.InsertObject(octree.root, obj);
     }
-    // Test collisions
-    octree.TestAllCollisions(octree.root);
+    octreeObjectCount = gameObjects.size();
 }
 
 void Scene::draw(int display_w, int display_h) {
-    // Draw the gameObjects
-    for (GameObject *gameObject: gameObjects) {
-        gameObject->draw(display_w, display_h, camera.getViewMatrix(), camera.getFov());
+    // The view and projection are uploaded once for every shader, then the gameObjects are drawn by geometry
+    float aspectRatio = static_cast<float>(display_w) / static_cast<float>(display_h);
+    camera.updateUniformBuffer(aspectRatio);
+    visibleGameObjects.clear();
+    visibleMatrices.clear();
+    if (!frustumCulling) {
+        for (GameObject *gameObject: gameObjects) {
+            visibleGameObjects.push_back(gameObject);
+            visibleMatrices.push_back(&gameObject->transform.getMatrix());
+        }
+        drawVisibleObjects(display_h);
+        return;
+    }
+
+    Frustum frustum(camera.getProjectionMatrix(aspectRatio) * camera.getViewMatrix());
+    // Objects added, removed or moved outside of a step since the last update are not in the octree, which belongs to
+    // the step: each object is tested on its own bounding sphere until the next one
+    if (!octreeDrawable || octreeObjectCount != gameObjects.size()) {
+        for (GameObject *gameObject: gameObjects) {
+            if (frustum.intersectsSphere(gameObject->getBoundingCenter(), gameObject->getBoundingRadius())) {
+                visibleGameObjects.push_back(gameObject);
+                visibleMatrices.push_back(&gameObject->transform.getMatrix());
+            }
+        }
+        drawVisibleObjects(display_h);
+        return;
+    }
+
+    visibleObjects.clear();
+    octree.QueryFrustum(octree.root, frustum, octreeDrawMargin, visibleObjects);
+    for (Object *object: visibleObjects) {
+        GameObject *gameObject = object->Collider->getGameObject();
+        visibleGameObjects.push_back(gameObject);
+        visibleMatrices.push_back(&gameObject->transform.getMatrix());
     }
+    for (GameObject *gameObject: unindexedGameObjects) {
+        if (frustum.intersectsSphere(gameObject->getBoundingCenter(), gameObject->getBoundingRadius())) {
+            visibleGameObjects.push_back(gameObject);
+            visibleMatrices.push_back(&gameObject->transform.getMatrix());
+        }
+    }
+    drawVisibleObjects(display_h);
 //    // Draw the axis
 //    if (showAxis)
 //        axis.draw(display_w, display_h, camera.getViewMatrix(), camera.getFov());
 }
 
+void Scene::drawVisibleObjects(int display_h) {
+    // projection[1][1] is 1 / tan(fov / 2): half the viewport height for a length of 1 at a distance of 1
+    glm::mat4 projection = camera.getProjectionMatrix(1.0f);
+    renderer.draw(visibleGameObjects, visibleMatrices, camera.getViewMatrix(),
+                  projection[1][1] * static_cast<float>(display_h) / 2);
+}
+
+bool Scene::draw(int display_w, int display_h, const RenderSnapshot &snapshot) {
+    if (snapshot.structureVersion != structureVersion || snapshot.transforms.size() != gameObjects.size())
+        return false;
+
+    // Only the matrices and clusters of the snapshot are read, the octree and the transforms belong to the physics
+    // thread. The objects of a cluster are tested only when its box crosses the frustum
+    float aspectRatio = static_cast<float>(display_w) / static_cast<float>(display_h);
+    camera.updateUniformBuffer(aspectRatio);
+    Frustum frustum(camera.getProjectionMatrix(aspectRatio) * camera.getViewMatrix());
+    visibleGameObjects.clear();
+    visibleMatrices.clear();
+    visibilityTestCount = 0;
+    for (const RenderCluster &cluster: snapshot.clusters) {
+        bool testObjects = false;
+        if (frustumCulling) {
+            visibilityTestCount++;
+            if (!frustum.intersectsBox(cluster.min, cluster.max))
+                continue;
+            testObjects = !frustum.containsBox(cluster.min, cluster.max);
+        }
+        for (unsigned int i = cluster.begin; i < cluster.end; i++) {
+            unsigned int index = snapshot.order[i];
+            const Matrix34 &matrix = snapshot.transforms[index];
+            if (testObjects) {
+                visibilityTestCount++;
+                if (!frustum.intersectsSphere(Vector3d(matrix(0, 3), matrix(1, 3), matrix(2, 3)),
+                                              gameObjects[index]->getBoundingRadius(matrix)))
+                    continue;
+            }
+            visibleGameObjects.push_back(gameObjects[index]);
+            visibleMatrices.push_back(&matrix);
+        }
+    }
+    drawVisibleObjects(display_h);
+    return true;
+}
+
+namespace {
+    // Spreads the 10 low bits of value to every third bit
+    std::uint32_t spreadBits(std::uint32_t value) {
+        value &= 0x3ff;
+        value = (value | (value << 16)) & 0x30000ff;
+        value = (value | (value << 8)) & 0x300f00f;
+        value = (value | (value << 4)) & 0x30c30c3;
+        value = (value | (value << 2)) & 0x9249249;
+        return value;
+    }
+}
+
+void Scene::sortRenderClusters(const RenderSnapshot &snapshot) {
+    // Bounds of the positions, quantized on 10 bits per axis
+    real min[3] = { 0, 0, 0 };
+    real max[3] = { 0, 0, 0 };
+    for (std::size_t i = 0; i < snapshot.transforms.size(); i++) {
+        for (int axis = 0; axis < 3; axis++) {
+            real position = snapshot.transforms[i](axis, 3);
+            min[axis] = i == 0 ? position : std::min(min[axis], position);
+            max[axis] = i == 0 ? position : std::max(max[axis], position);
+        }
+    }
+    real size = std::max(std::max(max[0] - min[0], max[1] - min[1]), std::max(max[2] - min[2], real(1.0e-6)));
+    real scale = 1023 / size;
+
+    renderClusterKeys.resize(snapshot.transforms.size());
+    for (std::size_t i = 0; i < snapshot.transforms.size(); i++) {
+        const Matrix34 &matrix = snapshot.transforms[i];
+        auto x = static_cast<std::uint32_t>((matrix(0, 3) - min[0]) * scale);
+        auto y = static_cast<std::uint32_t>((matrix(1, 3) - min[1]) * scale);
+        auto z = static_cast<std::uint32_t>((matrix(2, 3) - min[2]) * scale);
+        renderClusterKeys[i] = { spreadBits(x) | (spreadBits(y) << 1) | (spreadBits(z) << 2),
+                                 static_cast<unsigned int>(i) };
+    }
+    std::sort(renderClusterKeys.begin(), renderClusterKeys.end());
+    renderClusterOrder.resize(renderClusterKeys.size());
+    for (std::size_t i = 0; i < renderClusterKeys.size(); i++) {
+        renderClusterOrder[i] = renderClusterKeys[i].second;
+    }
+    renderClusterVersion = structureVersion;
+    renderClusterStep = stepCount;
+}
+
+void Scene::captureRenderSnapshot(RenderSnapshot &snapshot) {
+    snapshot.structureVersion = structureVersion;
+    snapshot.stepCount = stepCount;
+    snapshot.stateHash = Determinism::isEnabled() ? getStateHash() : 0;
+    snapshot.profiler = profiler;
+    snapshot.transforms.resize(gameObjects.size());
+    for (std::size_t i = 0; i < gameObjects.size(); i++) {
+        snapshot.transforms[i] = gameObjects[i]->transform.getMatrix();
+    }
+
+    // The objects drift apart from their cluster as they move, the clusters stay valid but grow
+    if (renderClusterOrder.size() != gameObjects.size() || renderClusterVersion != structureVersion ||
+        stepCount < renderClusterStep || stepCount - renderClusterStep >= RENDER_CLUSTER_SORT_INTERVAL)
+        sortRenderClusters(snapshot);
+    snapshot.order = renderClusterOrder;
+    snapshot.clusters.resize((gameObjects.size() + RENDER_CLUSTER_SIZE - 1) / RENDER_CLUSTER_SIZE);
+    for (std::size_t c = 0; c < snapshot.clusters.size(); c++) {
+        RenderCluster &cluster = snapshot.clusters[c];
+        cluster.begin = static_cast<unsigned int>(c * RENDER_CLUSTER_SIZE);
+        cluster.end = static_cast<unsigned int>(std::min<std::size_t>(cluster.begin + RENDER_CLUSTER_SIZE,
+                                                                      gameObjects.size()));
+        for (unsigned int i = cluster.begin; i < cluster.end; i++) {
+            unsigned int index = snapshot.order[i];
+            const Matrix34 &matrix = snapshot.transforms[index];
+            Vector3d center(matrix(0, 3), matrix(1, 3), matrix(2, 3));
+            real radius = gameObjects[index]->getBoundingRadius(matrix);
+            Vector3d halfSize(radius, radius, radius);
+            if (i == cluster.begin) {
+                cluster.min = center - halfSize;
+                cluster.max = center + halfSize;
+                continue;
+            }
+            cluster.min = Vector3d(std::min(cluster.min.getx(), center.getx() - radius),
+                                   std::min(cluster.min.gety(), center.gety() - radius),
+                                   std::min(cluster.min.getz(), center.getz() - radius));
+            cluster.max = Vector3d(std::max(cluster.max.getx(), center.getx() + radius),
+                                   std::max(cluster.max.gety(), center.gety() + radius),
+                                   std::max(cluster.max.getz(), center.getz() + radius));
+        }
+    }
+}
+
+void Scene::invalidateOctree() {
+    octreeDrawable = false;
+}
+
 void Scene::updateViewport(int width, int height) {
     windowHeight = height;
     windowWidth = width;
 }
 
 void Scene::addGameObject(GameObject *gameObject) {
+    octreeDrawable = false;
+    structureVersion++;
     gameObjects.push_back(gameObject);
 }
 
@@ -175,7 +451,102 @@ Camera *Scene::getCameraPtr() {
     return &camera;
 }
 
+PhysicHandler *Scene::getPhysicHandlerPtr() {
+    return &physicHandler;
+}
+
+ParticleConstraintSolver *Scene::getParticleConstraintSolverPtr() {
+    return &particleConstraintSolver;
+}
+
+unsigned int Scene::getDrawCallCount() const {
+    return renderer.getDrawCallCount();
+}
+
+std::size_t Scene::getDrawnVertexCount() const {
+    return renderer.getDrawnVertexCount();
+}
+
+bool *Scene::getPtrLevelOfDetail() {
+    return renderer.getPtrLevelOfDetail();
+}
+
+std::size_t Scene::getDrawnObjectCount() const {
+    return visibleGameObjects.size();
+}
+
+std::size_t Scene::getVisibilityTestCount() const {
+    return visibilityTestCount;
+}
+
+bool *Scene::getPtrFrustumCulling() {
+    return &frustumCulling;
+}
+
+unsigned long long Scene::getStructureVersion() const {
+    return structureVersion;
+}
+
+const Profiler &Scene::getProfiler() const {
+    return profiler;
+}
+
+void Scene::setFixedTimeStep(float timeStep) {
+    fixedTimeStep = timeStep;
+}
+
+float Scene::getFixedTimeStep() const {
+    return fixedTimeStep;
+}
+
+unsigned long long Scene::getStepCount() const {
+    return stepCount;
+}
+
+void Scene::setTrajectoryRecorder(TrajectoryRecorder *recorder) {
+    trajectoryRecorder = recorder;
+}
+
+TrajectoryRecorder *Scene::getTrajectoryRecorder() const {
+    return trajectoryRecorder;
+}
+
+std::uint64_t Scene::getStateHash() const {
+    std::uint64_t hash = Hash::FNV_OFFSET_BASIS;
+    for (GameObject *gameObject: gameObjects) {
+        PhysicalComponent *physicalComponent = nullptr;
+        gameObject->getComponentByClass(physicalComponent);
+        if (physicalComponent == nullptr) {
+            Vector3d position = gameObject->transform.getPosition();
+            hash = Hash::combine(Hash::combine(Hash::combine(hash, position.x), position.y), position.z);
+            continue;
+        }
+        PhysicalState state = physicalComponent->getState();
+        const Vector3d *vectors[] = {&state.position, &state.linearSpeed, &state.angularSpeed};
+        for (const Vector3d *vector: vectors) {
+            hash = Hash::combine(Hash::combine(Hash::combine(hash, vector->x), vector->y), vector->z);
+        }
+        for (int i = 0; i < 4; i++) {
+            hash = Hash::combine(hash, state.orientation[i]);
+        }
+    }
+    return hash;
+}
+
 void Scene::deleteGameObject(GameObject *gameObject) {
+    if (gameObject == nullptr)
+        return;
+
+    stopTrajectoryRecording("a game object was deleted");
+
+    Particle *particle = nullptr;
+    gameObject->getComponentByClass(particle);
+    if (particle != nullptr)
+        particleConstraintSolver.removeConstraints(particle);
+
+    // The octree keeps a pointer to its collider
+    octreeDrawable = false;
+    structureVersion++;
     for (auto it = gameObjects.begin(); it != gameObjects.end(); ++it) {
         if (*it == gameObject) {
             gameObjects.erase(it);
@@ -184,14 +555,48 @@ void Scene::deleteGameObject(GameObject *gameObject) {
     }
 }
 
+void Scene::deleteComponent(GameObject *gameObject, const std::string &name) {
+    if (gameObject == nullptr)
+        return;
+    Component *deleted = nullptr;
+    for (Component *component: gameObject->getComponents()) {
+        if (component->getName() == name) {
+            deleted = component;
+            break;
+        }
+    }
+    if (deleted == nullptr)
+        return;
+
+    if (dynamic_cast<PhysicalComponent *>(deleted) != nullptr)
+        stopTrajectoryRecording("a physical component was deleted");
+    if (auto *particle = dynamic_cast<Particle *>(deleted))
+        particleConstraintSolver.removeConstraints(particle);
+
+    // The octree may keep a pointer to a collider
+    octreeDrawable = false;
+    structureVersion++;
+    gameObject->deleteComponentByName(name);
+}
+
+void Scene::stopTrajectoryRecording(const char *reason) {
+    if (trajectoryRecorder != nullptr && trajectoryRecorder->isRecording()) {
+        std::cerr << "Trajectory recording stopped, " << reason << std::endl;
+        trajectoryRecorder->stop();
+    }
+}
+
 GameObject *Scene::createGameObject(std::string name) {
     for (auto &meshName: Mesh::meshNamesList) {
         if (meshName == name) {
             GameObject *gameObject = new GameObject(this, Mesh::createMesh(name.c_str()));
+            octreeDrawable = false;
+            structureVersion++;
             gameObjects.emplace_back(gameObject);
             return gameObject;
         }
     }
+    return nullptr;
 }
 
 void Scene::cleanParticleColliders() {
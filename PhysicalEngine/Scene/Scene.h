@@ -1,22 +1,39 @@
 #ifndef SCENE_H
 #define SCENE_H
 
+#include <cstdint>
 #include <vector>
 
 #include "../Octree/Octree.h"
 #include "../ParticleContact/ContactGenerator/ParticleCollide.h"
+#include "../ParticleContact/ParticleConstraint/ParticleConstraintSolver.h"
 #include "../ParticleContact/ParticleContactResolver.h"
 #include "../ParticleContact/ParticlesContactGeneratorRegistry.h"
+#include "../Utility/JobSystem.h"
+#include "../Utility/Profiler.h"
 #include "../Utility/Vector3d.h"
 //#include "Axis.h"
 #include "Camera.h"
+#include "InstancedRenderer.h"
 #include "PhysicHandler.h"
+#include "RenderSnapshot.h"
 
 #define PHYSIC_UPDATE_PER_SECOND 50
+#define MAX_STEPS_PER_FRAME 8
+#define RENDER_CLUSTER_SIZE 32
+#define RENDER_CLUSTER_SORT_INTERVAL 64
 
 class GameObject;
 
+class TrajectoryRecorder;
+
 class Scene {
+    // Reads and writes the simulation state directly
+    friend class SceneSnapshot;
+
+    // Adds the loaded objects and links in bulk
+    friend class SceneLoader;
+
 private:
     // Window size
     int windowHeight, windowWidth;
@@ -26,10 +43,14 @@ private:
     Camera camera;
     PhysicHandler physicHandler;
     std::vector<GameObject *> gameObjects;
+    // Worker threads of the parallel stages, declared before the stages that use it
+    JobSystem jobSystem;
     ParticleContactGeneratorRegistry particleContactGeneratorRegistry = ParticleContactGeneratorRegistry(1000000);
-    ParticleContactResolver particleContactResolver = ParticleContactResolver(2000000);
+    ParticleContactResolver particleContactResolver{ 2000000, jobSystem };
     ParticleCollide particleCollide;
+    ParticleConstraintSolver particleConstraintSolver{ jobSystem };
     Octree octree;
+    Profiler profiler;
 
 
     // View settings
@@ -39,7 +60,39 @@ private:
     // OpenGL framebuffer
     unsigned int fbo;
 
+    // Draws the objects with one instanced draw call per geometry
+    InstancedRenderer renderer;
+
+    // Frustum culling through the octree: the objects without rigidbody collider are tested one by one. The octree
+    // of the last step is only read until objects are added, removed or moved outside of a step
+    bool frustumCulling = true;
+    bool octreeDrawable = false;
+    std::size_t octreeObjectCount = 0;
+    real octreeDrawMargin = 0;
+    std::vector<GameObject *> unindexedGameObjects;
+    std::vector<Object *> visibleObjects;
+    std::vector<GameObject *> visibleGameObjects;
+    std::vector<const Matrix34 *> visibleMatrices;
+
+    // Order of the render snapshot clusters, sorted along a Morton curve when objects are added or removed and every
+    // RENDER_CLUSTER_SORT_INTERVAL steps, the bounds of the clusters are computed again at every capture
+    std::vector<std::pair<std::uint32_t, unsigned int>> renderClusterKeys;
+    std::vector<unsigned int> renderClusterOrder;
+    unsigned long long renderClusterVersion = 0;
+    unsigned long long renderClusterStep = 0;
+    // Bounds and objects tested by the last draw of a snapshot
+    std::size_t visibilityTestCount = 0;
+
+    // Incremented when objects are added, removed or recreated, a render snapshot only applies to its version
+    unsigned long long structureVersion = 0;
+
+    // Fixed step of the deterministic mode, and the frame time not simulated yet
+    float fixedTimeStep = 1.0f / PHYSIC_UPDATE_PER_SECOND;
     float physicalUpdateTimer = 0;
+    unsigned long long stepCount = 0;
+
+    // Receives the state of the bodies at the end of every step, not owned
+    TrajectoryRecorder *trajectoryRecorder = nullptr;
 
 public:
     Scene(int windowWidth, int windowHeight);
@@ -51,15 +104,73 @@ public:
     void destroy();
 
 public:
+    /// <summary>
+    /// Met à jour la caméra puis la physique : un pas de deltaTime, ou en mode déterministe autant de pas fixes
+    /// que le temps écoulé en contient
+    /// </summary>
     void update(float deltaTime);
 
+    /// <summary>
+    /// Met à jour la physique seule, pour un thread physique qui laisse la caméra au thread de dessin
+    /// </summary>
+    void updatePhysics(float deltaTime);
+
+    /// <summary>
+    /// Un pas de simulation (composants, forces, contraintes, contacts)
+    /// </summary>
+    void step(float deltaTime);
+
+    /// <summary>
+    /// Dessine les gameObjects dans le champ de la caméra
+    /// </summary>
     void draw(int display_w, int display_h);
 
+    /// <summary>
+    /// Dessine avec les matrices d'un RenderSnapshot au lieu des transformations, sans rien lire de ce que le thread
+    /// physique modifie. false si le snapshot ne correspond plus aux objets de la scène (rien n'est dessiné)
+    /// </summary>
+    bool draw(int display_w, int display_h, const RenderSnapshot &snapshot);
+
+    /// <summary>
+    /// Copie les matrices monde de tous les gameObjects et les groupe par proximité pour le test de visibilité,
+    /// avec le profiler et le hash du pas (mode déterministe) affichés par l'interface, à appeler entre deux pas
+    /// </summary>
+    void captureRenderSnapshot(RenderSnapshot &snapshot);
+
+    /// <summary>
+    /// Signale des objets déplacés hors d'un pas : jusqu'au prochain pas, draw teste chaque gameObject sur sa sphère
+    /// englobante au lieu de l'octree
+    /// </summary>
+    void invalidateOctree();
+
     void updateViewport(int width, int height);
 
 public:
     void addGameObject(GameObject *gameObject);
 
+private:
+    /// <summary>
+    /// Trie les gameObjects selon la courbe de Morton de leurs positions dans le snapshot
+    /// </summary>
+    void sortRenderClusters(const RenderSnapshot &snapshot);
+
+    /// <summary>
+    /// Insère les colliders rigides dans l'octree vidé et liste les gameObjects sans collider rigide
+    /// </summary>
+    void insertOctreeObjects();
+
+    void simulate(float deltaTime);
+
+    void drawVisibleObjects(int display_h);
+
+    /// <summary>
+    /// Arrête l'enregistrement des trajectoires en cours avant la suppression de composants physiques,
+    /// l'enregistreur garde des pointeurs vers les corps enregistrés
+    /// </summary>
+    void stopTrajectoryRecording(const char *reason);
+
+public:
+
     //    void translateCamera(const Vector3d& vector3D);
 
     //    void rotateCamera(Vector3d vector3D, float angle);
@@ -91,8 +202,64 @@ public:
 
     Camera *getCameraPtr();
 
+    PhysicHandler *getPhysicHandlerPtr();
+
+    ParticleConstraintSolver *getParticleConstraintSolverPtr();
+
+    const Profiler &getProfiler() const;
+
+    /// <summary>
+    /// Appels de dessin du dernier draw, un par géométrie affichée
+    /// </summary>
+    unsigned int getDrawCallCount() const;
+
+    /// <summary>
+    /// Objets dessinés au dernier draw, après l'élimination de ceux hors du champ de la caméra
+    /// </summary>
+    std::size_t getDrawnObjectCount() const;
+
+    /// <summary>
+    /// Boîtes de groupes et sphères d'objets testées contre le champ de la caméra au dernier draw d'un RenderSnapshot
+    /// </summary>
+    std::size_t getVisibilityTestCount() const;
+
+    /// <summary>
+    /// Sommets envoyés au dernier draw, après le choix des niveaux de détail
+    /// </summary>
+    std::size_t getDrawnVertexCount() const;
+
+    bool *getPtrLevelOfDetail();
+
+    bool *getPtrFrustumCulling();
+
+    unsigned long long getStructureVersion() const;
+
+    void setFixedTimeStep(float timeStep);
+
+    float getFixedTimeStep() const;
+
+    unsigned long long getStepCount() const;
+
+    void setTrajectoryRecorder(TrajectoryRecorder *recorder);
+
+    TrajectoryRecorder *getTrajectoryRecorder() const;
+
+    /// <summary>
+    /// Empreinte de l'état simulé (positions, vitesses, orientations dans l'ordre des gameObjects),
+    /// identique bit à bit entre deux exécutions déterministes
+    /// </summary>
+    std::uint64_t getStateHash() const;
+
     void deleteGameObject(GameObject *gameObject);
 
+    /// <summary>
+    /// Supprime le composant de ce nom du gameObject, en retirant d'abord les références de la scène vers lui
+    /// </summary>
+    void deleteComponent(GameObject *gameObject, const std::string &name);
+
+    /// <summary>
+    /// Ajoute un objet avec le maillage de ce nom (Mesh::meshNamesList), nullptr si le nom est inconnu
+    /// </summary>
     GameObject *createGameObject(std::string name);
 };
 
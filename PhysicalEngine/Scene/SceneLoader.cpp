@@ -0,0 +1,517 @@
+#include "SceneLoader.h"
+
+#include "../Force/AnchoredSpring.h"
+#include "../Force/Buoyancy.h"
+#include "../Force/Drag.h"
+#include "../Force/Spring.h"
+#include "../Integrator/Integrator.h"
+#include "Components/Collider/ParticleCollider/ParticleCollider.h"
+#include "Components/Collider/RigidbodyCollider/RigidbodyCuboidRectangleCollider/RigidbodyCuboidRectangleCollider.h"
+#include "Components/Collider/RigidbodyCollider/RigidbodyPlaneCollider/RigidbodyPlaneCollider.h"
+#include "Components/Collider/RigidbodyCollider/RigidbodySphereCollider/RigidbodySphereCollider.h"
+#include "Components/Mesh/Cuboid/CuboidRectangle.h"
+#include "Components/Mesh/Cylinder/Cylinder.h"
+#include "Components/Mesh/Sphere/Sphere.h"
+#include "Components/PhysicalComponent/Particle/Particle.h"
+#include "Components/PhysicalComponent/Rigidbody/Rigidbody.h"
+#include "GameObject.h"
+#include "Scene.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    struct Line {
+        unsigned int number;
+        std::size_t firstToken;
+        std::size_t tokenCount;
+    };
+
+    class Parser {
+    public:
+        std::vector<char *> tokens;
+        std::vector<Line> lines;
+
+        // Splits the text in place: the separators become '\0' so that the tokens are read without copies
+        void tokenize(std::string &text) {
+            std::size_t lineCount = 1;
+            for (char c: text) {
+                if (c == '\n')
+                    lineCount++;
+            }
+            lines.reserve(lineCount);
+            // Rough guess, a scene line holds a few tens of fields
+            tokens.reserve(lineCount * 16);
+
+            char *position = &text[0];
+            char *end = position + text.size();
+            unsigned int number = 1;
+            while (position < end) {
+                Line line{ number++, tokens.size(), 0 };
+                bool comment = false;
+                while (position < end && *position != '\n') {
+                    char c = *position;
+                    if (c == '#')
+                        comment = true;
+                    if (comment || c == ' ' || c == '\t' || c == '\r') {
+                        *position++ = '\0';
+                        continue;
+                    }
+                    tokens.push_back(position);
+                    while (position < end && *position != '\n' && *position != ' ' && *position != '\t' &&
+                           *position != '\r' && *position != '#') {
+                        position++;
+                    }
+                }
+                if (position < end)
+                    *position++ = '\0';
+                line.tokenCount = tokens.size() - line.firstToken;
+                if (line.tokenCount > 0)
+                    lines.push_back(line);
+            }
+        }
+
+        const char *token(const Line &line, std::size_t index) const {
+            return tokens[line.firstToken + index];
+        }
+
+        bool is(const Line &line, std::size_t index, const char *keyword) const {
+            return index < line.tokenCount && std::strcmp(token(line, index), keyword) == 0;
+        }
+
+        bool readReals(const Line &line, std::size_t index, real *values, std::size_t count) const {
+            if (index + count > line.tokenCount) {
+                error(line, "missing values");
+                return false;
+            }
+            for (std::size_t i = 0; i < count; i++) {
+                const char *text = token(line, index + i);
+                char *end = nullptr;
+                values[i] = static_cast<real>(std::strtod(text, &end));
+                if (*end != '\0') {
+                    error(line, "invalid number");
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void error(const Line &line, const char *message) const {
+            std::cerr << "SceneLoader: line " << line.number << ": " << message << std::endl;
+        }
+    };
+
+    struct LoadedObject {
+        GameObject *gameObject;
+        PhysicalComponent *physicalComponent;
+        Rigidbody *rigidbody;
+        Particle *particle;
+        // Line of the object, for the errors found after the object pass
+        const Line *line;
+    };
+
+    // Number of dimensions following the mesh type, 0 for an unknown type
+    std::size_t getMeshDimensionCount(const char *type) {
+        if (std::strcmp(type, "sphere") == 0)
+            return 1;
+        if (std::strcmp(type, "cuboid") == 0)
+            return 3;
+        if (std::strcmp(type, "cylinder") == 0)
+            return 2;
+        return 0;
+    }
+
+    // The mesh field of an object line, a unit sphere for a particle and a unit cube otherwise
+    Mesh *createMesh(const Parser &parser, const Line &line, bool isParticle) {
+        for (std::size_t index = 3; index + 1 < line.tokenCount; index++) {
+            if (!parser.is(line, index, "mesh"))
+                continue;
+            const char *type = parser.token(line, index + 1);
+            real dimensions[3];
+            std::size_t dimensionCount = getMeshDimensionCount(type);
+            if (dimensionCount == 0) {
+                parser.error(line, "unknown mesh");
+                return nullptr;
+            }
+            if (!parser.readReals(line, index + 2, dimensions, dimensionCount))
+                return nullptr;
+            if (dimensionCount == 1)
+                return new Sphere(dimensions[0]);
+            if (dimensionCount == 3)
+                return new CuboidRectangle(dimensions[0], dimensions[1], dimensions[2]);
+            return new Cylinder(dimensions[0], dimensions[1]);
+        }
+        if (isParticle)
+            return new Sphere(1);
+        return new CuboidRectangle(1, 1, 1);
+    }
+
+    bool addCollider(const Parser &parser, const Line &line, std::size_t &index, GameObject *gameObject) {
+        static const char *const colliderTypes[4] = { "particle", "sphere", "cuboid", "plane" };
+        static const std::size_t dimensionCounts[4] = { 1, 1, 3, 2 };
+        int type = 0;
+        while (type < 4 && !parser.is(line, index, colliderTypes[type])) {
+            type++;
+        }
+        if (type == 4) {
+            parser.error(line, "unknown collider");
+            return false;
+        }
+        real dimensions[3];
+        if (!parser.readReals(line, index + 1, dimensions, dimensionCounts[type]))
+            return false;
+        index += 1 + dimensionCounts[type];
+
+        switch (type) {
+            case 0:
+                gameObject->addComponent(new ParticleCollider(gameObject, dimensions[0]));
+                break;
+            case 1:
+                gameObject->addComponent(new RigidbodySphereCollider(gameObject, dimensions[0]));
+                break;
+            case 2:
+                gameObject->addComponent(
+                        new RigidbodyCuboidRectangleCollider(gameObject, dimensions[0], dimensions[1], dimensions[2]));
+                break;
+            default:
+                gameObject->addComponent(new RigidbodyPlaneCollider(gameObject, dimensions[0], dimensions[1]));
+                break;
+        }
+        return true;
+    }
+
+    // Fields of an object line after "object NAME TYPE", the mesh is already created and the parent is only
+    // returned since it may be declared further in the file
+    bool readObjectFields(const Parser &parser, const Line &line, const LoadedObject &object,
+                          const char *&parentName) {
+        GameObject *gameObject = object.gameObject;
+        PhysicalComponent *physicalComponent = object.physicalComponent;
+        real values[4];
+        std::size_t index = 3;
+        while (index < line.tokenCount) {
+            const char *key = parser.token(line, index++);
+            std::size_t valueCount = 0;
+            if (std::strcmp(key, "mesh") == 0 && index < line.tokenCount) {
+                // Already read by createMesh
+                valueCount = 1 + getMeshDimensionCount(parser.token(line, index));
+            } else if (std::strcmp(key, "collider") == 0) {
+                if (!addCollider(parser, line, index, gameObject))
+                    return false;
+            } else if (std::strcmp(key, "parent") == 0 && index < line.tokenCount) {
+                parentName = parser.token(line, index);
+                valueCount = 1;
+            } else if (std::strcmp(key, "position") == 0 || std::strcmp(key, "scale") == 0) {
+                valueCount = 3;
+                if (!parser.readReals(line, index, values, valueCount))
+                    return false;
+                if (key[0] == 'p')
+                    gameObject->transform.setPosition(values[0], values[1], values[2]);
+                else
+                    gameObject->transform.setScale(values[0], values[1], values[2]);
+            } else if (std::strcmp(key, "rotation") == 0 || std::strcmp(key, "color") == 0) {
+                valueCount = 4;
+                if (!parser.readReals(line, index, values, valueCount))
+                    return false;
+                if (key[0] == 'r')
+                    gameObject->transform.setRotation(Quaternion(values[0], values[1], values[2], values[3]));
+                else
+                    gameObject->getMesh()->setColor(glm::vec4(values[0], values[1], values[2], values[3]));
+            } else if (physicalComponent != nullptr &&
+                       (std::strcmp(key, "mass") == 0 || std::strcmp(key, "kinematic") == 0)) {
+                valueCount = 1;
+                if (!parser.readReals(line, index, values, valueCount))
+                    return false;
+                if (key[0] == 'm')
+                    physicalComponent->setMass(values[0]);
+                else
+                    physicalComponent->setIsKinematic(values[0] != 0);
+            } else if (physicalComponent != nullptr &&
+                       (std::strcmp(key, "speed") == 0 || std::strcmp(key, "gravity") == 0 ||
+                        (std::strcmp(key, "angularspeed") == 0 && object.rigidbody != nullptr))) {
+                valueCount = 3;
+                if (!parser.readReals(line, index, values, valueCount))
+                    return false;
+                Vector3d vector(values[0], values[1], values[2]);
+                if (key[0] == 's') {
+                    physicalComponent->setLinearSpeed(vector);
+                } else if (key[0] == 'a') {
+                    object.rigidbody->setAngularSpeed(vector);
+                } else {
+                    real parameters[ForceGenerator::PARAMETERS_COUNT] = { vector.x, vector.y, vector.z };
+                    physicalComponent->getGravity().setParameters(parameters);
+                }
+            } else {
+                parser.error(line, "unknown field for this object type");
+                return false;
+            }
+            index += valueCount;
+        }
+        return true;
+    }
+}
+
+bool SceneLoader::loadFromFile(const std::string &path, Scene &scene) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::cerr << "SceneLoader: cannot open " << path << std::endl;
+        return false;
+    }
+    // The whole file is read at once, the parser then works in place
+    std::string text(static_cast<std::size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    if (!text.empty() && !file.read(&text[0], static_cast<std::streamsize>(text.size()))) {
+        std::cerr << "SceneLoader: cannot read " << path << std::endl;
+        return false;
+    }
+    return load(text, scene);
+}
+
+bool SceneLoader::loadFromString(const std::string &text, Scene &scene) {
+    std::string copy = text;
+    return load(copy, scene);
+}
+
+bool SceneLoader::load(std::string &text, Scene &scene) {
+    Parser parser;
+    parser.tokenize(text);
+
+    // First pass: only counts, so that no container grows while loading
+    std::size_t objectCount = 0;
+    std::size_t linkCount = 0;
+    for (const Line &line: parser.lines) {
+        if (parser.is(line, 0, "object"))
+            objectCount++;
+        else if (parser.is(line, 0, "rod") || parser.is(line, 0, "cable"))
+            linkCount++;
+    }
+    std::vector<GameObject *> &gameObjects = scene.gameObjects;
+    scene.octreeDrawable = false;
+    scene.structureVersion++;
+    std::size_t firstObject = gameObjects.size();
+    gameObjects.reserve(firstObject + objectCount);
+    std::vector<LoadedObject> objects;
+    objects.reserve(objectCount);
+    std::vector<const char *> parentNames(objectCount, nullptr);
+    std::unordered_map<std::string, std::size_t> objectIndices;
+    objectIndices.reserve(objectCount);
+
+    // Second pass: the objects, without their OpenGL buffers
+    bool valid = true;
+    for (const Line &line: parser.lines) {
+        if (!parser.is(line, 0, "object"))
+            continue;
+        if (line.tokenCount < 3) {
+            parser.error(line, "an object needs a name and a type");
+            valid = false;
+            break;
+        }
+        const char *name = parser.token(line, 1);
+        bool isParticle = parser.is(line, 2, "particle");
+        bool isRigidbody = parser.is(line, 2, "rigidbody");
+        if (!isParticle && !isRigidbody && !parser.is(line, 2, "static")) {
+            parser.error(line, "unknown object type");
+            valid = false;
+            break;
+        }
+        if (!objectIndices.emplace(name, objects.size()).second) {
+            parser.error(line, "an object with this name already exists");
+            valid = false;
+            break;
+        }
+        Mesh *mesh = createMesh(parser, line, isParticle);
+        if (mesh == nullptr) {
+            valid = false;
+            break;
+        }
+        auto *gameObject = new GameObject(&scene, mesh, false);
+        gameObject->setName(name);
+        gameObjects.push_back(gameObject);
+
+        LoadedObject object{ gameObject, nullptr, nullptr, nullptr, &line };
+        if (isParticle) {
+            object.particle = new Particle(gameObject);
+            object.physicalComponent = object.particle;
+        } else if (isRigidbody) {
+            object.rigidbody = new Rigidbody(gameObject);
+            object.physicalComponent = object.rigidbody;
+        }
+        if (object.physicalComponent != nullptr)
+            gameObject->addComponent(object.physicalComponent);
+        objects.push_back(object);
+        if (!readObjectFields(parser, line, object, parentNames[objects.size() - 1])) {
+            valid = false;
+            break;
+        }
+    }
+
+    auto findObject = [&](const Line &line, std::size_t index) -> const LoadedObject * {
+        if (index >= line.tokenCount) {
+            parser.error(line, "missing object name");
+            return nullptr;
+        }
+        auto it = objectIndices.find(parser.token(line, index));
+        if (it == objectIndices.end()) {
+            parser.error(line, "unknown object name");
+            return nullptr;
+        }
+        return &objects[it->second];
+    };
+
+    // Third pass: the settings, forces and links, every object is known. The links and the settings are only
+    // applied to the scene once the whole file is valid.
+    struct Link {
+        Particle *particles[2];
+        real values[2];
+        bool isCable;
+    };
+    std::vector<Link> links;
+    links.reserve(linkCount);
+    int integrator = -1;
+    real timeStep = 0;
+    for (std::size_t i = 0; valid && i < parser.lines.size(); i++) {
+        const Line &line = parser.lines[i];
+        real values[6] = { 0, 0, 0, 0, 0, 0 };
+        if (parser.is(line, 0, "object")) {
+            continue;
+        } else if (parser.is(line, 0, "integrator")) {
+            static const char *const integrators[3] = { "euler", "verlet", "rk4" };
+            integrator = 0;
+            while (integrator < 3 && !parser.is(line, 1, integrators[integrator])) {
+                integrator++;
+            }
+            if (integrator == 3) {
+                parser.error(line, "unknown integrator");
+                valid = false;
+            }
+        } else if (parser.is(line, 0, "timestep")) {
+            valid = parser.readReals(line, 1, &timeStep, 1);
+        } else if (parser.is(line, 0, "rod") || parser.is(line, 0, "cable")) {
+            const LoadedObject *first = findObject(line, 1);
+            const LoadedObject *second = first != nullptr ? findObject(line, 2) : nullptr;
+            if (second == nullptr || !parser.readReals(line, 3, values, line.tokenCount > 4 ? 2 : 1)) {
+                valid = false;
+            } else if (first->particle == nullptr || second->particle == nullptr) {
+                parser.error(line, "links are only between particles");
+                valid = false;
+            } else {
+                links.push_back({ { first->particle, second->particle }, { values[0], values[1] },
+                                  parser.is(line, 0, "cable") });
+            }
+        } else if (parser.is(line, 0, "force")) {
+            const LoadedObject *object = findObject(line, 1);
+            if (object == nullptr) {
+                valid = false;
+                break;
+            }
+            if (object->physicalComponent == nullptr) {
+                parser.error(line, "forces are only applied to particles and rigidbodies");
+                valid = false;
+                break;
+            }
+            ForceGenerator *force = nullptr;
+            std::size_t index = 3;
+            if (parser.is(line, 2, "drag") && parser.readReals(line, index, values, 2)) {
+                force = new Drag(values[0], values[1]);
+                index += 2;
+            } else if (parser.is(line, 2, "anchoredspring") && parser.readReals(line, index, values, 5)) {
+                force = new AnchoredSpring(Vector3d(values[2], values[3], values[4]), values[0], values[1]);
+                index += 5;
+            } else if (parser.is(line, 2, "buoyancy") && parser.readReals(line, index, values, 4)) {
+                force = new Buoyancy(values[0], values[1], values[2], values[3]);
+                index += 4;
+            } else if (parser.is(line, 2, "spring")) {
+                const LoadedObject *other = findObject(line, index);
+                if (other != nullptr && parser.readReals(line, index + 1, values, 2)) {
+                    auto *spring = new Spring(object->gameObject, values[0], values[1]);
+                    spring->setOtherGameObject(other->gameObject);
+                    force = spring;
+                    index += 3;
+                }
+            } else if (!parser.is(line, 2, "drag") && !parser.is(line, 2, "anchoredspring") &&
+                       !parser.is(line, 2, "buoyancy")) {
+                parser.error(line, "unknown force");
+            }
+            if (force == nullptr) {
+                valid = false;
+                break;
+            }
+
+            // A force at a point of a rigidbody
+            real point[3];
+            if (parser.is(line, index, "at")) {
+                if (object->rigidbody == nullptr || !parser.readReals(line, index + 1, point, 3)) {
+                    if (object->rigidbody == nullptr)
+                        parser.error(line, "only a rigidbody has application points");
+                    delete force;
+                    valid = false;
+                    break;
+                }
+                object->rigidbody->addForceToPointList(force, Vector3d(point[0], point[1], point[2]));
+                index += 4;
+            } else {
+                object->physicalComponent->addForceToList(force);
+            }
+            if (index != line.tokenCount) {
+                parser.error(line, "unexpected fields after the force");
+                valid = false;
+            }
+        } else {
+            parser.error(line, "unknown line type");
+            valid = false;
+        }
+    }
+    // Parents already set, they never form a cycle so the walk up a chain always ends
+    const std::size_t noParent = objects.size();
+    std::vector<std::size_t> parentIndices(objects.size(), noParent);
+    for (std::size_t i = 0; valid && i < objects.size(); i++) {
+        if (parentNames[i] == nullptr)
+            continue;
+        auto it = objectIndices.find(parentNames[i]);
+        if (it == objectIndices.end()) {
+            std::cerr << "SceneLoader: unknown parent " << parentNames[i] << std::endl;
+            valid = false;
+            break;
+        }
+        std::size_t ancestor = it->second;
+        while (ancestor != noParent && ancestor != i) {
+            ancestor = parentIndices[ancestor];
+        }
+        if (ancestor == i) {
+            const std::string message = std::string("the parent ") + parentNames[i] + " of " +
+                                        parser.token(*objects[i].line, 1) + " is one of its descendants";
+            parser.error(*objects[i].line, message.c_str());
+            valid = false;
+            break;
+        }
+        parentIndices[i] = it->second;
+        objects[i].gameObject->setParent(objects[it->second].gameObject);
+    }
+
+    if (!valid) {
+        // Nothing is kept from a file with an error, the objects have no buffer yet
+        for (std::size_t i = firstObject; i < gameObjects.size(); i++) {
+            delete gameObjects[i];
+        }
+        gameObjects.resize(firstObject);
+        return false;
+    }
+
+    GameObject::createBuffers(gameObjects.data() + firstObject, gameObjects.size() - firstObject);
+    ParticleConstraintSolver &constraintSolver = scene.particleConstraintSolver;
+    constraintSolver.reserve(static_cast<unsigned int>(links.size()));
+    for (const Link &link: links) {
+        if (link.isCable)
+            constraintSolver.addCable(link.particles[0], link.particles[1], link.values[0], link.values[1]);
+        else
+            constraintSolver.addRode(link.particles[0], link.particles[1], link.values[0], link.values[1]);
+    }
+    if (integrator >= 0)
+        scene.physicHandler.setIntegrator(Integrator::integratorsNamesList[integrator]);
+    if (timeStep > 0)
+        scene.setFixedTimeStep(timeStep);
+    return true;
+}
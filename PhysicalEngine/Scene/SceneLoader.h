@@ -0,0 +1,38 @@
+#ifndef SCENELOADER_H
+#define SCENELOADER_H
+
+#include <string>
+
+class Scene;
+
+/// <summary>
+/// Chargement d'un fichier de scène texte (objets, maillages, colliders, forces et liens) ajouté en masse à la scène.
+/// Une ligne par élément, les champs séparés par des espaces, '#' commence un commentaire :
+///   integrator euler|verlet|rk4
+///   timestep DT
+///   object NOM particle|rigidbody|static [mesh sphere R | mesh cuboid L H P | mesh cylinder R H]
+///          [position X Y Z] [rotation W X Y Z] [scale X Y Z] [color R G B A] [mass M] [kinematic 0|1]
+///          [speed X Y Z] [angularspeed X Y Z] [gravity X Y Z] [parent NOM]
+///          [collider particle R | collider sphere R | collider cuboid DEMI_L DEMI_H DEMI_P | collider plane L P]...
+///   force NOM drag K1 K2
+///   force NOM anchoredspring K LONGUEUR X Y Z [at PX PY PZ]
+///   force NOM spring AUTRE K LONGUEUR [at PX PY PZ]
+///   force NOM buoyancy PROFONDEUR VOLUME HAUTEUR DENSITE
+///   rod|cable NOM1 NOM2 LONGUEUR [COMPLIANCE]
+/// Les noms peuvent être utilisés avant la ligne de leur objet. Une première passe compte les éléments pour
+/// réserver tous les conteneurs, puis les buffers OpenGL de tous les objets sont créés en un seul lot.
+/// </summary>
+class SceneLoader {
+public:
+    /// <summary>
+    /// Ajoute les éléments du fichier à la scène, rien n'est ajouté si le fichier contient une erreur
+    /// </summary>
+    static bool loadFromFile(const std::string &path, Scene &scene);
+
+    static bool loadFromString(const std::string &text, Scene &scene);
+
+private:
+    static bool load(std::string &text, Scene &scene);
+};
+
+#endif // SCENELOADER_H
@@ -0,0 +1,632 @@
+#include "SceneSnapshot.h"
+
+#include "../Force/Spring.h"
+#include "../Integrator/Integrator.h"
+#include "Components/Collider/ParticleCollider/ParticleCollider.h"
+#include "Components/Collider/RigidbodyCollider/RigidbodyCuboidRectangleCollider/RigidbodyCuboidRectangleCollider.h"
+#include "Components/Collider/RigidbodyCollider/RigidbodyPlaneCollider/RigidbodyPlaneCollider.h"
+#include "Components/Collider/RigidbodyCollider/RigidbodySphereCollider/RigidbodySphereCollider.h"
+#include "Components/Mesh/Cuboid/CuboidRectangle.h"
+#include "Components/Mesh/Cylinder/Cylinder.h"
+#include "Components/Mesh/Sphere/Sphere.h"
+#include "Components/PhysicalComponent/Particle/Particle.h"
+#include "Components/PhysicalComponent/Rigidbody/Rigidbody.h"
+#include "GameObject.h"
+#include "Scene.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace {
+    constexpr std::size_t SECTION_ALIGNMENT = 16;
+
+    std::size_t alignSection(std::size_t offset) {
+        return (offset + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+    }
+
+    struct ObjectComponents {
+        std::uint32_t flags = 0;
+        PhysicalComponent *physicalComponent = nullptr;
+        Particle *particle = nullptr;
+        Rigidbody *rigidbody = nullptr;
+        ParticleCollider *particleCollider = nullptr;
+        RigidbodySphereCollider *sphereCollider = nullptr;
+        RigidbodyCuboidRectangleCollider *cuboidCollider = nullptr;
+        RigidbodyPlaneCollider *planeCollider = nullptr;
+    };
+
+    ObjectComponents findComponents(GameObject *gameObject) {
+        ObjectComponents found;
+        for (Component *component: gameObject->getComponents()) {
+            if (auto *particle = dynamic_cast<Particle *>(component)) {
+                found.particle = particle;
+                found.physicalComponent = particle;
+                found.flags |= SNAPSHOT_COMPONENT_PARTICLE;
+            } else if (auto *rigidbody = dynamic_cast<Rigidbody *>(component)) {
+                found.rigidbody = rigidbody;
+                found.physicalComponent = rigidbody;
+                found.flags |= SNAPSHOT_COMPONENT_RIGIDBODY;
+            } else if (auto *particleCollider = dynamic_cast<ParticleCollider *>(component)) {
+                found.particleCollider = particleCollider;
+                found.flags |= SNAPSHOT_COMPONENT_PARTICLE_COLLIDER;
+            } else if (auto *sphereCollider = dynamic_cast<RigidbodySphereCollider *>(component)) {
+                found.sphereCollider = sphereCollider;
+                found.flags |= SNAPSHOT_COMPONENT_SPHERE_COLLIDER;
+            } else if (auto *cuboidCollider = dynamic_cast<RigidbodyCuboidRectangleCollider *>(component)) {
+                found.cuboidCollider = cuboidCollider;
+                found.flags |= SNAPSHOT_COMPONENT_CUBOID_COLLIDER;
+            } else if (auto *planeCollider = dynamic_cast<RigidbodyPlaneCollider *>(component)) {
+                found.planeCollider = planeCollider;
+                found.flags |= SNAPSHOT_COMPONENT_PLANE_COLLIDER;
+            }
+        }
+        return found;
+    }
+
+    // The counts come from the name lists, a new force, mesh or integrator is stored without other change
+    template<std::size_t N>
+    int findName(const char *(&names)[N], const std::string &name) {
+        for (std::size_t i = 0; i < N; i++) {
+            if (name == names[i])
+                return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    // Index of a name list read from a snapshot, -1 stands for none
+    template<std::size_t N>
+    bool isNameIndex(const char *(&)[N], std::int32_t index) {
+        return index >= -1 && index < static_cast<std::int32_t>(N);
+    }
+
+    int getForceType(const ForceGenerator *forceGenerator) {
+        return findName(ForceGenerator::forcesNamesList, forceGenerator->getName());
+    }
+
+    unsigned int getForceCount(const ObjectComponents &components) {
+        if (components.physicalComponent == nullptr)
+            return 0;
+        size_t count = components.physicalComponent->getForceGenerators().size();
+        if (components.rigidbody != nullptr)
+            count += components.rigidbody->getPointForces().size();
+        return static_cast<unsigned int>(count);
+    }
+
+    Mesh *createMesh(const SnapshotObject &object) {
+        const real *dimensions = object.meshDimensions;
+        Mesh *mesh = nullptr;
+        switch (object.meshType) {
+            case 0:
+                mesh = new Cylinder(dimensions[0], dimensions[1]);
+                break;
+            case 1:
+                mesh = new Sphere(dimensions[0]);
+                break;
+            case 2:
+                mesh = new CuboidRectangle(dimensions[0], dimensions[1], dimensions[2]);
+                break;
+            default:
+                return nullptr;
+        }
+        mesh->setColor(glm::vec4(object.color[0], object.color[1], object.color[2], object.color[3]));
+        return mesh;
+    }
+
+    void storeVector(real *destination, const Vector3d &vector) {
+        destination[0] = vector.x;
+        destination[1] = vector.y;
+        destination[2] = vector.z;
+    }
+
+    Vector3d loadVector(const real *source) {
+        return { source[0], source[1], source[2] };
+    }
+
+    void fillForce(SnapshotForce &record, const ForceGenerator *forceGenerator, std::int32_t otherObject) {
+        record.type = getForceType(forceGenerator);
+        record.otherObject = otherObject;
+        forceGenerator->getParameters(record.parameters);
+    }
+}
+
+SceneSnapshot::SceneSnapshot(const SceneSnapshot &snapshot) {
+    *this = snapshot;
+}
+
+SceneSnapshot &SceneSnapshot::operator=(const SceneSnapshot &snapshot) {
+    if (this == &snapshot)
+        return *this;
+    storage = snapshot.storage;
+    size = snapshot.size;
+    // A copied view keeps pointing to the external memory, a copied blob points to its own storage
+    data = snapshot.data == snapshot.storage.data() ? storage.data() : snapshot.data;
+    return *this;
+}
+
+void SceneSnapshot::capture(Scene &scene) {
+    std::vector<GameObject *> &gameObjects = scene.getGameObjects();
+    // The constraints of the deleted particles are not stored
+    scene.particleConstraintSolver.compact();
+    const ParticleConstraintSolver &constraintSolver = scene.particleConstraintSolver;
+
+    // Links (parents, springs, constraints) are stored as object indices
+    objectLookup.clear();
+    unsigned int forceCount = 0;
+    for (size_t i = 0; i < gameObjects.size(); i++) {
+        auto index = static_cast<std::int32_t>(i);
+        ObjectComponents components = findComponents(gameObjects[i]);
+        objectLookup.emplace_back(gameObjects[i], index);
+        objectLookup.emplace_back(&gameObjects[i]->transform, index);
+        if (components.particle != nullptr)
+            objectLookup.emplace_back(components.particle, index);
+        forceCount += getForceCount(components);
+    }
+    std::sort(objectLookup.begin(), objectLookup.end());
+
+    const std::vector<ParticleDistanceConstraint> &constraints = constraintSolver.getConstraints();
+    auto objectCount = static_cast<unsigned int>(gameObjects.size());
+    auto constraintCount = static_cast<unsigned int>(constraints.size());
+    std::size_t objectsOffset = alignSection(sizeof(SnapshotHeader));
+    std::size_t forcesOffset = alignSection(objectsOffset + objectCount * sizeof(SnapshotObject));
+    std::size_t constraintsOffset = alignSection(forcesOffset + forceCount * sizeof(SnapshotForce));
+    std::size_t totalSize = alignSection(constraintsOffset + constraintCount * sizeof(SnapshotConstraint));
+    storage.assign(totalSize, 0);
+    data = storage.data();
+    size = totalSize;
+
+    auto *header = reinterpret_cast<SnapshotHeader *>(storage.data());
+    header->magic = SCENE_SNAPSHOT_MAGIC;
+    header->version = SCENE_SNAPSHOT_VERSION;
+    header->scalarSize = sizeof(real);
+    header->headerSize = sizeof(SnapshotHeader);
+    header->objectRecordSize = sizeof(SnapshotObject);
+    header->forceRecordSize = sizeof(SnapshotForce);
+    header->constraintRecordSize = sizeof(SnapshotConstraint);
+    Integrator *integrator = scene.physicHandler.getIntegrator();
+    header->integrator = integrator != nullptr ? findName(Integrator::integratorsNamesList, integrator->getName())
+                                               : -1;
+    header->objectCount = objectCount;
+    header->forceCount = forceCount;
+    header->constraintCount = constraintCount;
+    header->fixedTimeStep = scene.fixedTimeStep;
+    header->physicalUpdateTimer = scene.physicalUpdateTimer;
+    header->constraintIterations = scene.particleConstraintSolver.getIterations();
+    header->stepCount = scene.stepCount;
+    header->objectsOffset = objectsOffset;
+    header->forcesOffset = forcesOffset;
+    header->constraintsOffset = constraintsOffset;
+    header->totalSize = totalSize;
+
+    auto *objects = reinterpret_cast<SnapshotObject *>(storage.data() + objectsOffset);
+    auto *forces = reinterpret_cast<SnapshotForce *>(storage.data() + forcesOffset);
+    unsigned int forceIndex = 0;
+    for (unsigned int i = 0; i < objectCount; i++) {
+        GameObject *gameObject = gameObjects[i];
+        ObjectComponents components = findComponents(gameObject);
+        SnapshotObject &object = objects[i];
+        object.components = components.flags;
+        object.parent = findObject(gameObject->transform.getParent());
+
+        Mesh *mesh = gameObject->getMesh();
+        object.meshType = mesh != nullptr ? findName(Mesh::meshNamesList, mesh->getMeshType()) : -1;
+        if (mesh != nullptr) {
+            glm::vec4 color = mesh->getColor();
+            std::memcpy(object.color, &color[0], sizeof(object.color));
+            storeVector(object.meshDimensions, mesh->getDimensions());
+        }
+
+        storeVector(object.position, gameObject->transform.getPosition());
+        storeVector(object.scale, gameObject->transform.getScale());
+        Quaternion rotation = gameObject->transform.getRotation();
+        for (int j = 0; j < 4; j++) {
+            object.rotation[j] = rotation[j];
+        }
+
+        object.firstForce = forceIndex;
+        object.forceCount = getForceCount(components);
+        if (components.physicalComponent != nullptr) {
+            PhysicalComponent *physicalComponent = components.physicalComponent;
+            PhysicalState state = physicalComponent->getState();
+            storeVector(object.linearSpeed, state.linearSpeed);
+            storeVector(object.angularSpeed, state.angularSpeed);
+            physicalComponent->getGravity().getParameters(object.gravity);
+            object.mass = physicalComponent->getMass();
+            object.isKinematic = physicalComponent->getIsKinematic() ? 1 : 0;
+
+            for (ForceGenerator *forceGenerator: physicalComponent->getForceGenerators()) {
+                auto *spring = dynamic_cast<Spring *>(forceGenerator);
+                fillForce(forces[forceIndex++], forceGenerator,
+                          spring != nullptr ? findObject(spring->getOtherGameObject()) : -1);
+            }
+            if (components.rigidbody != nullptr) {
+                for (const ForcePoint &forcePoint: components.rigidbody->getPointForces()) {
+                    SnapshotForce &force = forces[forceIndex++];
+                    fillForce(force, forcePoint.force, -1);
+                    force.atPoint = 1;
+                    storeVector(force.point, forcePoint.point);
+                }
+            }
+        }
+
+        if (components.particleCollider != nullptr)
+            object.particleColliderRadius = components.particleCollider->getRadius();
+        if (components.sphereCollider != nullptr) {
+            object.colliderDimensions[0] = components.sphereCollider->getRadius();
+        } else if (components.cuboidCollider != nullptr) {
+            object.colliderDimensions[0] = components.cuboidCollider->m_halfwidth;
+            object.colliderDimensions[1] = components.cuboidCollider->m_halfheight;
+            object.colliderDimensions[2] = components.cuboidCollider->m_halfdepth;
+        } else if (components.planeCollider != nullptr) {
+            object.colliderDimensions[0] = components.planeCollider->getWidth();
+            object.colliderDimensions[1] = components.planeCollider->getDepth();
+        }
+    }
+
+    auto *constraintRecords = reinterpret_cast<SnapshotConstraint *>(storage.data() + constraintsOffset);
+    for (unsigned int i = 0; i < constraintCount; i++) {
+        const ParticleDistanceConstraint &constraint = constraints[i];
+        SnapshotConstraint &record = constraintRecords[i];
+        record.objects[0] = findObject(constraintSolver.getParticle(constraint.particles[0]));
+        record.objects[1] = findObject(constraintSolver.getParticle(constraint.particles[1]));
+        record.isCable = constraint.isCable ? 1 : 0;
+        record.restLength = constraint.restLength;
+        record.compliance = constraint.compliance;
+    }
+}
+
+bool SceneSnapshot::restore(Scene &scene) const {
+    if (!isValid()) {
+        std::cerr << "SceneSnapshot::restore: Invalid snapshot" << std::endl;
+        return false;
+    }
+    const SnapshotHeader *header = getHeader();
+
+    if (!matchesStructure(scene))
+        rebuild(scene);
+
+    std::vector<GameObject *> &gameObjects = scene.getGameObjects();
+    const SnapshotObject *objects = getObjects();
+    for (unsigned int i = 0; i < header->objectCount; i++) {
+        restoreObject(gameObjects[i], objects[i], gameObjects);
+    }
+    restoreConstraints(scene);
+
+    if (header->integrator >= 0) {
+        const char *integratorName = Integrator::integratorsNamesList[header->integrator];
+        Integrator *integrator = scene.physicHandler.getIntegrator();
+        if (integrator == nullptr || integrator->getName() != integratorName)
+            scene.physicHandler.setIntegrator(integratorName);
+    }
+    scene.fixedTimeStep = header->fixedTimeStep;
+    scene.physicalUpdateTimer = header->physicalUpdateTimer;
+    scene.particleConstraintSolver.setIterations(header->constraintIterations);
+    scene.stepCount = header->stepCount;
+    // The bodies moved, or were recreated, outside of a step
+    scene.octreeDrawable = false;
+    return true;
+}
+
+bool SceneSnapshot::matchesStructure(Scene &scene) const {
+    const SnapshotHeader *header = getHeader();
+    std::vector<GameObject *> &gameObjects = scene.getGameObjects();
+    if (gameObjects.size() != header->objectCount)
+        return false;
+    const SnapshotObject *objects = getObjects();
+    const SnapshotForce *forces = getForces();
+    for (unsigned int i = 0; i < header->objectCount; i++) {
+        ObjectComponents components = findComponents(gameObjects[i]);
+        const SnapshotObject &object = objects[i];
+        if (components.flags != object.components || getForceCount(components) != object.forceCount)
+            return false;
+        if (components.physicalComponent == nullptr)
+            continue;
+        const SnapshotForce *force = forces + object.firstForce;
+        for (ForceGenerator *forceGenerator: components.physicalComponent->getForceGenerators()) {
+            if (getForceType(forceGenerator) != (force++)->type)
+                return false;
+        }
+        if (components.rigidbody != nullptr) {
+            for (const ForcePoint &forcePoint: components.rigidbody->getPointForces()) {
+                if (getForceType(forcePoint.force) != force->type || loadVector(force->point) != forcePoint.point)
+                    return false;
+                force++;
+            }
+        }
+    }
+    return true;
+}
+
+void SceneSnapshot::restoreObject(GameObject *gameObject, const SnapshotObject &object,
+                                  const std::vector<GameObject *> &gameObjects) const {
+    ObjectComponents components = findComponents(gameObject);
+    gameObject->setParent(object.parent >= 0 ? gameObjects[object.parent] : nullptr);
+    gameObject->transform.setPosition(loadVector(object.position));
+    gameObject->transform.setRotation(
+            Quaternion(object.rotation[0], object.rotation[1], object.rotation[2], object.rotation[3]));
+    gameObject->transform.setScale(object.scale[0], object.scale[1], object.scale[2]);
+    if (gameObject->getMesh() != nullptr)
+        gameObject->getMesh()->setColor(glm::vec4(object.color[0], object.color[1], object.color[2], object.color[3]));
+
+    if (components.physicalComponent != nullptr) {
+        PhysicalComponent *physicalComponent = components.physicalComponent;
+        physicalComponent->setLinearSpeed(loadVector(object.linearSpeed));
+        if (components.rigidbody != nullptr)
+            components.rigidbody->setAngularSpeed(loadVector(object.angularSpeed));
+        physicalComponent->setMass(object.mass);
+        physicalComponent->setIsKinematic(object.isKinematic != 0);
+        physicalComponent->getGravity().setParameters(object.gravity);
+
+        const SnapshotForce *force = getForces() + object.firstForce;
+        for (ForceGenerator *forceGenerator: physicalComponent->getForceGenerators()) {
+            forceGenerator->setParameters(force->parameters);
+            if (auto *spring = dynamic_cast<Spring *>(forceGenerator))
+                spring->setOtherGameObject(force->otherObject >= 0 ? gameObjects[force->otherObject] : nullptr);
+            force++;
+        }
+        if (components.rigidbody != nullptr) {
+            for (const ForcePoint &forcePoint: components.rigidbody->getPointForces()) {
+                forcePoint.force->setParameters((force++)->parameters);
+            }
+        }
+    }
+
+    if (components.particleCollider != nullptr)
+        components.particleCollider->setRadius(object.particleColliderRadius);
+    if (components.sphereCollider != nullptr) {
+        components.sphereCollider->m_radius = object.colliderDimensions[0];
+    } else if (components.cuboidCollider != nullptr) {
+        components.cuboidCollider->m_halfwidth = object.colliderDimensions[0];
+        components.cuboidCollider->m_halfheight = object.colliderDimensions[1];
+        components.cuboidCollider->m_halfdepth = object.colliderDimensions[2];
+    } else if (components.planeCollider != nullptr) {
+        components.planeCollider->setWidth(object.colliderDimensions[0]);
+        components.planeCollider->setDepth(object.colliderDimensions[1]);
+    }
+}
+
+void SceneSnapshot::rebuild(Scene &scene) const {
+    std::vector<GameObject *> &gameObjects = scene.getGameObjects();
+    scene.stopTrajectoryRecording("the scene was rebuilt from a snapshot");
+    scene.particleConstraintSolver.clear();
+    for (GameObject *gameObject: gameObjects) {
+        delete gameObject;
+    }
+    gameObjects.clear();
+    scene.structureVersion++;
+
+    // Only the structure is created here, the values are written by restoreObject
+    const SnapshotHeader *header = getHeader();
+    const SnapshotObject *objects = getObjects();
+    const SnapshotForce *forces = getForces();
+    gameObjects.reserve(header->objectCount);
+    for (unsigned int i = 0; i < header->objectCount; i++) {
+        const SnapshotObject &object = objects[i];
+        Mesh *mesh = createMesh(object);
+        auto *gameObject = mesh != nullptr ? new GameObject(&scene, mesh) : new GameObject(&scene);
+
+        PhysicalComponent *physicalComponent = nullptr;
+        Rigidbody *rigidbody = nullptr;
+        if (object.components & SNAPSHOT_COMPONENT_PARTICLE) {
+            physicalComponent = new Particle(gameObject);
+            gameObject->addComponent(physicalComponent);
+        } else if (object.components & SNAPSHOT_COMPONENT_RIGIDBODY) {
+            rigidbody = new Rigidbody(gameObject);
+            physicalComponent = rigidbody;
+            gameObject->addComponent(rigidbody);
+        }
+        if (object.components & SNAPSHOT_COMPONENT_PARTICLE_COLLIDER)
+            gameObject->addComponent(new ParticleCollider(gameObject, object.particleColliderRadius));
+        const real *dimensions = object.colliderDimensions;
+        if (object.components & SNAPSHOT_COMPONENT_SPHERE_COLLIDER)
+            gameObject->addComponent(new RigidbodySphereCollider(gameObject, dimensions[0]));
+        if (object.components & SNAPSHOT_COMPONENT_CUBOID_COLLIDER)
+            gameObject->addComponent(
+                    new RigidbodyCuboidRectangleCollider(gameObject, dimensions[0], dimensions[1], dimensions[2]));
+        if (object.components & SNAPSHOT_COMPONENT_PLANE_COLLIDER)
+            gameObject->addComponent(new RigidbodyPlaneCollider(gameObject, dimensions[0], dimensions[1]));
+
+        if (physicalComponent != nullptr) {
+            for (unsigned int j = 0; j < object.forceCount; j++) {
+                const SnapshotForce &force = forces[object.firstForce + j];
+                if (force.type < 0)
+                    continue;
+                ForceGenerator *forceGenerator =
+                        ForceGenerator::createForceGenerator(ForceGenerator::forcesNamesList[force.type], gameObject);
+                if (force.atPoint != 0 && rigidbody != nullptr)
+                    rigidbody->addForceToPointList(forceGenerator, loadVector(force.point));
+                else
+                    physicalComponent->addForceToList(forceGenerator);
+            }
+        }
+        gameObjects.push_back(gameObject);
+    }
+}
+
+void SceneSnapshot::restoreConstraints(Scene &scene) const {
+    ParticleConstraintSolver &constraintSolver = scene.particleConstraintSolver;
+    std::vector<GameObject *> &gameObjects = scene.getGameObjects();
+    const SnapshotHeader *header = getHeader();
+    const SnapshotConstraint *records = getConstraints();
+    constraintSolver.compact();
+
+    // Constraints rarely change, they are only rebuilt when they differ from the snapshot
+    const std::vector<ParticleDistanceConstraint> &constraints = constraintSolver.getConstraints();
+    bool same = constraints.size() == header->constraintCount;
+    for (unsigned int i = 0; same && i < header->constraintCount; i++) {
+        const ParticleDistanceConstraint &constraint = constraints[i];
+        const SnapshotConstraint &record = records[i];
+        same = record.restLength == constraint.restLength && record.compliance == constraint.compliance &&
+               (record.isCable != 0) == constraint.isCable &&
+               record.objects[0] >= 0 && record.objects[1] >= 0 &&
+               constraintSolver.getParticle(constraint.particles[0])->getGameObject() == gameObjects[record.objects[0]] &&
+               constraintSolver.getParticle(constraint.particles[1])->getGameObject() == gameObjects[record.objects[1]];
+    }
+    if (same)
+        return;
+
+    constraintSolver.clear();
+    for (unsigned int i = 0; i < header->constraintCount; i++) {
+        const SnapshotConstraint &record = records[i];
+        if (record.objects[0] < 0 || record.objects[1] < 0)
+            continue;
+        Particle *particles[2] = { nullptr, nullptr };
+        gameObjects[record.objects[0]]->getComponentByClass(particles[0]);
+        gameObjects[record.objects[1]]->getComponentByClass(particles[1]);
+        if (record.isCable != 0)
+            constraintSolver.addCable(particles[0], particles[1], record.restLength, record.compliance);
+        else
+            constraintSolver.addRode(particles[0], particles[1], record.restLength, record.compliance);
+    }
+}
+
+bool SceneSnapshot::setView(const void *buffer, std::size_t bufferSize) {
+    if (!validate(static_cast<const unsigned char *>(buffer), bufferSize, true))
+        return false;
+    storage.clear();
+    data = static_cast<const unsigned char *>(buffer);
+    size = bufferSize;
+    return true;
+}
+
+bool SceneSnapshot::loadFromFile(const std::string &path) {
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        std::cerr << "SceneSnapshot::loadFromFile: Cannot open " << path << std::endl;
+        return false;
+    }
+    std::vector<unsigned char> content;
+    unsigned char buffer[4096];
+    std::size_t readSize;
+    while ((readSize = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        content.insert(content.end(), buffer, buffer + readSize);
+    }
+    std::fclose(file);
+    if (!validate(content.data(), content.size(), true))
+        return false;
+    storage.swap(content);
+    data = storage.data();
+    size = storage.size();
+    return true;
+}
+
+bool SceneSnapshot::saveToFile(const std::string &path) const {
+    if (!isValid())
+        return false;
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        std::cerr << "SceneSnapshot::saveToFile: Cannot open " << path << std::endl;
+        return false;
+    }
+    bool written = std::fwrite(data, 1, size, file) == size;
+    return std::fclose(file) == 0 && written;
+}
+
+bool SceneSnapshot::isValid() const {
+    // A blob is validated when it is loaded, a captured one is valid by construction
+    return data != nullptr;
+}
+
+bool SceneSnapshot::validate(const unsigned char *buffer, std::size_t bufferSize, bool verbose) {
+    const char *error = nullptr;
+    const auto *header = reinterpret_cast<const SnapshotHeader *>(buffer);
+    if (buffer == nullptr || bufferSize < sizeof(SnapshotHeader))
+        error = "buffer too small";
+    else if (reinterpret_cast<std::uintptr_t>(buffer) % alignof(SnapshotHeader) != 0)
+        error = "misaligned buffer";
+    else if (header->magic != SCENE_SNAPSHOT_MAGIC)
+        error = "not a scene snapshot";
+    else if (header->version != SCENE_SNAPSHOT_VERSION)
+        error = "unsupported version";
+    else if (header->scalarSize != sizeof(real))
+        error = "written with another precision";
+    else if (header->headerSize != sizeof(SnapshotHeader) || header->objectRecordSize != sizeof(SnapshotObject) ||
+             header->forceRecordSize != sizeof(SnapshotForce) ||
+             header->constraintRecordSize != sizeof(SnapshotConstraint))
+        error = "record layout mismatch";
+    else if (header->totalSize > bufferSize ||
+             header->objectsOffset + std::uint64_t(header->objectCount) * sizeof(SnapshotObject) > header->forcesOffset ||
+             header->forcesOffset + std::uint64_t(header->forceCount) * sizeof(SnapshotForce) > header->constraintsOffset ||
+             header->constraintsOffset + std::uint64_t(header->constraintCount) * sizeof(SnapshotConstraint) >
+             header->totalSize || header->objectsOffset < sizeof(SnapshotHeader))
+        error = "truncated snapshot";
+    else if (!isNameIndex(Integrator::integratorsNamesList, header->integrator))
+        error = "unknown integrator";
+
+    if (error == nullptr) {
+        // Links must point inside the snapshot
+        const auto *objects = reinterpret_cast<const SnapshotObject *>(buffer + header->objectsOffset);
+        const auto *forces = reinterpret_cast<const SnapshotForce *>(buffer + header->forcesOffset);
+        const auto *constraints = reinterpret_cast<const SnapshotConstraint *>(buffer + header->constraintsOffset);
+        auto objectCount = static_cast<std::int32_t>(header->objectCount);
+        for (std::uint32_t i = 0; error == nullptr && i < header->objectCount; i++) {
+            if (objects[i].parent < -1 || objects[i].parent >= objectCount ||
+                !isNameIndex(Mesh::meshNamesList, objects[i].meshType) ||
+                std::uint64_t(objects[i].firstForce) + objects[i].forceCount > header->forceCount)
+                error = "invalid object record";
+        }
+        // The parents must not loop, the world matrix of a transform walks up its parents.
+        // 1 marks the objects of the chain being walked, 2 the objects whose chain ends without loop.
+        std::vector<std::uint8_t> parentStates(error == nullptr ? header->objectCount : 0, 0);
+        for (std::int32_t i = 0; error == nullptr && i < objectCount; i++) {
+            std::int32_t ancestor = i;
+            while (ancestor >= 0 && parentStates[ancestor] == 0) {
+                parentStates[ancestor] = 1;
+                ancestor = objects[ancestor].parent;
+            }
+            if (ancestor >= 0 && parentStates[ancestor] == 1)
+                error = "cyclic object parents";
+            for (ancestor = i; ancestor >= 0 && parentStates[ancestor] == 1; ancestor = objects[ancestor].parent) {
+                parentStates[ancestor] = 2;
+            }
+        }
+        for (std::uint32_t i = 0; error == nullptr && i < header->forceCount; i++) {
+            if (forces[i].otherObject < -1 || forces[i].otherObject >= objectCount ||
+                !isNameIndex(ForceGenerator::forcesNamesList, forces[i].type))
+                error = "invalid force record";
+        }
+        for (std::uint32_t i = 0; error == nullptr && i < header->constraintCount; i++) {
+            if (constraints[i].objects[0] < -1 || constraints[i].objects[0] >= objectCount ||
+                constraints[i].objects[1] < -1 || constraints[i].objects[1] >= objectCount)
+                error = "invalid constraint record";
+        }
+    }
+
+    if (error != nullptr && verbose)
+        std::cerr << "SceneSnapshot: " << error << std::endl;
+    return error == nullptr;
+}
+
+std::int32_t SceneSnapshot::findObject(const void *pointer) const {
+    if (pointer == nullptr)
+        return -1;
+    auto it = std::lower_bound(objectLookup.begin(), objectLookup.end(), std::make_pair(pointer, std::int32_t(-1)));
+    if (it == objectLookup.end() || it->first != pointer)
+        return -1;
+    return it->second;
+}
+
+const unsigned char *SceneSnapshot::getData() const {
+    return data;
+}
+
+std::size_t SceneSnapshot::getSize() const {
+    return size;
+}
+
+const SnapshotHeader *SceneSnapshot::getHeader() const {
+    return reinterpret_cast<const SnapshotHeader *>(data);
+}
+
+const SnapshotObject *SceneSnapshot::getObjects() const {
+    return reinterpret_cast<const SnapshotObject *>(data + getHeader()->objectsOffset);
+}
+
+const SnapshotForce *SceneSnapshot::getForces() const {
+    return reinterpret_cast<const SnapshotForce *>(data + getHeader()->forcesOffset);
+}
+
+const SnapshotConstraint *SceneSnapshot::getConstraints() const {
+    return reinterpret_cast<const SnapshotConstraint *>(data + getHeader()->constraintsOffset);
+}
@@ -0,0 +1,162 @@
+#ifndef SCENESNAPSHOT_H
+#define SCENESNAPSHOT_H
+
+#include "../Force/ForceGenerator.h"
+#include "../Utility/Precision.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Scene;
+
+class GameObject;
+
+#define SCENE_SNAPSHOT_MAGIC 0x4e534550u // "PESN"
+#define SCENE_SNAPSHOT_VERSION 2u
+
+enum SnapshotComponent {
+    SNAPSHOT_COMPONENT_PARTICLE = 1 << 0,
+    SNAPSHOT_COMPONENT_RIGIDBODY = 1 << 1,
+    SNAPSHOT_COMPONENT_PARTICLE_COLLIDER = 1 << 2,
+    SNAPSHOT_COMPONENT_SPHERE_COLLIDER = 1 << 3,
+    SNAPSHOT_COMPONENT_CUBOID_COLLIDER = 1 << 4,
+    SNAPSHOT_COMPONENT_PLANE_COLLIDER = 1 << 5,
+};
+
+// Records of the blob, plain data read in place (every section starts on a 16 bytes boundary).
+// real is stored as is, a snapshot is only read back by a build with the same precision.
+
+struct SnapshotHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t scalarSize;
+    std::uint32_t headerSize;
+    std::uint32_t objectRecordSize;
+    std::uint32_t forceRecordSize;
+    std::uint32_t constraintRecordSize;
+    std::int32_t integrator; // Index in Integrator::integratorsNamesList
+    std::uint32_t objectCount;
+    std::uint32_t forceCount;
+    std::uint32_t constraintCount;
+    float fixedTimeStep;
+    float physicalUpdateTimer;
+    std::uint32_t constraintIterations; // Iterations of the ParticleConstraintSolver
+    std::uint64_t stepCount;
+    std::uint64_t objectsOffset;
+    std::uint64_t forcesOffset;
+    std::uint64_t constraintsOffset;
+    std::uint64_t totalSize;
+};
+
+struct SnapshotObject {
+    std::uint32_t components; // SnapshotComponent flags
+    std::int32_t meshType;    // Index in Mesh::meshNamesList, -1 without mesh
+    std::int32_t parent;      // Index of the parent object, -1 without parent
+    std::uint32_t isKinematic;
+    std::uint32_t firstForce;
+    std::uint32_t forceCount;
+    float color[4];
+    real meshDimensions[3];
+    real position[3];
+    real rotation[4];
+    real scale[3];
+    real linearSpeed[3];
+    real angularSpeed[3];
+    real gravity[3];
+    real mass;
+    real particleColliderRadius;
+    // Sphere radius, cuboid half sizes or plane width and depth
+    real colliderDimensions[3];
+};
+
+struct SnapshotForce {
+    std::int32_t type;        // Index in ForceGenerator::forcesNamesList
+    std::int32_t otherObject; // Other end of a Spring, -1 otherwise
+    std::uint32_t atPoint;    // Rigidbody force applied at point
+    std::uint32_t reserved;
+    real point[3];
+    real parameters[ForceGenerator::PARAMETERS_COUNT];
+};
+
+struct SnapshotConstraint {
+    std::int32_t objects[2];
+    std::uint32_t isCable;
+    std::uint32_t reserved;
+    real restLength;
+    real compliance;
+};
+
+/// <summary>
+/// Image binaire de l'état simulé d'une scène (transforms, vitesses, masses, forces, colliders, liens et contraintes).
+/// Le blob est plat et versionné : il peut être écrit tel quel dans un fichier, et relu en place depuis
+/// une zone mémoire (fichier mappé par exemple) sans copie.
+/// </summary>
+class SceneSnapshot {
+private:
+    std::vector<unsigned char> storage;
+    const unsigned char *data = nullptr;
+    std::size_t size = 0;
+
+    // Object index of every GameObject, Transform and Particle of the captured scene, sorted by address
+    std::vector<std::pair<const void *, std::int32_t>> objectLookup;
+
+public:
+    SceneSnapshot() = default;
+
+    SceneSnapshot(const SceneSnapshot &snapshot);
+
+    SceneSnapshot &operator=(const SceneSnapshot &snapshot);
+
+public:
+    /// <summary>
+    /// Capture l'état de la scène, le buffer est réutilisé d'une capture à l'autre
+    /// </summary>
+    void capture(Scene &scene);
+
+    /// <summary>
+    /// Remet la scène dans l'état capturé. Si la scène a la même structure (objets, composants, forces),
+    /// seules les valeurs sont réécrites, sinon les objets sont recréés depuis le snapshot.
+    /// </summary>
+    bool restore(Scene &scene) const;
+
+    /// <summary>
+    /// Utilise une zone mémoire externe sans la copier, elle doit rester valide tant que le snapshot l'utilise
+    /// </summary>
+    bool setView(const void *buffer, std::size_t bufferSize);
+
+    bool loadFromFile(const std::string &path);
+
+    bool saveToFile(const std::string &path) const;
+
+    bool isValid() const;
+
+    const unsigned char *getData() const;
+
+    std::size_t getSize() const;
+
+    const SnapshotHeader *getHeader() const;
+
+    const SnapshotObject *getObjects() const;
+
+    const SnapshotForce *getForces() const;
+
+    const SnapshotConstraint *getConstraints() const;
+
+private:
+    static bool validate(const unsigned char *buffer, std::size_t bufferSize, bool verbose);
+
+    std::int32_t findObject(const void *pointer) const;
+
+    bool matchesStructure(Scene &scene) const;
+
+    void restoreObject(GameObject *gameObject, const SnapshotObject &object,
+                       const std::vector<GameObject *> &gameObjects) const;
+
+    void rebuild(Scene &scene) const;
+
+    void restoreConstraints(Scene &scene) const;
+};
+
+#endif // SCENESNAPSHOT_H
@@ -0,0 +1,167 @@
+#include "TrajectoryPlayer.h"
+
+#include "GameObject.h"
+#include "Scene.h"
+#include "TrajectoryRecorder.h"
+#include "imgui/imgui.h"
+
+#include <cstring>
+#include <iostream>
+
+bool TrajectoryPlayer::open(const std::string &path) {
+    close();
+    if (!file.open(path))
+        return false;
+
+    const unsigned char *begin = file.getData();
+    const unsigned char *end = begin + file.getSize();
+    TrajectoryFileHeader header{};
+    const unsigned char *position = TrajectoryRecorder::readHeader(begin, end, header);
+    if (position == nullptr) {
+        std::cerr << "TrajectoryPlayer: " << path << " is not a trajectory file" << std::endl;
+        close();
+        return false;
+    }
+    bodies.resize(header.bodyCount);
+    std::memcpy(bodies.data(), position, bodies.size() * sizeof(std::uint32_t));
+    position += bodies.size() * sizeof(std::uint32_t);
+
+    // Only the chunk headers are touched, the columns are paged in when a frame of their chunk is shown
+    while (position < end) {
+        TrajectoryChunkHeader chunk{};
+        if (static_cast<std::size_t>(end - position) < sizeof(chunk))
+            break;
+        std::memcpy(&chunk, position, sizeof(chunk));
+        std::size_t chunkSize = sizeof(chunk) + chunk.frameCount * sizeof(unsigned long long);
+        for (std::uint32_t columnSize: chunk.columnSizes) {
+            chunkSize += columnSize;
+        }
+        if (chunk.frameCount == 0 || static_cast<std::size_t>(end - position) < chunkSize)
+            break;
+        chunks.push_back({ static_cast<std::size_t>(position - begin), frameCount, chunk.frameCount });
+        frameCount += chunk.frameCount;
+        position += chunkSize;
+    }
+    if (position != end)
+        std::cerr << "TrajectoryPlayer: " << path << " ends with a truncated chunk, it is ignored" << std::endl;
+    if (frameCount == 0) {
+        std::cerr << "TrajectoryPlayer: " << path << " has no frame" << std::endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void TrajectoryPlayer::close() {
+    file.close();
+    bodies.clear();
+    chunks.clear();
+    frameCount = 0;
+    hasDecodedChunk = false;
+    currentFrame = 0;
+    playing = false;
+}
+
+bool TrajectoryPlayer::isOpen() const {
+    return file.isOpen();
+}
+
+bool TrajectoryPlayer::apply(Scene &scene, std::size_t frame) {
+    if (frame >= frameCount || !decodeChunkOf(frame))
+        return false;
+    currentFrame = frame;
+
+    std::size_t bodyCount = bodies.size();
+    const float *values = chunkValues.data() +
+                          (frame - chunks[decodedChunk].firstFrame) * TRAJECTORY_COLUMN_COUNT * bodyCount;
+    std::vector<GameObject *> &gameObjects = scene.getGameObjects();
+    scene.invalidateOctree();
+    for (std::size_t body = 0; body < bodyCount; body++) {
+        if (bodies[body] >= gameObjects.size())
+            continue;
+        auto value = [&](int column) { return static_cast<real>(values[column * bodyCount + body]); };
+        Transform &transform = gameObjects[bodies[body]]->transform;
+        transform.setPosition(value(TRAJECTORY_COLUMN_POSITION_X), value(TRAJECTORY_COLUMN_POSITION_Y),
+                              value(TRAJECTORY_COLUMN_POSITION_Z));
+        transform.setRotation(Quaternion(value(TRAJECTORY_COLUMN_ORIENTATION_W), value(TRAJECTORY_COLUMN_ORIENTATION_X),
+                                         value(TRAJECTORY_COLUMN_ORIENTATION_Y), value(TRAJECTORY_COLUMN_ORIENTATION_Z)));
+    }
+    return true;
+}
+
+void TrajectoryPlayer::update(Scene &scene) {
+    if (!isOpen())
+        return;
+    if (playing) {
+        if (currentFrame + 1 < frameCount)
+            currentFrame++;
+        else
+            playing = false;
+    }
+    apply(scene, currentFrame);
+}
+
+void TrajectoryPlayer::drawGui() {
+    if (!isOpen())
+        return;
+    ImGui::Text("Playback: %zu bodies, step %llu", bodies.size(), getStepCount());
+    ImGui::Checkbox("Play##TrajectoryPlayer", &playing);
+    int frame = static_cast<int>(currentFrame);
+    if (ImGui::SliderInt("Frame##TrajectoryPlayer", &frame, 0, static_cast<int>(frameCount) - 1))
+        setFrame(static_cast<std::size_t>(frame));
+}
+
+void TrajectoryPlayer::setPlaying(bool isPlaying) {
+    playing = isPlaying;
+}
+
+bool TrajectoryPlayer::isPlaying() const {
+    return playing;
+}
+
+void TrajectoryPlayer::setFrame(std::size_t frame) {
+    currentFrame = frame < frameCount ? frame : frameCount - 1;
+}
+
+std::size_t TrajectoryPlayer::getFrame() const {
+    return currentFrame;
+}
+
+std::size_t TrajectoryPlayer::getFrameCount() const {
+    return frameCount;
+}
+
+std::size_t TrajectoryPlayer::getBodyCount() const {
+    return bodies.size();
+}
+
+unsigned long long TrajectoryPlayer::getStepCount() const {
+    if (!hasDecodedChunk)
+        return 0;
+    return chunkStepCounts[currentFrame - chunks[decodedChunk].firstFrame];
+}
+
+bool TrajectoryPlayer::decodeChunkOf(std::size_t frame) {
+    std::size_t chunk = 0;
+    std::size_t count = chunks.size();
+    // Chunks are sorted by first frame
+    while (count > 0) {
+        std::size_t half = count / 2;
+        if (chunks[chunk + half].firstFrame + chunks[chunk + half].frameCount <= frame) {
+            chunk += half + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+    if (hasDecodedChunk && decodedChunk == chunk)
+        return true;
+
+    chunkStepCounts.clear();
+    chunkValues.clear();
+    const unsigned char *end = file.getData() + file.getSize();
+    hasDecodedChunk = TrajectoryRecorder::decodeChunk(file.getData() + chunks[chunk].offset, end, bodies.size(),
+                                                      chunkStepCounts, chunkValues) != nullptr;
+    decodedChunk = chunk;
+    return hasDecodedChunk;
+}
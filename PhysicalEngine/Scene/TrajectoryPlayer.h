@@ -0,0 +1,81 @@
+#ifndef TRAJECTORYPLAYER_H
+#define TRAJECTORYPLAYER_H
+
+#include "../Utility/MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Scene;
+
+/// <summary>
+/// Relecture d'un fichier de TrajectoryRecorder : le fichier est projeté en mémoire, seul le chunk de la frame
+/// affichée est décodé, et les Transforms des corps enregistrés sont placés directement, sans pas de physique.
+/// </summary>
+class TrajectoryPlayer {
+private:
+    struct ChunkEntry {
+        std::size_t offset;
+        std::size_t firstFrame;
+        std::size_t frameCount;
+    };
+
+    MappedFile file;
+    std::vector<std::uint32_t> bodies;
+    std::vector<ChunkEntry> chunks;
+    std::size_t frameCount = 0;
+
+    // Decoded chunk of the current frame
+    std::size_t decodedChunk = 0;
+    bool hasDecodedChunk = false;
+    std::vector<unsigned long long> chunkStepCounts;
+    std::vector<float> chunkValues;
+
+    std::size_t currentFrame = 0;
+    bool playing = false;
+
+public:
+    /// <summary>
+    /// Projette le fichier et indexe ses chunks (seuls les en-têtes des chunks sont lus)
+    /// </summary>
+    bool open(const std::string &path);
+
+    void close();
+
+    bool isOpen() const;
+
+    /// <summary>
+    /// Place les corps de la scène dans l'état de la frame donnée
+    /// </summary>
+    bool apply(Scene &scene, std::size_t frame);
+
+    /// <summary>
+    /// Avance d'une frame en lecture, puis applique la frame courante
+    /// </summary>
+    void update(Scene &scene);
+
+    void drawGui();
+
+    void setPlaying(bool isPlaying);
+
+    bool isPlaying() const;
+
+    void setFrame(std::size_t frame);
+
+    std::size_t getFrame() const;
+
+    std::size_t getFrameCount() const;
+
+    std::size_t getBodyCount() const;
+
+    /// <summary>
+    /// Numéro du pas de simulation enregistré dans la frame courante
+    /// </summary>
+    unsigned long long getStepCount() const;
+
+private:
+    bool decodeChunkOf(std::size_t frame);
+};
+
+#endif // TRAJECTORYPLAYER_H
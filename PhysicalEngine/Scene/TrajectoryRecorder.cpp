@@ -0,0 +1,332 @@
+#include "TrajectoryRecorder.h"
+
+#include "../Utility/TraceRecorder.h"
+#include "Components/PhysicalComponent/PhysicalComponent.h"
+#include "GameObject.h"
+#include "Scene.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+namespace {
+    // Sleep of the writer thread when the queue is empty
+    constexpr std::chrono::microseconds WRITER_IDLE_SLEEP(500);
+
+    std::uint32_t floatBits(float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    float bitsFloat(std::uint32_t bits) {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    void writeVarint(std::vector<unsigned char> &bytes, std::uint32_t value) {
+        while (value >= 0x80) {
+            bytes.push_back(static_cast<unsigned char>(value | 0x80));
+            value >>= 7;
+        }
+        bytes.push_back(static_cast<unsigned char>(value));
+    }
+
+    bool readVarint(const unsigned char *&position, const unsigned char *end, std::uint32_t &value) {
+        value = 0;
+        for (int shift = 0; shift < 35 && position < end; shift += 7) {
+            unsigned char byte = *position++;
+            value |= static_cast<std::uint32_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    void storeVector(float *values, std::size_t bodyCount, int column, std::size_t body, const Vector3d &vector) {
+        values[column * bodyCount + body] = static_cast<float>(vector.x);
+        values[(column + 1) * bodyCount + body] = static_cast<float>(vector.y);
+        values[(column + 2) * bodyCount + body] = static_cast<float>(vector.z);
+    }
+}
+
+float TrajectoryData::getValue(std::size_t frame, int column, std::size_t body) const {
+    return values[(frame * TRAJECTORY_COLUMN_COUNT + column) * bodies.size() + body];
+}
+
+TrajectoryRecorder::~TrajectoryRecorder() {
+    stop();
+}
+
+bool TrajectoryRecorder::start(const std::string &path, Scene &scene, const std::vector<std::uint32_t> &bodyIndices,
+                               unsigned int chunkFrames, unsigned int queuedFrames) {
+    stop();
+
+    std::vector<GameObject *> &gameObjects = scene.getGameObjects();
+    bodies.clear();
+    physicalComponents.clear();
+    for (std::size_t i = 0; i < (bodyIndices.empty() ? gameObjects.size() : bodyIndices.size()); i++) {
+        std::uint32_t index = bodyIndices.empty() ? static_cast<std::uint32_t>(i) : bodyIndices[i];
+        if (index >= gameObjects.size())
+            continue;
+        PhysicalComponent *physicalComponent = nullptr;
+        gameObjects[index]->getComponentByClass(physicalComponent);
+        if (physicalComponent == nullptr)
+            continue;
+        bodies.push_back(index);
+        physicalComponents.push_back(physicalComponent);
+    }
+
+    file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        std::cerr << "TrajectoryRecorder: cannot open " << path << std::endl;
+        return false;
+    }
+    TrajectoryFileHeader header = { TRAJECTORY_MAGIC, TRAJECTORY_VERSION, static_cast<std::uint32_t>(bodies.size()),
+                                    TRAJECTORY_COLUMN_COUNT };
+    writtenBytes = 0;
+    if (!writeBytes(&header, sizeof(header)) || !writeBytes(bodies.data(), bodies.size() * sizeof(std::uint32_t))) {
+        std::fclose(file);
+        file = nullptr;
+        return false;
+    }
+
+    // Every frame block is allocated here, recording a frame only copies values
+    framesPerChunk = chunkFrames > 0 ? chunkFrames : 1;
+    blocks.resize(queuedFrames > 0 ? queuedFrames : 1);
+    filledBlocks.reset(blocks.size());
+    freeBlocks.reset(blocks.size());
+    for (unsigned int i = 0; i < blocks.size(); i++) {
+        blocks[i].values.assign(bodies.size() * TRAJECTORY_COLUMN_COUNT, 0);
+        freeBlocks.push(i);
+    }
+    chunkFrameCount = 0;
+    chunkStepCounts.clear();
+    previousBits.assign(bodies.size() * TRAJECTORY_COLUMN_COUNT, 0);
+    for (std::vector<unsigned char> &column: columns) {
+        column.clear();
+    }
+
+    recordedFrames = 0;
+    droppedFrames = 0;
+    stopping = false;
+    recording = true;
+    writer = std::thread(&TrajectoryRecorder::writerLoop, this);
+    return true;
+}
+
+void TrajectoryRecorder::recordFrame(const Scene &scene) {
+    if (!recording.load(std::memory_order_relaxed))
+        return;
+    TraceScope trace("Record trajectories");
+
+    unsigned int blockIndex;
+    if (!freeBlocks.pop(blockIndex)) {
+        // The writer is behind, never wait for it
+        droppedFrames.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    FrameBlock &block = blocks[blockIndex];
+    block.stepCount = scene.getStepCount();
+    float *values = block.values.data();
+    std::size_t bodyCount = bodies.size();
+    for (std::size_t body = 0; body < bodyCount; body++) {
+        PhysicalState state = physicalComponents[body]->getState();
+        storeVector(values, bodyCount, TRAJECTORY_COLUMN_POSITION_X, body, state.position);
+        for (int i = 0; i < 4; i++) {
+            values[(TRAJECTORY_COLUMN_ORIENTATION_W + i) * bodyCount + body] = static_cast<float>(state.orientation[i]);
+        }
+        storeVector(values, bodyCount, TRAJECTORY_COLUMN_LINEAR_SPEED_X, body, state.linearSpeed);
+        storeVector(values, bodyCount, TRAJECTORY_COLUMN_ANGULAR_SPEED_X, body, state.angularSpeed);
+    }
+    filledBlocks.push(blockIndex);
+    recordedFrames.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TrajectoryRecorder::stop() {
+    if (!recording)
+        return;
+    recording = false;
+    stopping.store(true, std::memory_order_release);
+    writer.join();
+    if (std::fclose(file) != 0)
+        std::cerr << "TrajectoryRecorder: cannot close the file" << std::endl;
+    file = nullptr;
+}
+
+bool TrajectoryRecorder::isRecording() const {
+    return recording;
+}
+
+std::size_t TrajectoryRecorder::getBodyCount() const {
+    return bodies.size();
+}
+
+unsigned long long TrajectoryRecorder::getRecordedFrames() const {
+    return recordedFrames;
+}
+
+unsigned long long TrajectoryRecorder::getDroppedFrames() const {
+    return droppedFrames;
+}
+
+unsigned long long TrajectoryRecorder::getWrittenBytes() const {
+    return writtenBytes;
+}
+
+void TrajectoryRecorder::writerLoop() {
+    while (true) {
+        // Frames pushed before the stop request are visible once it is
+        bool stopRequested = stopping.load(std::memory_order_acquire);
+        unsigned int blockIndex;
+        while (filledBlocks.pop(blockIndex)) {
+            appendFrame(blocks[blockIndex]);
+            freeBlocks.push(blockIndex);
+        }
+        if (stopRequested)
+            break;
+        std::this_thread::sleep_for(WRITER_IDLE_SLEEP);
+    }
+    if (chunkFrameCount > 0)
+        writeChunk();
+}
+
+void TrajectoryRecorder::appendFrame(const FrameBlock &block) {
+    std::size_t bodyCount = bodies.size();
+    for (int column = 0; column < TRAJECTORY_COLUMN_COUNT; column++) {
+        const float *values = block.values.data() + column * bodyCount;
+        std::uint32_t *previous = previousBits.data() + column * bodyCount;
+        for (std::size_t body = 0; body < bodyCount; body++) {
+            std::uint32_t bits = floatBits(values[body]);
+            writeVarint(columns[column], bits ^ previous[body]);
+            previous[body] = bits;
+        }
+    }
+    chunkStepCounts.push_back(block.stepCount);
+    if (++chunkFrameCount == framesPerChunk)
+        writeChunk();
+}
+
+void TrajectoryRecorder::writeChunk() {
+    TrajectoryChunkHeader header{};
+    header.frameCount = chunkFrameCount;
+    for (int column = 0; column < TRAJECTORY_COLUMN_COUNT; column++) {
+        header.columnSizes[column] = static_cast<std::uint32_t>(columns[column].size());
+    }
+    writeBytes(&header, sizeof(header));
+    writeBytes(chunkStepCounts.data(), chunkStepCounts.size() * sizeof(unsigned long long));
+    for (std::vector<unsigned char> &column: columns) {
+        writeBytes(column.data(), column.size());
+        column.clear();
+    }
+
+    // Every chunk decodes on its own
+    chunkFrameCount = 0;
+    chunkStepCounts.clear();
+    std::fill(previousBits.begin(), previousBits.end(), 0);
+}
+
+bool TrajectoryRecorder::writeBytes(const void *data, std::size_t size) {
+    if (size == 0)
+        return true;
+    if (std::fwrite(data, 1, size, file) != size) {
+        std::cerr << "TrajectoryRecorder: write failed" << std::endl;
+        return false;
+    }
+    writtenBytes.fetch_add(size, std::memory_order_relaxed);
+    return true;
+}
+
+bool TrajectoryRecorder::load(const std::string &path, TrajectoryData &data) {
+    std::FILE *input = std::fopen(path.c_str(), "rb");
+    if (input == nullptr) {
+        std::cerr << "TrajectoryRecorder: cannot open " << path << std::endl;
+        return false;
+    }
+    std::vector<unsigned char> bytes;
+    unsigned char buffer[1 << 16];
+    std::size_t size;
+    while ((size = std::fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        bytes.insert(bytes.end(), buffer, buffer + size);
+    }
+    std::fclose(input);
+
+    const unsigned char *end = bytes.data() + bytes.size();
+    TrajectoryFileHeader header{};
+    const unsigned char *position = readHeader(bytes.data(), end, header);
+    if (position == nullptr) {
+        std::cerr << "TrajectoryRecorder: " << path << " is not a trajectory file" << std::endl;
+        return false;
+    }
+
+    std::size_t bodyCount = header.bodyCount;
+    data.bodies.resize(bodyCount);
+    std::memcpy(data.bodies.data(), position, bodyCount * sizeof(std::uint32_t));
+    position += bodyCount * sizeof(std::uint32_t);
+    data.stepCounts.clear();
+    data.values.clear();
+
+    while (position < end) {
+        position = decodeChunk(position, end, bodyCount, data.stepCounts, data.values);
+        if (position == nullptr) {
+            std::cerr << "TrajectoryRecorder: " << path << " has a truncated or corrupted chunk" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+const unsigned char *TrajectoryRecorder::readHeader(const unsigned char *position, const unsigned char *end,
+                                                    TrajectoryFileHeader &header) {
+    if (static_cast<std::size_t>(end - position) < sizeof(header))
+        return nullptr;
+    std::memcpy(&header, position, sizeof(header));
+    position += sizeof(header);
+    if (header.magic != TRAJECTORY_MAGIC || header.version != TRAJECTORY_VERSION ||
+        header.columnCount != TRAJECTORY_COLUMN_COUNT ||
+        static_cast<std::size_t>(end - position) < header.bodyCount * sizeof(std::uint32_t))
+        return nullptr;
+    return position;
+}
+
+const unsigned char *TrajectoryRecorder::decodeChunk(const unsigned char *position, const unsigned char *end,
+                                                     std::size_t bodyCount, std::vector<unsigned long long> &stepCounts,
+                                                     std::vector<float> &values) {
+    TrajectoryChunkHeader chunk{};
+    if (static_cast<std::size_t>(end - position) < sizeof(chunk))
+        return nullptr;
+    std::memcpy(&chunk, position, sizeof(chunk));
+    position += sizeof(chunk);
+    std::size_t stepsSize = chunk.frameCount * sizeof(unsigned long long);
+    if (chunk.frameCount == 0 || static_cast<std::size_t>(end - position) < stepsSize)
+        return nullptr;
+
+    std::size_t firstFrame = stepCounts.size();
+    stepCounts.resize(firstFrame + chunk.frameCount);
+    std::memcpy(stepCounts.data() + firstFrame, position, stepsSize);
+    position += stepsSize;
+    values.resize(stepCounts.size() * TRAJECTORY_COLUMN_COUNT * bodyCount);
+
+    for (int column = 0; column < TRAJECTORY_COLUMN_COUNT; column++) {
+        if (static_cast<std::size_t>(end - position) < chunk.columnSizes[column])
+            return nullptr;
+        const unsigned char *columnEnd = position + chunk.columnSizes[column];
+        // The first frame of a chunk is xored with 0, the next ones with the decoded frame before them
+        for (std::size_t frame = firstFrame; frame < stepCounts.size(); frame++) {
+            float *frameValues = values.data() + (frame * TRAJECTORY_COLUMN_COUNT + column) * bodyCount;
+            const float *previousValues = frameValues - TRAJECTORY_COLUMN_COUNT * bodyCount;
+            for (std::size_t body = 0; body < bodyCount; body++) {
+                std::uint32_t delta;
+                if (!readVarint(position, columnEnd, delta))
+                    return nullptr;
+                std::uint32_t previous = frame > firstFrame ? floatBits(previousValues[body]) : 0;
+                frameValues[body] = bitsFloat(previous ^ delta);
+            }
+        }
+        position = columnEnd;
+    }
+    return position;
+}
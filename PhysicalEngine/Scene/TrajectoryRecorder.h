@@ -0,0 +1,171 @@
+#ifndef TRAJECTORYRECORDER_H
+#define TRAJECTORYRECORDER_H
+
+#include "../Utility/SpscQueue.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+class Scene;
+
+class PhysicalComponent;
+
+#define TRAJECTORY_MAGIC 0x52544550u // "PETR"
+#define TRAJECTORY_VERSION 1u
+
+enum TrajectoryColumn {
+    TRAJECTORY_COLUMN_POSITION_X,
+    TRAJECTORY_COLUMN_POSITION_Y,
+    TRAJECTORY_COLUMN_POSITION_Z,
+    TRAJECTORY_COLUMN_ORIENTATION_W,
+    TRAJECTORY_COLUMN_ORIENTATION_X,
+    TRAJECTORY_COLUMN_ORIENTATION_Y,
+    TRAJECTORY_COLUMN_ORIENTATION_Z,
+    TRAJECTORY_COLUMN_LINEAR_SPEED_X,
+    TRAJECTORY_COLUMN_LINEAR_SPEED_Y,
+    TRAJECTORY_COLUMN_LINEAR_SPEED_Z,
+    TRAJECTORY_COLUMN_ANGULAR_SPEED_X,
+    TRAJECTORY_COLUMN_ANGULAR_SPEED_Y,
+    TRAJECTORY_COLUMN_ANGULAR_SPEED_Z,
+    TRAJECTORY_COLUMN_COUNT
+};
+
+// File layout: TrajectoryFileHeader, the gameObject index of every body (uint32), then chunks.
+// A chunk is a TrajectoryChunkHeader, the step count of every frame (uint64), then the columns one after the other.
+// A column holds frameCount x bodyCount float32 values, each one xored with the same body on the previous frame
+// (0 on the first frame of the chunk) and written as a LEB128 varint: slowly changing values keep a few bytes.
+
+struct TrajectoryFileHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t bodyCount;
+    std::uint32_t columnCount;
+};
+
+struct TrajectoryChunkHeader {
+    std::uint32_t frameCount;
+    std::uint32_t columnSizes[TRAJECTORY_COLUMN_COUNT];
+};
+
+/// <summary>
+/// Trajectoires relues depuis un fichier : values[(frame * TRAJECTORY_COLUMN_COUNT + column) * bodyCount + body]
+/// </summary>
+struct TrajectoryData {
+    std::vector<std::uint32_t> bodies;
+    std::vector<unsigned long long> stepCounts;
+    std::vector<float> values;
+
+    float getValue(std::size_t frame, int column, std::size_t body) const;
+};
+
+/// <summary>
+/// Enregistre à chaque pas les positions, orientations et vitesses des corps choisis dans un fichier en colonnes,
+/// compressé par blocs de frames. Le pas ne fait que copier les valeurs dans un bloc préalloué, l'encodage et
+/// l'écriture sont faits par un thread dédié. Si l'écriture prend du retard, les frames sont abandonnées
+/// (comptées dans getDroppedFrames) plutôt que de bloquer la simulation.
+/// </summary>
+class TrajectoryRecorder {
+public:
+    static constexpr unsigned int DEFAULT_FRAMES_PER_CHUNK = 64;
+    static constexpr unsigned int DEFAULT_QUEUED_FRAMES = 128;
+
+private:
+    struct FrameBlock {
+        unsigned long long stepCount = 0;
+        std::vector<float> values; // [column][body]
+    };
+
+    std::vector<FrameBlock> blocks;
+    SpscQueue<unsigned int> filledBlocks;
+    SpscQueue<unsigned int> freeBlocks;
+
+    std::vector<std::uint32_t> bodies;
+    std::vector<PhysicalComponent *> physicalComponents;
+
+    std::thread writer;
+    std::atomic<bool> recording{ false };
+    std::atomic<bool> stopping{ false };
+    std::atomic<unsigned long long> recordedFrames{ 0 };
+    std::atomic<unsigned long long> droppedFrames{ 0 };
+    std::atomic<unsigned long long> writtenBytes{ 0 };
+
+    // Writer thread only
+    std::FILE *file = nullptr;
+    unsigned int framesPerChunk = DEFAULT_FRAMES_PER_CHUNK;
+    unsigned int chunkFrameCount = 0;
+    std::vector<unsigned long long> chunkStepCounts;
+    std::vector<std::uint32_t> previousBits;
+    std::vector<unsigned char> columns[TRAJECTORY_COLUMN_COUNT];
+
+public:
+    TrajectoryRecorder() = default;
+
+    TrajectoryRecorder(const TrajectoryRecorder &) = delete;
+
+    TrajectoryRecorder &operator=(const TrajectoryRecorder &) = delete;
+
+    ~TrajectoryRecorder();
+
+public:
+    /// <summary>
+    /// Ouvre path et démarre le thread d'écriture. bodyIndices sont des indices dans scene.getGameObjects(),
+    /// vide pour tous les objets ayant un composant physique. Les objets doivent rester dans la scène
+    /// pendant l'enregistrement.
+    /// </summary>
+    bool start(const std::string &path, Scene &scene, const std::vector<std::uint32_t> &bodyIndices = {},
+               unsigned int chunkFrames = DEFAULT_FRAMES_PER_CHUNK,
+               unsigned int queuedFrames = DEFAULT_QUEUED_FRAMES);
+
+    /// <summary>
+    /// Copie l'état des corps enregistrés (appelé par la scène à la fin de chaque pas), ne bloque jamais
+    /// </summary>
+    void recordFrame(const Scene &scene);
+
+    /// <summary>
+    /// Ecrit les frames en attente, attend le thread d'écriture et ferme le fichier
+    /// </summary>
+    void stop();
+
+    bool isRecording() const;
+
+    std::size_t getBodyCount() const;
+
+    unsigned long long getRecordedFrames() const;
+
+    unsigned long long getDroppedFrames() const;
+
+    unsigned long long getWrittenBytes() const;
+
+    /// <summary>
+    /// Relit entièrement un fichier de trajectoires
+    /// </summary>
+    static bool load(const std::string &path, TrajectoryData &data);
+
+    /// <summary>
+    /// Lit et vérifie l'en-tête d'un fichier, renvoie le début de la liste des corps ou nullptr
+    /// </summary>
+    static const unsigned char *readHeader(const unsigned char *position, const unsigned char *end,
+                                           TrajectoryFileHeader &header);
+
+    /// <summary>
+    /// Décode le chunk commençant à position et ajoute ses frames à stepCounts et values (rangées comme dans
+    /// TrajectoryData), renvoie la fin du chunk ou nullptr s'il est tronqué ou corrompu
+    /// </summary>
+    static const unsigned char *decodeChunk(const unsigned char *position, const unsigned char *end,
+                                            std::size_t bodyCount, std::vector<unsigned long long> &stepCounts,
+                                            std::vector<float> &values);
+
+private:
+    void writerLoop();
+
+    void appendFrame(const FrameBlock &block);
+
+    void writeChunk();
+
+    bool writeBytes(const void *data, std::size_t size);
+};
+
+#endif // TRAJECTORYRECORDER_H
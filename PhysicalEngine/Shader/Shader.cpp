@@ -19,10 +19,14 @@ precision highp float;
 layout (location = 0) in vec3 aPos;
 
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
 uniform vec4 color;
 
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+};
+
 out vec4 ourColor;
 
 void main()
@@ -111,6 +115,31 @@ void Shader::create(const char* vShaderCode, const char* fShaderCode) {
 
     glDeleteShader(vertex);
     glDeleteShader(fragment);
+
+    cacheUniformLocations();
+}
+
+void Shader::cacheUniformLocations() {
+    uniformLocations.clear();
+    int count = 0;
+    glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &count);
+    char name[256];
+    for (int i = 0; i < count; i++)
+    {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(ID, static_cast<GLuint>(i), sizeof(name), &length, &size, &type, name);
+        // The uniforms of a block have no location
+        int location = glGetUniformLocation(ID, name);
+        if (location < 0)
+            continue;
+        std::string uniformName(name, static_cast<std::size_t>(length));
+        // Arrays are reported as "name[0]", they are set by their name alone
+        if (uniformName.size() > 3 && uniformName.compare(uniformName.size() - 3, 3, "[0]") == 0)
+            uniformName.resize(uniformName.size() - 3);
+        uniformLocations.emplace(uniformName, location);
+    }
 }
 
 
@@ -154,53 +183,72 @@ void Shader::use() {
 }
 
 void Shader::setBool(const std::string& name, bool value) const {
-    glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+    glUniform1i(getUniformLocation(name), (int)value);
 }
 
 void Shader::setInt(const std::string& name, int value) const {
-    glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+    glUniform1i(getUniformLocation(name), value);
 }
 
 void Shader::setFloat(const std::string& name, float value) const {
-    glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+    glUniform1f(getUniformLocation(name), value);
 }
 
 void Shader::setVec2(const std::string& name, const glm::vec2& value) const {
-    glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+    glUniform2fv(getUniformLocation(name), 1, &value[0]);
 }
 
 void Shader::setVec2(const std::string& name, float x, float y) const {
-    glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y);
+    glUniform2f(getUniformLocation(name), x, y);
 }
 
 void Shader::setVec3(const std::string& name, const glm::vec3& value) const {
-    glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+    glUniform3fv(getUniformLocation(name), 1, &value[0]);
 }
 
 void Shader::setVec3(const std::string& name, float x, float y, float z) const {
-    glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
+    glUniform3f(getUniformLocation(name), x, y, z);
 }
 
 void Shader::setVec4(const std::string& name, const glm::vec4& value) const {
-    glUniform4fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+    glUniform4fv(getUniformLocation(name), 1, &value[0]);
 }
 
 void Shader::setVec4(const std::string& name, float x, float y, float z, float w) const {
-    glUniform4f(glGetUniformLocation(ID, name.c_str()), x, y, z, w);
+    glUniform4f(getUniformLocation(name), x, y, z, w);
 }
 
 void Shader::setMat2(const std::string& name, const glm::mat2& mat) const {
-    glUniformMatrix2fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    glUniformMatrix2fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
 }
 
 void Shader::setMat3(const std::string& name, const glm::mat3& mat) const {
-    glUniformMatrix3fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    glUniformMatrix3fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
 }
 
 void Shader::setMat4(const std::string& name, const glm::mat4& mat) const {
-    glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+    glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
+}
+
+void Shader::setVec4(int location, const glm::vec4& value) const {
+    glUniform4fv(location, 1, &value[0]);
+}
+
+void Shader::setMat4(int location, const glm::mat4& mat) const {
+    glUniformMatrix4fv(location, 1, GL_FALSE, &mat[0][0]);
 }
 
 unsigned int Shader::getId() const {
     return ID;
 }
+
+int Shader::getUniformLocation(const std::string& name) const {
+    auto it = uniformLocations.find(name);
+    return it != uniformLocations.end() ? it->second : -1;
+}
+
+void Shader::bindUniformBlock(const std::string& blockName, unsigned int binding) const {
+    unsigned int index = glGetUniformBlockIndex(ID, blockName.c_str());
+    if (index != GL_INVALID_INDEX)
+        glUniformBlockBinding(ID, index, binding);
+}
@@ -2,6 +2,7 @@
 #define SHADER_H
 
 #include <string>
+#include <unordered_map>
 
 // GLM
 #include <glm/glm.hpp>
@@ -13,6 +14,9 @@ class Shader {
 private:
     unsigned int ID;
 
+    // Locations of the active uniforms, read once after linking instead of glGetUniformLocation at every set
+    std::unordered_map<std::string, int> uniformLocations;
+
 public:
     Shader();
 
@@ -23,6 +27,8 @@ private:
 
     void checkCompileErrors(unsigned int shader, const std::string &type);
 
+    void cacheUniformLocations();
+
 public:
     ~Shader();
 
@@ -40,6 +46,16 @@ public:
 
     unsigned int getId() const;
 
+    /// <summary>
+    /// Emplacement d'un uniform résolu à l'édition de liens, -1 s'il n'existe pas (comme glGetUniformLocation)
+    /// </summary>
+    int getUniformLocation(const std::string &name) const;
+
+    /// <summary>
+    /// Relie le bloc d'uniforms blockName au point de liaison binding, sans effet si le shader ne le déclare pas
+    /// </summary>
+    void bindUniformBlock(const std::string &blockName, unsigned int binding) const;
+
     void setVec2(const std::string &name, float x, float y) const;
 
     void setVec3(const std::string &name, float x, float y, float z) const;
@@ -57,6 +73,11 @@ public:
     void setMat3(const std::string &name, const glm::mat3 &mat) const;
 
     void setMat4(const std::string &name, const glm::mat4 &mat) const;
+
+    // Same setters with a location from getUniformLocation, for the uniforms set at every draw
+    void setVec4(int location, const glm::vec4 &value) const;
+
+    void setMat4(int location, const glm::mat4 &mat) const;
 };
 
 
@@ -0,0 +1,151 @@
+#include "AllocationTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<unsigned long long> allocationCount{ 0 };
+    std::atomic<unsigned long long> allocatedBytes{ 0 };
+    std::atomic<long long> currentBytes{ 0 };
+    std::atomic<long long> peakBytes{ 0 };
+
+    // Constant initialized, usable from operator new on any thread
+    thread_local AllocationScope *threadScope = nullptr;
+
+    void raisePeak(std::atomic<long long> &peak, long long current) {
+        long long value = peak.load(std::memory_order_relaxed);
+        while (current > value && !peak.compare_exchange_weak(value, current, std::memory_order_relaxed)) {
+        }
+    }
+}
+
+bool AllocationTracker::isEnabled() {
+#ifdef PHYSICALENGINE_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void AllocationTracker::recordAllocation(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    long long current = currentBytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed) +
+                        static_cast<long long>(size);
+    raisePeak(peakBytes, current);
+    for (AllocationScope *scope = threadScope; scope != nullptr; scope = scope->parent) {
+        scope->allocationCount.fetch_add(1, std::memory_order_relaxed);
+        scope->allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        raisePeak(scope->peakBytes,
+                  scope->currentBytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed) +
+                  static_cast<long long>(size));
+    }
+}
+
+void AllocationTracker::recordDeallocation(std::size_t size) {
+    currentBytes.fetch_sub(static_cast<long long>(size), std::memory_order_relaxed);
+    for (AllocationScope *scope = threadScope; scope != nullptr; scope = scope->parent) {
+        scope->currentBytes.fetch_sub(static_cast<long long>(size), std::memory_order_relaxed);
+    }
+}
+
+unsigned long long AllocationTracker::getAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+unsigned long long AllocationTracker::getAllocatedBytes() {
+    return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+long long AllocationTracker::getCurrentBytes() {
+    return currentBytes.load(std::memory_order_relaxed);
+}
+
+long long AllocationTracker::getPeakBytes() {
+    return peakBytes.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::resetPeak() {
+    peakBytes.store(currentBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+AllocationScope *AllocationTracker::getThreadScope() {
+    return threadScope;
+}
+
+void AllocationTracker::setThreadScope(AllocationScope *scope) {
+    threadScope = scope;
+}
+
+#ifdef PHYSICALENGINE_TRACK_ALLOCATIONS
+
+// Every block is prefixed with its size, the prefix keeps the 16 bytes alignment of malloc
+namespace {
+    constexpr std::size_t HEADER_SIZE = 16;
+
+    void *trackedAllocate(std::size_t size) {
+        void *block = std::malloc(size + HEADER_SIZE);
+        if (block == nullptr)
+            return nullptr;
+        *static_cast<std::size_t *>(block) = size;
+        AllocationTracker::recordAllocation(size);
+        return static_cast<char *>(block) + HEADER_SIZE;
+    }
+
+    void trackedFree(void *pointer) {
+        if (pointer == nullptr)
+            return;
+        void *block = static_cast<char *>(pointer) - HEADER_SIZE;
+        AllocationTracker::recordDeallocation(*static_cast<std::size_t *>(block));
+        std::free(block);
+    }
+}
+
+void *operator new(std::size_t size) {
+    void *pointer = trackedAllocate(size);
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void *operator new[](std::size_t size) {
+    void *pointer = trackedAllocate(size);
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    return trackedAllocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return trackedAllocate(size);
+}
+
+void operator delete(void *pointer) noexcept {
+    trackedFree(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+    trackedFree(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    trackedFree(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+    trackedFree(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+    trackedFree(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+    trackedFree(pointer);
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef ALLOCATIONTRACKER_H
+#define ALLOCATIONTRACKER_H
+
+#include <atomic>
+#include <cstddef>
+
+/// <summary>
+/// Compteurs d'allocations d'une portée (une étape du profiler par exemple). Seules les allocations des threads
+/// qui l'ont adoptée avec AllocationTracker::setThreadScope y sont comptées, ainsi que dans ses portées parentes.
+/// </summary>
+struct AllocationScope {
+    AllocationScope *parent = nullptr;
+    std::atomic<unsigned long long> allocationCount{ 0 };
+    std::atomic<unsigned long long> allocatedBytes{ 0 };
+    // Bytes allocated minus bytes freed by the threads of the scope, and the highest value reached
+    std::atomic<long long> currentBytes{ 0 };
+    std::atomic<long long> peakBytes{ 0 };
+};
+
+/// <summary>
+/// Compteurs d'allocations du tas alimentés par le remplacement de operator new / delete.
+/// Le remplacement n'est compilé qu'avec PHYSICALENGINE_TRACK_ALLOCATIONS, sinon les compteurs restent à 0.
+/// Les compteurs globaux couvrent tout le processus, ceux d'une AllocationScope seulement ses threads.
+/// </summary>
+class AllocationTracker {
+public:
+    static bool isEnabled();
+
+    static void recordAllocation(std::size_t size);
+
+    static void recordDeallocation(std::size_t size);
+
+    /// <summary>
+    /// Nombre d'allocations depuis le lancement
+    /// </summary>
+    static unsigned long long getAllocationCount();
+
+    /// <summary>
+    /// Octets alloués depuis le lancement (sans compter les libérations)
+    /// </summary>
+    static unsigned long long getAllocatedBytes();
+
+    static long long getCurrentBytes();
+
+    /// <summary>
+    /// Plus haute occupation du tas depuis le dernier resetPeak
+    /// </summary>
+    static long long getPeakBytes();
+
+    static void resetPeak();
+
+    /// <summary>
+    /// Portée recevant les allocations du thread appelant (nullptr : aucune)
+    /// </summary>
+    static AllocationScope *getThreadScope();
+
+    static void setThreadScope(AllocationScope *scope);
+};
+
+#endif // ALLOCATIONTRACKER_H
@@ -0,0 +1,55 @@
+#include "Determinism.h"
+
+#include "Simd.h"
+
+#ifdef PHYSICALENGINE_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+std::atomic<bool> Determinism::enabled{ false };
+
+void Determinism::setEnabled(bool enable) {
+    enabled.store(enable);
+}
+
+bool Determinism::isEnabled() {
+    return enabled.load(std::memory_order_relaxed);
+}
+
+unsigned int Determinism::getFloatingPointMode() {
+#ifdef PHYSICALENGINE_SIMD_SSE
+    return _mm_getcsr();
+#else
+    return 0;
+#endif
+}
+
+void Determinism::setFloatingPointMode(unsigned int mode) {
+#ifdef PHYSICALENGINE_SIMD_SSE
+    if (_mm_getcsr() != mode)
+        _mm_setcsr(mode);
+#else
+    (void) mode;
+#endif
+}
+
+unsigned int Determinism::getDeterministicFloatingPointMode(unsigned int mode) {
+#ifdef PHYSICALENGINE_SIMD_SSE
+    // Rounding control bits 13-14 at 0 (nearest), FTZ bit 15, DAZ bit 6
+    constexpr unsigned int ROUNDING_MASK = 0x6000;
+    constexpr unsigned int FLUSH_TO_ZERO = 0x8000;
+    constexpr unsigned int DENORMALS_ARE_ZERO = 0x0040;
+    return (mode & ~ROUNDING_MASK) | FLUSH_TO_ZERO | DENORMALS_ARE_ZERO;
+#else
+    return mode;
+#endif
+}
+
+DeterministicFloatingPointScope::DeterministicFloatingPointScope() {
+    previousMode = Determinism::getFloatingPointMode();
+    Determinism::setFloatingPointMode(Determinism::getDeterministicFloatingPointMode(previousMode));
+}
+
+DeterministicFloatingPointScope::~DeterministicFloatingPointScope() {
+    Determinism::setFloatingPointMode(previousMode);
+}
@@ -0,0 +1,50 @@
+#ifndef DETERMINISM_H
+#define DETERMINISM_H
+
+#include <atomic>
+
+/// <summary>
+/// Mode déterministe : la scène avance par pas fixes et les calculs flottants se font dans un environnement fixé
+/// (arrondi au plus proche, dénormaux mis à zéro), les mêmes entrées donnent alors un état identique bit à bit,
+/// quel que soit le nombre de threads du JobSystem.
+/// </summary>
+class Determinism {
+private:
+    static std::atomic<bool> enabled;
+
+public:
+    static void setEnabled(bool enable);
+
+    static bool isEnabled();
+
+    /// <summary>
+    /// Environnement flottant du thread appelant (registre MXCSR en SSE, 0 sans SSE)
+    /// </summary>
+    static unsigned int getFloatingPointMode();
+
+    static void setFloatingPointMode(unsigned int mode);
+
+    /// <summary>
+    /// Environnement flottant du mode déterministe : mode avec arrondi au plus proche, flush-to-zero et denormals-are-zero
+    /// </summary>
+    static unsigned int getDeterministicFloatingPointMode(unsigned int mode);
+};
+
+/// <summary>
+/// Place le thread dans l'environnement flottant déterministe et restaure le précédent à la destruction
+/// </summary>
+class DeterministicFloatingPointScope {
+private:
+    unsigned int previousMode;
+
+public:
+    DeterministicFloatingPointScope();
+
+    DeterministicFloatingPointScope(const DeterministicFloatingPointScope &) = delete;
+
+    DeterministicFloatingPointScope &operator=(const DeterministicFloatingPointScope &) = delete;
+
+    ~DeterministicFloatingPointScope();
+};
+
+#endif // DETERMINISM_H
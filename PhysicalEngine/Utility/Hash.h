@@ -0,0 +1,33 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// FNV-1a 64 bits, used to fingerprint the simulation state (bitwise, -0.0 and 0.0 hash differently)
+namespace Hash {
+
+    constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+    constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+
+    inline std::uint64_t fnv1a(const void* data, std::size_t size, std::uint64_t hash = FNV_OFFSET_BASIS) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    template <typename T>
+    inline std::uint64_t combine(std::uint64_t hash, T value) {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        return fnv1a(bytes, sizeof(T), hash);
+    }
+
+}
+
+#endif // HASH_H
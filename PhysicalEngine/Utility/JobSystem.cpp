@@ -0,0 +1,112 @@
+#include "JobSystem.h"
+
+#include "Determinism.h"
+#include "TraceRecorder.h"
+
+std::atomic<int> JobSystem::workerCountOverride{ -1 };
+
+JobSystem::JobSystem(unsigned int workerCount) {
+    workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&JobSystem::workerLoop, this);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+    for (auto &worker: workers) {
+        worker.join();
+    }
+}
+
+void JobSystem::parallelFor(unsigned int size, unsigned int grainSize, JobFunction function, void *context) {
+    if (size == 0)
+        return;
+    if (grainSize == 0)
+        grainSize = 1;
+
+    // Not worth waking the workers
+    if (workers.empty() || size <= grainSize) {
+        function(context, 0, size);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    doneCondition.wait(lock, [this] { return busyWorkers == 0; });
+    job = function;
+    jobContext = context;
+    jobSize = size;
+    jobGrainSize = grainSize;
+    jobChunkCount = (size + grainSize - 1) / grainSize;
+    nextChunk.store(0);
+    jobFloatingPointMode = Determinism::getFloatingPointMode();
+    jobAllocationScope = AllocationTracker::getThreadScope();
+    generation++;
+    lock.unlock();
+    wakeCondition.notify_all();
+
+    while (runChunk()) {
+    }
+
+    // Every chunk has been taken, wait for the workers still running one
+    lock.lock();
+    doneCondition.wait(lock, [this] { return busyWorkers == 0; });
+}
+
+unsigned int JobSystem::getWorkerCount() const {
+    return static_cast<unsigned int>(workers.size());
+}
+
+unsigned int JobSystem::defaultWorkerCount() {
+    int workerCount = workerCountOverride.load();
+    if (workerCount >= 0)
+        return static_cast<unsigned int>(workerCount);
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+void JobSystem::setDefaultWorkerCount(int workerCount) {
+    workerCountOverride.store(workerCount);
+}
+
+void JobSystem::workerLoop() {
+    unsigned long seenGeneration = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wakeCondition.wait(lock, [this, &seenGeneration] { return stopping || generation != seenGeneration; });
+        if (stopping)
+            return;
+        seenGeneration = generation;
+        busyWorkers++;
+        lock.unlock();
+
+        Determinism::setFloatingPointMode(jobFloatingPointMode);
+        AllocationTracker::setThreadScope(jobAllocationScope);
+        while (runChunk()) {
+        }
+        AllocationTracker::setThreadScope(nullptr);
+
+        lock.lock();
+        if (--busyWorkers == 0)
+            doneCondition.notify_all();
+    }
+}
+
+bool JobSystem::runChunk() {
+    unsigned int chunk = nextChunk.fetch_add(1);
+    if (chunk >= jobChunkCount)
+        return false;
+    unsigned int begin = chunk * jobGrainSize;
+    unsigned int end = begin + jobGrainSize < jobSize ? begin + jobGrainSize : jobSize;
+    if (TraceRecorder::isRecording()) {
+        TraceScope trace("Job");
+        job(jobContext, begin, end);
+    } else {
+        job(jobContext, begin, end);
+    }
+    return true;
+}
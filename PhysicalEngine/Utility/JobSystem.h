@@ -0,0 +1,76 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include "AllocationTracker.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Pool de threads persistant pour exécuter des boucles parallèles sans allocation par appel.
+/// Le travail est découpé en blocs de grainSize éléments, le thread appelant participe aussi.
+/// </summary>
+class JobSystem {
+public:
+    /// Fonction exécutée sur l'intervalle [begin, end), context est passé tel quel
+    using JobFunction = void (*)(void *context, unsigned int begin, unsigned int end);
+
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable doneCondition;
+
+    // Current job, only written while no worker is busy
+    JobFunction job = nullptr;
+    void *jobContext = nullptr;
+    unsigned int jobSize = 0;
+    unsigned int jobGrainSize = 1;
+    unsigned int jobChunkCount = 0;
+    std::atomic<unsigned int> nextChunk{ 0 };
+    // Floating point environment of the calling thread, copied by the workers so every chunk computes alike
+    unsigned int jobFloatingPointMode = 0;
+    // Allocation scope of the calling thread (its profiler stage), adopted by the workers while they run the job
+    AllocationScope *jobAllocationScope = nullptr;
+
+    unsigned long generation = 0;
+    unsigned int busyWorkers = 0;
+    bool stopping = false;
+
+    static std::atomic<int> workerCountOverride;
+
+public:
+    explicit JobSystem(unsigned int workerCount = defaultWorkerCount());
+
+    JobSystem(const JobSystem &) = delete;
+
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    ~JobSystem();
+
+    /// <summary>
+    /// Exécute job sur [0, size) et attend la fin de tous les blocs
+    /// </summary>
+    void parallelFor(unsigned int size, unsigned int grainSize, JobFunction function, void *context);
+
+    unsigned int getWorkerCount() const;
+
+    /// <summary>
+    /// Nombre de threads hardware - 1, ou la valeur donnée à setDefaultWorkerCount
+    /// </summary>
+    static unsigned int defaultWorkerCount();
+
+    /// <summary>
+    /// Impose le nombre de workers des JobSystem créés ensuite, une valeur négative rétablit le nombre par défaut
+    /// </summary>
+    static void setDefaultWorkerCount(int workerCount);
+
+private:
+    void workerLoop();
+
+    bool runChunk();
+};
+
+#endif // JOBSYSTEM_H
@@ -0,0 +1,101 @@
+#include "MappedFile.h"
+
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string &path) {
+    close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        std::cerr << "MappedFile: cannot open " << path << std::endl;
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        std::cerr << "MappedFile: " << path << " is empty" << std::endl;
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void *view = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view == nullptr) {
+        std::cerr << "MappedFile: cannot map " << path << std::endl;
+        if (mapping != nullptr)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    data = static_cast<const unsigned char *>(view);
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        std::cerr << "MappedFile: cannot open " << path << std::endl;
+        return false;
+    }
+    struct stat status{};
+    if (fstat(descriptor, &status) != 0 || status.st_size == 0) {
+        std::cerr << "MappedFile: " << path << " is empty" << std::endl;
+        ::close(descriptor);
+        return false;
+    }
+    void *view = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (view == MAP_FAILED) {
+        std::cerr << "MappedFile: cannot map " << path << std::endl;
+        ::close(descriptor);
+        return false;
+    }
+    fileDescriptor = descriptor;
+    data = static_cast<const unsigned char *>(view);
+    size = static_cast<std::size_t>(status.st_size);
+#endif
+    return true;
+}
+
+void MappedFile::close() {
+    if (data == nullptr)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(mappingHandle);
+    CloseHandle(fileHandle);
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    munmap(const_cast<unsigned char *>(data), size);
+    ::close(fileDescriptor);
+    fileDescriptor = -1;
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+bool MappedFile::isOpen() const {
+    return data != nullptr;
+}
+
+const unsigned char *MappedFile::getData() const {
+    return data;
+}
+
+std::size_t MappedFile::getSize() const {
+    return size;
+}
@@ -0,0 +1,43 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+/// <summary>
+/// Fichier projeté en mémoire en lecture seule : les pages sont chargées par le système à la première lecture,
+/// un gros fichier n'est donc jamais copié entièrement en RAM.
+/// </summary>
+class MappedFile {
+private:
+    const unsigned char *data = nullptr;
+    std::size_t size = 0;
+#ifdef _WIN32
+    void *fileHandle = nullptr;
+    void *mappingHandle = nullptr;
+#else
+    int fileDescriptor = -1;
+#endif
+
+public:
+    MappedFile() = default;
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile();
+
+public:
+    bool open(const std::string &path);
+
+    void close();
+
+    bool isOpen() const;
+
+    const unsigned char *getData() const;
+
+    std::size_t getSize() const;
+};
+
+#endif // MAPPEDFILE_H
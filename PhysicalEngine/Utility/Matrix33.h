@@ -4,45 +4,59 @@
 #include "Vector3d.h"
 #include "Quaternion.h"
 
-class Matrix33 {
+template <typename Precision>
+class Matrix33T {
+public:
+    using Scalar = typename Precision::Scalar;
 
 private:
-    float m_value[9];
+    Scalar m_value[9];
 
 public:
     /// <summary>
     /// Matrice avec que des 0
     /// </summary>
-    Matrix33();
+    constexpr Matrix33T() : m_value{} {
+    }
 
 
     /// <summary>
-    /// Constructeur de Matrix33 avec un tableau les valeurs sont lignes par lignes: 0-2 ligne 1, 3-5 ligne 2 ,...
+    /// Constructeur de Matrix33T avec un tableau les valeurs sont lignes par lignes: 0-2 ligne 1, 3-5 ligne 2 ,...
     /// </summary>
     /// <param name="values"></param>
-    explicit Matrix33(const float values[9]);
-
-    /// <summary>
-    /// Constructeur de copie
-    /// </summary>
-    /// <param name="matrixToCopyFrom"></param>
-    Matrix33(const Matrix33 &matrixToCopyFrom);
+    constexpr explicit Matrix33T(const Scalar values[9]) : m_value{} {
+        for (int i = 0; i < 9; i++) {
+            m_value[i] = values[i];
+        }
+    }
 
     /// <summary>
     /// Produit Matricielle
     /// </summary>
     /// <param name="other"></param>
     /// <returns></returns>
-    Matrix33 operator*(const Matrix33 &other);
-
-    Matrix33 &operator=(const Matrix33 &other);
+    constexpr Matrix33T operator*(const Matrix33T &other) const {
+        Matrix33T res;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                for (int k = 0; k < 3; k++) {
+                    res.m_value[i * 3 + j] += m_value[i * 3 + k] * other.m_value[k * 3 + j];
+                }
+            }
+        }
+        return res;
+    }
 
     /// <summary>
     /// Produit matricielle
     /// </summary>
     /// <param name="other"></param>
     /// <returns></returns>
-    Vector3d operator*(const Vector3d &other);
+    constexpr Vector3dT<Precision> operator*(const Vector3dT<Precision> &other) const {
+        return { m_value[0] * other.x + m_value[1] * other.y + m_value[2] * other.z,
+                 m_value[3] * other.x + m_value[4] * other.y + m_value[5] * other.z,
+                 m_value[6] * other.x + m_value[7] * other.y + m_value[8] * other.z };
+    }
 
     /// <summary>
     /// élément ligne i colonne j const
@@ -50,41 +64,103 @@ public:
     /// <param name="i"></param>
     /// <param name="j"></param>
     /// <returns></returns>
-    float operator()(int i, int j) const;
+    constexpr Scalar operator()(int i, int j) const {
+        return m_value[3 * i + j];
+    }
 
     /// <summary>
     /// Renvoie l'inverse de la matrice const
     /// </summary>
     /// <returns></returns>
-    Matrix33 inverse() const;
+    Matrix33T inverse() const {
+        Scalar det1 = m_value[0] * ((m_value[3 * 1 + 1] * m_value[3 * 2 + 2]) - (m_value[3 * 2 + 1] * m_value[3 * 1 + 2]));
+        Scalar det2 = m_value[3 * 0 + 1] *
+                     ((m_value[3 * 1 + 0]) * (m_value[3 * 2 + 2]) - (m_value[3 * 2 + 0] * m_value[3 * 1 + 2]));
+        Scalar det3 = m_value[3 * 0 + 2] *
+                     ((m_value[3 * 1 + 0]) * (m_value[3 * 2 + 1]) - (m_value[3 * 2 + 0] * m_value[3 * 1 + 1]));
+        Scalar determinant = det1 - det2 + det3;
+        if (determinant == 0) {
+            throw "not reversible";
+        }
+        Matrix33T res;
+        res.m_value[0] =
+                ((m_value[3 * 1 + 1] * m_value[3 * 2 + 2]) - (m_value[3 * 2 + 1] * m_value[3 * 1 + 2])) / determinant;
+        res.m_value[1] = -((m_value[3 * 1 + 0] * m_value[3 * 2 + 2]) -
+                           (m_value[3 * 2 + 0] * m_value[3 * 1 + 2])) / determinant;
+        res.m_value[2] = +((m_value[3 * 1 + 0] * m_value[3 * 2 + 1]) -
+                           (m_value[3 * 2 + 0] * m_value[3 * 1 + 1])) / determinant;
+        res.m_value[3] = -((m_value[3 * 0 + 1] * m_value[3 * 2 + 2]) -
+                           (m_value[3 * 2 + 1] * m_value[3 * 0 + 2])) / determinant;
+        res.m_value[4] = +((m_value[3 * 0 + 0] * m_value[3 * 2 + 2]) -
+                           (m_value[3 * 2 + 0] * m_value[3 * 0 + 2])) / determinant;
+        res.m_value[5] = -((m_value[3 * 0 + 0] * m_value[3 * 2 + 1]) -
+                           (m_value[3 * 2 + 0] * m_value[3 * 0 + 1])) / determinant;
+        res.m_value[6] = +((m_value[3 * 0 + 1] * m_value[3 * 1 + 2]) -
+                           (m_value[3 * 1 + 1] * m_value[3 * 0 + 2])) / determinant;
+        res.m_value[7] = -((m_value[3 * 0 + 0] * m_value[3 * 1 + 2]) -
+                           (m_value[3 * 1 + 0] * m_value[3 * 0 + 2])) / determinant;
+        res.m_value[8] = +((m_value[3 * 0 + 0] * m_value[3 * 1 + 1]) -
+                           (m_value[3 * 1 + 0] * m_value[3 * 0 + 1])) / determinant;
+        return res;
+    }
 
     /// <summary>
     /// renvoie la transposition de la matrice const
     /// </summary>
     /// <returns></returns>
-    Matrix33 transpose() const;
+    constexpr Matrix33T transpose() const {
+        Matrix33T res;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                res.m_value[3 * i + j] = m_value[3 * j + i];
+            }
+        }
+        return res;
+    }
 
     /// <summary>
     /// inverse la matrice
     /// </summary>
-    void inverseMat();
+    void inverseMat() {
+        *this = inverse();
+    }
 
     /// <summary>
     /// transpose la matrice
     /// </summary>
-    void transposeMat();
+    constexpr void transposeMat() {
+        *this = transpose();
+    }
 
     /// <summary>
     /// Génère la matrice de rotation à partir d'un quaternion
     /// </summary>
     /// <param name="quaternion"></param>
-    void setOrientation(const Quaternion &quaternion);
-
-//    float operator[](int i) const;
-
-    friend std::ostream &operator<<(std::ostream &os, const Matrix33 &matrix33);
-
-    ~Matrix33();
+    constexpr void setOrientation(const QuaternionT<Precision> &quaternion) {
+        Scalar w = quaternion[0], x = quaternion[1], y = quaternion[2], z = quaternion[3];
+        m_value[0] = 1 - (2 * y * y + 2 * z * z);
+        m_value[1] = 2 * x * y - 2 * z * w;
+        m_value[2] = 2 * x * z + 2 * y * w;
+        m_value[3] = 2 * x * y + 2 * z * w;
+        m_value[4] = 1 - (2 * x * x + 2 * z * z);
+        m_value[5] = 2 * y * z - 2 * x * w;
+        m_value[6] = 2 * x * z - 2 * y * w;
+        m_value[7] = 2 * y * z + 2 * x * w;
+        m_value[8] = 1 - (2 * x * x + 2 * y * y);
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const Matrix33T &matrix33) {
+        os << "Matrix33: " << std::endl;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                os << matrix33.m_value[3 * i + j] << " ";
+            }
+            os << std::endl;
+        }
+        return os;
+    }
 };
 
+using Matrix33 = Matrix33T<DefaultPrecision>;
+
 #endif // !MATRIX33_H
@@ -5,37 +5,113 @@
 #include "Matrix33.h"
 #include "Matrix44.h"
 #include "Quaternion.h"
+#include "Simd.h"
 #include "Vector3d.h"
 
-class Matrix34 {
+namespace Simd {
+
+    /// Changement de base affine (m ligne par ligne, 3x4), translation ajoutée si translate
+    template <typename Precision>
+    inline Vector3dT<Precision> transformAffine(const typename Precision::Scalar* m, const Vector3dT<Precision>& vec, bool translate) {
+        Vector3dT<Precision> res = { m[0] * vec.x + m[1] * vec.y + m[2] * vec.z,
+                                     m[4] * vec.x + m[5] * vec.y + m[6] * vec.z,
+                                     m[8] * vec.x + m[9] * vec.y + m[10] * vec.z };
+        if (translate)
+        {
+            res.x += m[3];
+            res.y += m[7];
+            res.z += m[11];
+        }
+        return res;
+    }
+
+#ifdef PHYSICALENGINE_SIMD_SSE
+    /// Version SSE : les 3 lignes (+ une ligne nulle) sont transposées pour obtenir les colonnes (x, y, z, 0)
+    /// puis ((c0 * x + c1 * y) + c2 * z) + c3, même ordre d'évaluation que la version scalaire.
+    /// Le chemin FMA n'est compilé que hors PHYSICALENGINE_STRICT_FLOATING_POINT, il n'arrondit pas les produits
+    inline Vector3dT<SinglePrecision> transformAffine(const float* m, const Vector3dT<SinglePrecision>& vec, bool translate) {
+        __m128 c0 = _mm_load_ps(m);
+        __m128 c1 = _mm_load_ps(m + 4);
+        __m128 c2 = _mm_load_ps(m + 8);
+        __m128 c3 = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+#ifdef PHYSICALENGINE_SIMD_FMA
+        __m128 res = _mm_mul_ps(c0, _mm_set1_ps(vec.x));
+        res = _mm_fmadd_ps(c1, _mm_set1_ps(vec.y), res);
+        res = _mm_fmadd_ps(c2, _mm_set1_ps(vec.z), res);
+#else
+        __m128 res = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(vec.x)), _mm_mul_ps(c1, _mm_set1_ps(vec.y)));
+        res = _mm_add_ps(res, _mm_mul_ps(c2, _mm_set1_ps(vec.z)));
+#endif
+        if (translate)
+        {
+            res = _mm_add_ps(res, c3);
+        }
+        return Vector3dT<SinglePrecision>::fromSimd(res);
+    }
+#endif
+
+}
+
+template <typename Precision>
+class Matrix34T {
+public:
+    using Scalar = typename Precision::Scalar;
 
 private:
-    float m_value[12];
+    alignas(16) Scalar m_value[12];
 
 public:
     /// <summary>
     /// Constructeur avec que de 0 dans la matrice
     /// </summary>
-    Matrix34();
+    constexpr Matrix34T() : m_value{} {
+    }
 
     /// <summary>
     /// Constructeur de Matrix Ligne par ligne (0-3) ligne 1 ,(4-7) ligne 2 ...)
     /// </summary>
     /// <param name="values"></param>
-    explicit Matrix34(float values[12]);
+    constexpr explicit Matrix34T(const Scalar values[12]) : m_value{} {
+        for (int i = 0; i < 12; i++)
+        {
+            m_value[i] = values[i];
+        }
+    }
 
     /// <summary>
     /// Extrait la matrice 33 en haut à gauche de la matrice de transformation affine soit la matrice de rotation
     /// </summary>
     /// <returns></returns>
-    Matrix33 extractMatrix33() const;
+    constexpr Matrix33T<Precision> extractMatrix33() const {
+        Scalar valueRes[9] = {};
+        for (int i = 0; i < 3; i++)
+        {
+            for (int j = 0; j < 3; j++)
+            {
+                valueRes[3 * i + j] = m_value[4 * i + j];
+            }
+        }
+        return Matrix33T<Precision>(valueRes);
+    }
 
     /// <summary>
     /// génère la matrice 34 à partir de sa matrice de rotation et son vecteur de translation
     /// </summary>
     /// <param name="rotationMatrix"></param>
     /// <param name="translation"></param>
-    void setFromRotationTranslation(const Matrix33& rotationMatrix, const Vector3d& translation);
+    constexpr void setFromRotationTranslation(const Matrix33T<Precision>& rotationMatrix, const Vector3dT<Precision>& translation) {
+        for (int i = 0; i < 3; i++)
+        {
+            for (int j = 0; j < 3; j++)
+            {
+                m_value[4 * i + j] = rotationMatrix(i, j);
+            }
+        }
+        m_value[3] = translation.x;
+        m_value[7] = translation.y;
+        m_value[11] = translation.z;
+    }
 
     /// <summary>
     /// énère la matrice 34 à partir de sa matrice de rotation et son vecteur de translation
@@ -43,16 +119,38 @@ public:
     /// <param name="rotationMatrix"></param>
     /// <param name="translation"></param>
     /// <returns></returns>
-    Matrix34 matrix34FromRotationTranslation(const Matrix33& rotationMatrix, const Vector3d& translation) const;
+    constexpr Matrix34T matrix34FromRotationTranslation(const Matrix33T<Precision>& rotationMatrix, const Vector3dT<Precision>& translation) const {
+        Matrix34T res;
+        res.setFromRotationTranslation(rotationMatrix, translation);
+        return res;
+    }
 
     /// <summary>
     /// Produit Matriciel avec la matrice de transposition affine (Mat34-> Mat44 affine)*(Mat34->Mat44 affine)  -> Mat34
+    /// La dernière ligne (0 0 0 1) est implicite, on évite de passer par deux Matrix44
     /// </summary>
     /// <param name="other"></param>
     /// <returns></returns>
-    Matrix34 operator*(const Matrix34& other) const;
-
-    Matrix34& operator=(const Matrix34& other);
+    constexpr Matrix34T operator*(const Matrix34T& other) const {
+        Matrix34T res;
+        for (int i = 0; i < 3; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                Scalar value = 0;
+                for (int k = 0; k < 3; k++)
+                {
+                    value += m_value[4 * i + k] * other.m_value[4 * k + j];
+                }
+                if (j == 3)
+                {
+                    value += m_value[4 * i + 3];
+                }
+                res.m_value[4 * i + j] = value;
+            }
+        }
+        return res;
+    }
 
     /// <summary>
     /// renvoie l'élément ligne i colonne j
@@ -60,37 +158,65 @@ public:
     /// <param name="i"></param>
     /// <param name="j"></param>
     /// <returns></returns>
-    float operator()(int i, int j);
+    constexpr Scalar operator()(int i, int j) const {
+        return m_value[4 * i + j];
+    }
+
     /// <summary>
     /// inverse de la Matrice const
     /// </summary>
     /// <returns></returns>
-    Matrix34 inverse() const;
+    Matrix34T inverse() const {
+        Matrix33T<Precision> M33Inv = extractMatrix33().inverse();
+        Vector3dT<Precision> vecInv = M33Inv * Vector3dT<Precision>(-m_value[3], -m_value[7], -m_value[11]);
+        return matrix34FromRotationTranslation(M33Inv, vecInv);
+    }
 
     /// <summary>
     /// inverse la matrice
     /// </summary>
-    void inverseMat();
+    void inverseMat() {
+        *this = inverse();
+    }
 
     /// <summary>
     /// Transforme une matrice 44 de transformation affine en matrix 3 4 (const)
     /// </summary>
     /// <param name="mat44"></param>
     /// <returns></returns>
-    Matrix34 transformationAffineMatrixToMatrix34(const Matrix44& mat44) const;
+    constexpr Matrix34T transformationAffineMatrixToMatrix34(const Matrix44T<Precision>& mat44) const {
+        Matrix34T res;
+        for (int k = 0; k < 12; k++)
+        {
+            res.m_value[k] = mat44[k];
+        }
+        return res;
+    }
 
     /// <summary>
     /// Genere la matrix 44 de transformation affine à partir de *this
     /// </summary>
     /// <returns></returns>
-    Matrix44 transformationAffineMatrix() const;
+    constexpr Matrix44T<Precision> transformationAffineMatrix() const {
+        Scalar values[16] = {};
+        for (int k = 0; k < 12; k++)
+        {
+            values[k] = m_value[k];
+        }
+        values[15] = 1;
+        return Matrix44T<Precision>(values);
+    }
 
     /// <summary>
     /// Génère la matrice de transformation avec une orientation et une position
     /// </summary>
     /// <param name="quaternion"></param>
     /// <param name="vec"></param>
-    void setOrientationAndPosition(const Quaternion& quaternion, const Vector3d& translation);
+    constexpr void setOrientationAndPosition(const QuaternionT<Precision>& quaternion, const Vector3dT<Precision>& translation) {
+        Matrix33T<Precision> rotationMatrix;
+        rotationMatrix.setOrientation(quaternion);
+        setFromRotationTranslation(rotationMatrix, translation);
+    }
 
 
     /// <summary>
@@ -98,18 +224,20 @@ public:
     /// </summary>
     /// <param name="vec"></param>
     /// <returns></returns>
-    Vector3d transformPosition(Vector3d vec) const;
+    Vector3dT<Precision> transformPosition(const Vector3dT<Precision>& vec) const {
+        return Simd::transformAffine(m_value, vec, true);
+    }
 
     /// <summary>
     /// Effectue un changement de base d'un vecteur suivant la matrice de Transformation this en ignorant la translation
     /// </summary>
     /// <param name="vec"></param>
     /// <returns></returns>
-    Vector3d transformDirection(Vector3d vec) const;
-
-
-    ~Matrix34();
+    Vector3dT<Precision> transformDirection(const Vector3dT<Precision>& vec) const {
+        return Simd::transformAffine(m_value, vec, false);
+    }
 };
 
+using Matrix34 = Matrix34T<DefaultPrecision>;
 
 #endif // !1
@@ -1,21 +1,32 @@
 #ifndef MATRIX44_H
 #define MATRIX44_H
 
-class Matrix44 {
+#include "Precision.h"
+
+template <typename Precision>
+class Matrix44T {
+public:
+    using Scalar = typename Precision::Scalar;
+
 private:
 
-    float m_value[16];
+    Scalar m_value[16];
 public:
     /// <summary>
     /// Constructeur matrix vide
     /// </summary>
-    Matrix44();
+    constexpr Matrix44T() : m_value{} {
+    }
 
     /// <summary>
     /// Constructeur de Matrix Ligne par ligne (0-3) ligne 1 ,(4-7) ligne 2 ...)
     /// </summary>
     /// <param name="m_value"></param>
-    Matrix44(float m_value[16]);
+    constexpr Matrix44T(const Scalar values[16]) : m_value{} {
+        for (int i = 0; i < 16; i++) {
+            m_value[i] = values[i];
+        }
+    }
 
     /// <summary>
     /// Accède à un élément ligne i colone j
@@ -23,25 +34,37 @@ public:
     /// <param name="i"></param>
     /// <param name="j"></param>
     /// <returns></returns>
-    float operator()(int i, int j) const;
+    constexpr Scalar operator()(int i, int j) const {
+        return m_value[4 * i + j];
+    }
 
     /// <summary>
     /// renvoie m_value[i] si on cherche un élément ligne i , colone j faire : [4*i+j]
     /// </summary>
     /// <param name="i"></param>
     /// <returns></returns>
-    float operator[](int i) const;
+    constexpr Scalar operator[](int i) const {
+        return m_value[i];
+    }
 
     /// <summary>
     /// produit matriciel de 2 matrices
     /// </summary>
     /// <param name="matrix"></param>
     /// <returns></returns>
-    Matrix44 operator*(const Matrix44 &matrix);
-
-
-    ~Matrix44();
-
+    constexpr Matrix44T operator*(const Matrix44T &matrix) const {
+        Matrix44T res;
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 4; j++) {
+                for (int k = 0; k < 4; k++) {
+                    res.m_value[4 * i + j] += m_value[4 * i + k] * matrix.m_value[4 * k + j];
+                }
+            }
+        }
+        return res;
+    }
 };
 
+using Matrix44 = Matrix44T<DefaultPrecision>;
+
 #endif // !1MATRIX44_H
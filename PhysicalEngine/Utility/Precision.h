@@ -0,0 +1,25 @@
+#ifndef PRECISION_H
+#define PRECISION_H
+
+// Scalar policies used to instantiate the math types (Vector3dT, QuaternionT, Matrix33T/34T/44T).
+// The engine is built with one policy selected by the PHYSICALENGINE_DOUBLE_PRECISION option:
+// float keeps the SIMD fast path for small scenes, double keeps precision far from the origin.
+
+struct SinglePrecision {
+    using Scalar = float;
+};
+
+struct DoublePrecision {
+    using Scalar = double;
+};
+
+#ifdef PHYSICALENGINE_DOUBLE_PRECISION
+using DefaultPrecision = DoublePrecision;
+#else
+using DefaultPrecision = SinglePrecision;
+#endif
+
+/// Scalaire utilisé par la simulation (positions, vitesses, masses, ...)
+using real = DefaultPrecision::Scalar;
+
+#endif // PRECISION_H
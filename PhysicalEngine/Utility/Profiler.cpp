@@ -0,0 +1,109 @@
+#include "Profiler.h"
+
+#include "AllocationTracker.h"
+#include "TraceRecorder.h"
+
+#include <algorithm>
+
+const char *Profiler::stagesNamesList[PROFILER_STAGE_COUNT] = {
+        "Camera",
+        "Components update",
+        "Physic handler",
+        "Constraints",
+        "Collect colliders",
+        "Generate contacts",
+        "Resolve contacts",
+        "Octree clean",
+        "Octree insert",
+        "Octree test",
+};
+
+const char *Profiler::countersNamesList[PROFILER_COUNTER_COUNT] = {
+        "Candidate pairs",
+        "Contacts",
+        "Solver iterations",
+        "Constraints",
+        "Constraint colors",
+};
+
+void Profiler::beginFrame() {
+    for (float &stageTime: stageTimes) {
+        stageTime = 0;
+    }
+    for (unsigned int &counter: counters) {
+        counter = 0;
+    }
+    for (int stage = 0; stage < PROFILER_STAGE_COUNT; stage++) {
+        stageAllocations[stage] = 0;
+        stageAllocatedBytes[stage] = 0;
+        stagePeakBytes[stage] = 0;
+    }
+}
+
+void Profiler::addStageTime(ProfilerStage stage, float milliseconds) {
+    stageTimes[stage] += milliseconds;
+}
+
+void Profiler::addStageAllocations(ProfilerStage stage, unsigned long long allocations, unsigned long long bytes,
+                                   long long peakBytes) {
+    stageAllocations[stage] += allocations;
+    stageAllocatedBytes[stage] += bytes;
+    stagePeakBytes[stage] = std::max(stagePeakBytes[stage], peakBytes);
+}
+
+void Profiler::setCounter(ProfilerCounter counter, unsigned int value) {
+    counters[counter] = value;
+}
+
+float Profiler::getStageTime(ProfilerStage stage) const {
+    return stageTimes[stage];
+}
+
+unsigned int Profiler::getCounter(ProfilerCounter counter) const {
+    return counters[counter];
+}
+
+float Profiler::getTotalTime() const {
+    float total = 0;
+    for (float stageTime: stageTimes) {
+        total += stageTime;
+    }
+    return total;
+}
+
+unsigned long long Profiler::getStageAllocations(ProfilerStage stage) const {
+    return stageAllocations[stage];
+}
+
+unsigned long long Profiler::getStageAllocatedBytes(ProfilerStage stage) const {
+    return stageAllocatedBytes[stage];
+}
+
+long long Profiler::getStagePeakBytes(ProfilerStage stage) const {
+    return stagePeakBytes[stage];
+}
+
+unsigned long long Profiler::getTotalAllocations() const {
+    unsigned long long total = 0;
+    for (unsigned long long allocations: stageAllocations) {
+        total += allocations;
+    }
+    return total;
+}
+
+ScopedTimer::ScopedTimer(Profiler &profiler, ProfilerStage stage)
+        : profiler(profiler), stage(stage), start(std::chrono::steady_clock::now()) {
+    allocationScope.parent = AllocationTracker::getThreadScope();
+    AllocationTracker::setThreadScope(&allocationScope);
+}
+
+ScopedTimer::~ScopedTimer() {
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    std::chrono::duration<float, std::milli> elapsed = end - start;
+    profiler.addStageTime(stage, elapsed.count());
+    AllocationTracker::setThreadScope(allocationScope.parent);
+    profiler.addStageAllocations(stage, allocationScope.allocationCount.load(std::memory_order_relaxed),
+                                 allocationScope.allocatedBytes.load(std::memory_order_relaxed),
+                                 allocationScope.peakBytes.load(std::memory_order_relaxed));
+    TraceRecorder::record(Profiler::stagesNamesList[stage], start, end);
+}
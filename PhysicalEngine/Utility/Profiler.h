@@ -0,0 +1,102 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "AllocationTracker.h"
+#include <chrono>
+
+enum ProfilerStage {
+    PROFILER_STAGE_CAMERA = 0,
+    PROFILER_STAGE_COMPONENTS,
+    PROFILER_STAGE_PHYSIC_HANDLER,
+    PROFILER_STAGE_CONSTRAINTS,
+    PROFILER_STAGE_COLLECT_COLLIDERS,
+    PROFILER_STAGE_GENERATE_CONTACTS,
+    PROFILER_STAGE_RESOLVE_CONTACTS,
+    PROFILER_STAGE_OCTREE_CLEAN,
+    PROFILER_STAGE_OCTREE_INSERT,
+    PROFILER_STAGE_OCTREE_TEST,
+    PROFILER_STAGE_COUNT
+};
+
+enum ProfilerCounter {
+    PROFILER_COUNTER_CANDIDATE_PAIRS = 0,
+    PROFILER_COUNTER_CONTACTS,
+    PROFILER_COUNTER_SOLVER_ITERATIONS,
+    PROFILER_COUNTER_CONSTRAINTS,
+    PROFILER_COUNTER_CONSTRAINT_COLORS,
+    PROFILER_COUNTER_COUNT
+};
+
+/// <summary>
+/// Temps (en ms) de chaque étape du pas de simulation et compteurs associés, remis à zéro à chaque pas.
+/// Les allocations par étape ne sont renseignées que si l'AllocationTracker est compilé, elles ne comptent que
+/// celles du thread qui exécute l'étape et des workers de ses JobSystem (pas celles de l'interface ou des autres
+/// threads du lanceur).
+/// </summary>
+class Profiler {
+public:
+    static const char *stagesNamesList[PROFILER_STAGE_COUNT];
+
+    static const char *countersNamesList[PROFILER_COUNTER_COUNT];
+
+private:
+    float stageTimes[PROFILER_STAGE_COUNT] = {};
+    unsigned int counters[PROFILER_COUNTER_COUNT] = {};
+    unsigned long long stageAllocations[PROFILER_STAGE_COUNT] = {};
+    unsigned long long stageAllocatedBytes[PROFILER_STAGE_COUNT] = {};
+    long long stagePeakBytes[PROFILER_STAGE_COUNT] = {};
+
+public:
+    void beginFrame();
+
+    void addStageTime(ProfilerStage stage, float milliseconds);
+
+    void addStageAllocations(ProfilerStage stage, unsigned long long allocations, unsigned long long bytes,
+                             long long peakBytes);
+
+    void setCounter(ProfilerCounter counter, unsigned int value);
+
+    float getStageTime(ProfilerStage stage) const;
+
+    unsigned int getCounter(ProfilerCounter counter) const;
+
+    /// <summary>
+    /// Somme des temps de toutes les étapes du pas
+    /// </summary>
+    float getTotalTime() const;
+
+    unsigned long long getStageAllocations(ProfilerStage stage) const;
+
+    unsigned long long getStageAllocatedBytes(ProfilerStage stage) const;
+
+    /// <summary>
+    /// Plus forte croissance du tas due à l'étape (octets alloués moins octets libérés par ses threads)
+    /// </summary>
+    long long getStagePeakBytes(ProfilerStage stage) const;
+
+    unsigned long long getTotalAllocations() const;
+};
+
+/// <summary>
+/// Mesure le temps passé dans le bloc courant et l'ajoute à l'étape du profiler à la destruction,
+/// l'intervalle est aussi transmis au TraceRecorder. Les allocations du thread sont comptées dans l'étape
+/// le temps du bloc (les timers imbriqués comptent aussi dans les étapes englobantes).
+/// </summary>
+class ScopedTimer {
+private:
+    Profiler &profiler;
+    ProfilerStage stage;
+    std::chrono::steady_clock::time_point start;
+    AllocationScope allocationScope;
+
+public:
+    ScopedTimer(Profiler &profiler, ProfilerStage stage);
+
+    ScopedTimer(const ScopedTimer &) = delete;
+
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    ~ScopedTimer();
+};
+
+#endif // PROFILER_H
@@ -1,101 +1,144 @@
 #ifndef QUATERNION_H
 #define QUATERNION_H
 
+#include "Simd.h"
 #include "Vector3d.h"
 #include <cmath>
 
-class Quaternion {
+template <typename Precision>
+class QuaternionT {
+public:
+    using Scalar = typename Precision::Scalar;
 
 private:
-    float m_value[4];
+    alignas(16) Scalar m_value[4];
 
 public:
     /// <summary>
     /// Constructeur avec uniquement des 0
     /// </summary>
-    Quaternion();
+    constexpr QuaternionT() : m_value{ 1, 0, 0, 0 } {
+    }
 
     /// <summary>
-    /// Constructeur de copy
+    /// Constructeur avec une vecteur : {0,Vector3d}
     /// </summary>
-    /// <param name="quaternion"></param>
-    Quaternion(const Quaternion& quaternion);
+    /// <param name="vec"></param>
+    constexpr QuaternionT(const Vector3dT<Precision>& vec) : m_value{ 0, vec.x, vec.y, vec.z } {
+    }
 
     /// <summary>
-    /// Constructeur avec une vecteur : {0,Vector3d}
+    /// Constructeur avec les 4 composantes
     /// </summary>
-    /// <param name="vec"></param>
-    Quaternion(const Vector3d& vec);
+    /// <param name="w"></param>
+    /// <param name="x"></param>
+    /// <param name="y"></param>
+    /// <param name="z"></param>
+    constexpr QuaternionT(Scalar w, Scalar x, Scalar y, Scalar z) : m_value{ w, x, y, z } {
+    }
 
     /// <summary>
     /// norm d'un quaternion
     /// </summary>
     /// <returns></returns>
-    float norm();
+    Scalar norm() const {
+        Scalar sumSquar = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            sumSquar += m_value[i] * m_value[i];
+        }
+        return std::sqrt(sumSquar);
+    }
 
     /// <summary>
     /// normalize le quaternion
     /// </summary>
-    void normalize();
-
-    /// <summary>
-    /// Constructeur avec les 4 composantes
-    /// </summary>
-    /// <param name="w"></param>
-    /// <param name="x"></param>
-    /// <param name="y"></param>
-    /// <param name="z"></param>
-    Quaternion(float w, float x, float y, float z);
-
-    Quaternion& operator=(const Quaternion& quaternion);
+    void normalize() {
+        Scalar n = norm();
+        if (n != 0)
+        {
+            Simd::div4(m_value, n);
+        }
+    }
 
     /// <summary>
     /// Multiplication de quaternion selon le produit hamiltonien
     /// <param name="quaternion"></param>
     /// <returns></returns>
-    Quaternion& operator*=(const Quaternion& quaternion);
+    constexpr QuaternionT& operator*=(const QuaternionT& quaternion) {
+        Scalar w1 = m_value[0], x1 = m_value[1], y1 = m_value[2], z1 = m_value[3];
+        Scalar w2 = quaternion.m_value[0], x2 = quaternion.m_value[1], y2 = quaternion.m_value[2], z2 = quaternion.m_value[3];
+        m_value[0] = w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2;
+        m_value[1] = w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2;
+        m_value[2] = w1 * y2 + y1 * w2 + z1 * x2 - x1 * z2;
+        m_value[3] = w1 * z2 + z1 * w2 + x1 * y2 - y1 * x2;
+        return *this;
+    }
 
     /// <summary>
     /// Multiplication de quaternion selon le produit hamiltonien methode constante
     /// </summary>
     /// <param name="quaternion"></param>
     /// <returns></returns>
-    Quaternion operator*(const Quaternion& quaternion);
+    constexpr QuaternionT operator*(const QuaternionT& quaternion) const {
+        QuaternionT res(*this);
+        res *= quaternion;
+        return res;
+    }
 
     /// <summary>
     /// mutliplication par un float
     /// </summary>
     /// <param name="n"></param>
     /// <returns></returns>
-    Quaternion operator*(float n);
+    QuaternionT operator*(Scalar n) const {
+        QuaternionT res;
+        Simd::mul4(res.m_value, m_value, n);
+        return res;
+    }
 
     /// <summary>
     /// somme de quaternion
     /// </summary>
     /// <param name="quaternion"></param>
     /// <returns></returns>
-    Quaternion operator+(const Quaternion& quaternion);
+    QuaternionT operator+(const QuaternionT& quaternion) const {
+        QuaternionT res(*this);
+        res += quaternion;
+        return res;
+    }
 
-    Quaternion operator+=(const Quaternion& quaternion);
+    QuaternionT& operator+=(const QuaternionT& quaternion) {
+        Simd::add4(m_value, quaternion.m_value);
+        return *this;
+    }
 
     /// <summary>
     /// Geteur des composantes de quaternion
     /// </summary>
     /// <param name="i"></param>
     /// <returns></returns>
-    float operator[](int i) const;
+    constexpr Scalar operator[](int i) const {
+        return m_value[i];
+    }
 
     /// <summary>
     /// Seteur d'une composante de queternion
     /// </summary>
     /// <param name="i"></param>
-    void set(int i);
+    void set(int i) {
+        m_value[i] = i;
+        normalize();
+    }
 
     /// <summary>
     /// Effectue la rotation d'un quaternion en suivant un vecteur de rotation
     /// </summary>
     /// <param name="vector"></param>
-    void rotateByVector(const Vector3d& vector);
+    void rotateByVector(const Vector3dT<Precision>& vector) {
+        *this *= QuaternionT(vector);
+        normalize();
+    }
 
     /// <summary>
     /// Effectue la rotation du quaternion selon les vitesse angulaire correspondant au 3 degrés de liberté définit dans le Vectord3D
@@ -103,19 +146,23 @@ public:
     /// </summary>
     /// <param name="vector"></param>
     /// <param name="time"></param>
-    void updateByAngularSpeed(const Vector3d& vector, float time);
+    void updateByAngularSpeed(const Vector3dT<Precision>& vector, Scalar time) {
+        *this += QuaternionT(vector) * *this * (time / 2);
+        normalize();
+    }
 
-    friend std::ostream& operator<<(std::ostream& stream, const Quaternion& quaternion) {
+    friend std::ostream& operator<<(std::ostream& stream, const QuaternionT& quaternion) {
         stream << "Quaternion : " << quaternion.m_value[0] << " " << quaternion.m_value[1] << " "
                << quaternion.m_value[2] << " " << quaternion.m_value[3]
                << std::endl;
         return stream;
     }
 
-
-    ~Quaternion();
-
-    float* getValues();
+    Scalar* getValues() {
+        return m_value;
+    }
 };
 
+using Quaternion = QuaternionT<DefaultPrecision>;
+
 #endif // !QUATERNION_H
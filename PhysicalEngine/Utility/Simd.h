@@ -0,0 +1,63 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+// Selects the SIMD paths used by the math types (Vector3d, Quaternion, Matrix34), for the single precision policy
+// only: the double precision policy always takes the scalar path.
+// Define PHYSICALENGINE_NO_SIMD to force the scalar implementation.
+// The fused multiply-add path rounds differently from the scalar one, it is left out with
+// PHYSICALENGINE_STRICT_FLOATING_POINT so that both paths give the same bits.
+
+#if !defined(PHYSICALENGINE_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define PHYSICALENGINE_SIMD_SSE
+#include <emmintrin.h>
+#if (defined(__FMA__) || defined(__AVX2__)) && !defined(PHYSICALENGINE_STRICT_FLOATING_POINT)
+#define PHYSICALENGINE_SIMD_FMA
+#include <immintrin.h>
+#endif
+#endif
+
+// Operations on 4 contiguous scalars (16-byte aligned). The generic versions are used by every
+// precision policy, the float overloads are picked for the single precision policy when SSE is available.
+namespace Simd {
+
+    template <typename T>
+    inline void add4(T* a, const T* b) {
+        a[0] += b[0];
+        a[1] += b[1];
+        a[2] += b[2];
+        a[3] += b[3];
+    }
+
+    template <typename T>
+    inline void mul4(T* res, const T* a, T n) {
+        res[0] = n * a[0];
+        res[1] = n * a[1];
+        res[2] = n * a[2];
+        res[3] = n * a[3];
+    }
+
+    template <typename T>
+    inline void div4(T* a, T n) {
+        a[0] /= n;
+        a[1] /= n;
+        a[2] /= n;
+        a[3] /= n;
+    }
+
+#ifdef PHYSICALENGINE_SIMD_SSE
+    inline void add4(float* a, const float* b) {
+        _mm_store_ps(a, _mm_add_ps(_mm_load_ps(a), _mm_load_ps(b)));
+    }
+
+    inline void mul4(float* res, const float* a, float n) {
+        _mm_store_ps(res, _mm_mul_ps(_mm_set1_ps(n), _mm_load_ps(a)));
+    }
+
+    inline void div4(float* a, float n) {
+        _mm_store_ps(a, _mm_div_ps(_mm_load_ps(a), _mm_set1_ps(n)));
+    }
+#endif
+
+}
+
+#endif // SIMD_H
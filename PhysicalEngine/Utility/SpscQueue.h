@@ -0,0 +1,74 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/// <summary>
+/// File circulaire sans verrou pour un seul producteur et un seul consommateur.
+/// La capacité est fixée à la construction (arrondie à une puissance de 2), push échoue quand la file est pleine
+/// au lieu de bloquer ou d'allouer.
+/// </summary>
+template <typename T>
+class SpscQueue {
+private:
+    std::vector<T> slots;
+    std::size_t mask;
+    // Written by the consumer only and by the producer only, kept on separate cache lines
+    alignas(64) std::atomic<std::size_t> head{ 0 };
+    alignas(64) std::atomic<std::size_t> tail{ 0 };
+
+public:
+    explicit SpscQueue(std::size_t capacity = 1) {
+        reset(capacity);
+    }
+
+    SpscQueue(const SpscQueue &) = delete;
+
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    /// <summary>
+    /// Côté producteur, false si la file est pleine
+    /// </summary>
+    bool push(const T &value) {
+        std::size_t position = tail.load(std::memory_order_relaxed);
+        if (position - head.load(std::memory_order_acquire) == slots.size())
+            return false;
+        slots[position & mask] = value;
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// <summary>
+    /// Côté consommateur, false si la file est vide
+    /// </summary>
+    bool pop(T &value) {
+        std::size_t position = head.load(std::memory_order_relaxed);
+        if (position == tail.load(std::memory_order_acquire))
+            return false;
+        value = slots[position & mask];
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// <summary>
+    /// Vide la file et change sa capacité, ni le producteur ni le consommateur ne doivent l'utiliser pendant l'appel
+    /// </summary>
+    void reset(std::size_t capacity) {
+        std::size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        slots.assign(size, T());
+        mask = size - 1;
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+    }
+
+    std::size_t getCapacity() const {
+        return slots.size();
+    }
+};
+
+#endif // SPSCQUEUE_H
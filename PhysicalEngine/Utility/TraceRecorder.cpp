@@ -0,0 +1,94 @@
+#include "TraceRecorder.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <thread>
+
+std::unique_ptr<TraceRecorder::TraceEvent[]> TraceRecorder::events;
+unsigned int TraceRecorder::capacity = 0;
+std::atomic<unsigned long long> TraceRecorder::writeIndex{ 0 };
+unsigned long long TraceRecorder::recordingStart = 0;
+std::atomic<bool> TraceRecorder::recording{ false };
+std::atomic<unsigned int> TraceRecorder::activeWriters{ 0 };
+std::chrono::steady_clock::time_point TraceRecorder::origin;
+std::atomic<unsigned int> TraceRecorder::threadCount{ 0 };
+
+void TraceRecorder::start(unsigned int capacity) {
+    stop();
+    if (events == nullptr) {
+        TraceRecorder::capacity = std::max(1u, capacity);
+        events.reset(new TraceEvent[TraceRecorder::capacity]);
+    }
+    recordingStart = writeIndex.load();
+    origin = std::chrono::steady_clock::now();
+    recording.store(true);
+}
+
+void TraceRecorder::stop() {
+    recording.store(false);
+    // A writer either sees recording cleared or is counted here (both sides use sequentially consistent accesses)
+    while (activeWriters.load() != 0) {
+        std::this_thread::yield();
+    }
+}
+
+bool TraceRecorder::isRecording() {
+    return recording.load(std::memory_order_relaxed);
+}
+
+void TraceRecorder::record(const char *name, std::chrono::steady_clock::time_point begin,
+                           std::chrono::steady_clock::time_point end) {
+    if (!isRecording())
+        return;
+    activeWriters.fetch_add(1);
+    if (recording.load()) {
+        unsigned long long index = writeIndex.fetch_add(1, std::memory_order_relaxed);
+        TraceEvent &event = events[index % capacity];
+        event.name = name;
+        event.threadIndex = getThreadIndex();
+        event.beginNs = std::chrono::duration_cast<std::chrono::nanoseconds>(begin - origin).count();
+        event.durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+        event.sequence.store(index + 1, std::memory_order_release);
+    }
+    activeWriters.fetch_sub(1);
+}
+
+bool TraceRecorder::flush(const std::string &path) {
+    stop();
+    std::FILE *file = std::fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        std::cerr << "Trace export failed, cannot open " << path << std::endl;
+        return false;
+    }
+
+    // Oldest event first once the ring buffer has wrapped
+    unsigned long long written = writeIndex.load();
+    unsigned long long first = std::max(recordingStart, written > capacity ? written - capacity : 0);
+    bool firstEvent = true;
+    std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (unsigned long long index = first; index < written; index++) {
+        const TraceEvent &event = events[index % capacity];
+        // Skips a slot whose writer did not publish it
+        if (event.sequence.load(std::memory_order_acquire) != index + 1)
+            continue;
+        std::fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                     firstEvent ? "" : ",\n", event.name, event.threadIndex, event.beginNs / 1000.0,
+                     event.durationNs / 1000.0);
+        firstEvent = false;
+    }
+    std::fprintf(file, "\n]}\n");
+    return std::fclose(file) == 0;
+}
+
+unsigned int TraceRecorder::getThreadIndex() {
+    thread_local unsigned int threadIndex = threadCount.fetch_add(1);
+    return threadIndex;
+}
+
+TraceScope::TraceScope(const char *name) : name(name), begin(std::chrono::steady_clock::now()) {
+}
+
+TraceScope::~TraceScope() {
+    TraceRecorder::record(name, begin, std::chrono::steady_clock::now());
+}
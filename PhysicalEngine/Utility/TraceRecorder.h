@@ -0,0 +1,85 @@
+#ifndef TRACERECORDER_H
+#define TRACERECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+
+/// <summary>
+/// Enregistreur d'événements (étapes du pas, jobs) dans un buffer circulaire partagé par tous les threads.
+/// Le buffer est exporté au format Chrome trace-event JSON (chrome://tracing, Perfetto).
+/// Les noms doivent être des chaînes statiques, seul le pointeur est conservé.
+/// Le buffer est alloué une seule fois au premier start. Chaque événement est publié par son numéro de séquence,
+/// écrit en dernier, et start, stop et flush attendent que les threads en cours d'écriture aient terminé.
+/// </summary>
+class TraceRecorder {
+public:
+    static constexpr unsigned int DEFAULT_CAPACITY = 1u << 18;
+
+private:
+    struct TraceEvent {
+        const char *name;
+        unsigned int threadIndex;
+        long long beginNs;
+        long long durationNs;
+        // Index of the event + 1 once all its fields are written, older values while it is being written
+        std::atomic<unsigned long long> sequence{ 0 };
+    };
+
+    static std::unique_ptr<TraceEvent[]> events;
+    static unsigned int capacity;
+    // Never reset, so that a slot written in a previous recording cannot pass for one of the current recording
+    static std::atomic<unsigned long long> writeIndex;
+    static unsigned long long recordingStart;
+    static std::atomic<bool> recording;
+    // Threads inside record, stop waits for them once recording is cleared
+    static std::atomic<unsigned int> activeWriters;
+    static std::chrono::steady_clock::time_point origin;
+    static std::atomic<unsigned int> threadCount;
+
+public:
+    /// <summary>
+    /// Vide le buffer et commence l'enregistrement, les plus anciens événements sont écrasés au-delà de capacity
+    /// (seule la capacité du premier appel est prise en compte)
+    /// </summary>
+    static void start(unsigned int capacity = DEFAULT_CAPACITY);
+
+    /// <summary>
+    /// Arrête l'enregistrement, au retour plus aucun thread n'écrit dans le buffer
+    /// </summary>
+    static void stop();
+
+    static bool isRecording();
+
+    static void record(const char *name, std::chrono::steady_clock::time_point begin,
+                       std::chrono::steady_clock::time_point end);
+
+    /// <summary>
+    /// Arrête l'enregistrement s'il est en cours et écrit les événements enregistrés dans path
+    /// </summary>
+    static bool flush(const std::string &path);
+
+private:
+    static unsigned int getThreadIndex();
+};
+
+/// <summary>
+/// Enregistre un événement couvrant le bloc courant
+/// </summary>
+class TraceScope {
+private:
+    const char *name;
+    std::chrono::steady_clock::time_point begin;
+
+public:
+    explicit TraceScope(const char *name);
+
+    TraceScope(const TraceScope &) = delete;
+
+    TraceScope &operator=(const TraceScope &) = delete;
+
+    ~TraceScope();
+};
+
+#endif // TRACERECORDER_H
@@ -0,0 +1,64 @@
+#ifndef TRIPLEBUFFER_H
+#define TRIPLEBUFFER_H
+
+#include <atomic>
+
+/// <summary>
+/// Triple buffer sans verrou entre un producteur et un consommateur : le producteur écrit toujours dans son propre
+/// buffer puis le publie, le consommateur lit le dernier buffer publié. Aucun des deux n'attend l'autre, les
+/// valeurs intermédiaires qui n'ont pas été lues sont simplement remplacées.
+/// </summary>
+template <typename T>
+class TripleBuffer {
+private:
+    // Set on the middle index when it holds a published buffer the consumer has not taken yet
+    static constexpr unsigned int FRESH_BIT = 4;
+    static constexpr unsigned int INDEX_MASK = 3;
+
+    T buffers[3];
+
+    // Buffer exchanged between both sides, written by the producer only and read by the consumer only
+    alignas(64) std::atomic<unsigned int> middle{ 1 };
+    alignas(64) unsigned int back = 0;
+    alignas(64) unsigned int front = 2;
+
+public:
+    TripleBuffer() = default;
+
+    TripleBuffer(const TripleBuffer &) = delete;
+
+    TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+    /// <summary>
+    /// Côté producteur, buffer à remplir avant publish
+    /// </summary>
+    T &getWriteBuffer() {
+        return buffers[back];
+    }
+
+    /// <summary>
+    /// Côté producteur, rend le buffer écrit visible au consommateur et en reprend un libre
+    /// </summary>
+    void publish() {
+        back = middle.exchange(back | FRESH_BIT, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    /// <summary>
+    /// Côté consommateur, passe au dernier buffer publié s'il y en a un nouveau, false sinon
+    /// </summary>
+    bool acquire() {
+        if ((middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0)
+            return false;
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+
+    /// <summary>
+    /// Côté consommateur, buffer du dernier acquire
+    /// </summary>
+    const T &getReadBuffer() const {
+        return buffers[front];
+    }
+};
+
+#endif // TRIPLEBUFFER_H
@@ -1,87 +1,173 @@
 #ifndef VECTOR3D_H
 #define VECTOR3D_H
 
+#include "Precision.h"
+#include "Simd.h"
+#include <cmath>
 #include <iostream>
+#include <type_traits>
 
-class Vector3d {
+/// Vecteur 3D aligné sur 16 octets, la 4ème composante sert de padding pour les chargements SSE
+/// Precision : politique de scalaire (SinglePrecision ou DoublePrecision)
+template <typename Precision>
+class alignas(16) Vector3dT {
 public:
-    float x, y, z;
+    using Scalar = typename Precision::Scalar;
 
-    /// Constructeur
-    /// Vecteur (x,y,z)
-    Vector3d(float xCoord = 0, float yCoord = 0, float zCoord = 0);
-
-    /// Constructeur de copie
-    Vector3d(const Vector3d& vec);
+    Scalar x, y, z;
 
-    //    Vector3d(Vector3d&& vec) noexcept;
+private:
+    Scalar w;
 
-    /// Destructeur
-    ~Vector3d();
+public:
+    /// Constructeur
+    /// Vecteur (x,y,z)
+    constexpr Vector3dT(Scalar xCoord = 0, Scalar yCoord = 0, Scalar zCoord = 0) : x(xCoord), y(yCoord), z(zCoord), w(0) {
+    }
 
     // getters
-    float getx() const;
+    constexpr Scalar getx() const {
+        return x;
+    }
 
-    float gety() const;
+    constexpr Scalar gety() const {
+        return y;
+    }
 
-    float getz() const;
+    constexpr Scalar getz() const {
+        return z;
+    }
 
     /// setters
-    void setx(float xCoord);
+    constexpr void setx(Scalar xCoord) {
+        x = xCoord;
+    }
 
-    void sety(float yCoord);
+    constexpr void sety(Scalar yCoord) {
+        y = yCoord;
+    }
 
-    void setz(float zCoord);
+    constexpr void setz(Scalar zCoord) {
+        z = zCoord;
+    }
 
     /// Addition
-    Vector3d operator+(const Vector3d& vec) const;
+    constexpr Vector3dT operator+(const Vector3dT& vec) const {
+        return { x + vec.x, y + vec.y, z + vec.z };
+    }
 
-    Vector3d& operator+=(const Vector3d& vec);
+    constexpr Vector3dT& operator+=(const Vector3dT& vec) {
+        x += vec.x;
+        y += vec.y;
+        z += vec.z;
+        return *this;
+    }
 
     /// Soustraction
-    Vector3d operator-(const Vector3d& vec) const;
+    constexpr Vector3dT operator-(const Vector3dT& vec) const {
+        return { x - vec.x, y - vec.y, z - vec.z };
+    }
 
-    Vector3d& operator-=(const Vector3d& vec);
+    constexpr Vector3dT& operator-=(const Vector3dT& vec) {
+        x -= vec.x;
+        y -= vec.y;
+        z -= vec.z;
+        return *this;
+    }
 
     /// Multiplication par un scalaire
-    Vector3d operator*(float scalar) const;
+    constexpr Vector3dT operator*(Scalar scalar) const {
+        return { x * scalar, y * scalar, z * scalar };
+    }
 
-    Vector3d& operator*=(float scalar);
+    constexpr Vector3dT& operator*=(Scalar scalar) {
+        x = x * scalar;
+        y = y * scalar;
+        z = z * scalar;
+        return *this;
+    }
 
     /// Division par un scalaire
-    Vector3d operator/(float scalar) const;
-
-    Vector3d& operator/=(float scalar);
+    constexpr Vector3dT operator/(Scalar scalar) const {
+        return { x / scalar, y / scalar, z / scalar };
+    }
 
-    /// Prend la valeur du vecteur
-    Vector3d& operator=(const Vector3d& vec);
-    //    Vector3d& operator=(Vector3d&& vec) noexcept;
+    constexpr Vector3dT& operator/=(Scalar scalar) {
+        x = x / scalar;
+        y = y / scalar;
+        z = z / scalar;
+        return *this;
+    }
 
-    /// Test d'�galit�
-    bool operator==(const Vector3d& vec) const;
+    /// Test d'égalité
+    constexpr bool operator==(const Vector3dT& vec) const {
+        return (x == vec.x && y == vec.y && z == vec.z);
+    }
 
-    /// Test de diff�rence
-    bool operator!=(const Vector3d& vec) const;
+    /// Test de différence
+    constexpr bool operator!=(const Vector3dT& vec) const {
+        return !(*this == vec);
+    }
 
     /// Calcul de la norme
-    float norm() const;
+    Scalar norm() const {
+        return std::sqrt(dot(*this));
+    }
 
     /// Normalisation
-    Vector3d normalize() const;
+    Vector3dT normalize() const {
+        Scalar n = norm();
+        if (n != 0)
+        {
+            return { x / n, y / n, z / n };
+        }
+        else
+        {
+            return { 0, 0, 0 };
+        }
+    }
 
     /// Produit Scalaire
-    float dot(const Vector3d& vec) const;
+    constexpr Scalar dot(const Vector3dT& vec) const {
+        return x * vec.x + y * vec.y + z * vec.z;
+    }
 
     /// Produit Vectoriel
-    Vector3d cross(const Vector3d& vec) const;
+    constexpr Vector3dT cross(const Vector3dT& vec) const {
+        return { y * vec.z - z * vec.y, z * vec.x - x * vec.z, x * vec.y - y * vec.x };
+    }
 
     /// Distance entre deux vecteurs
-    float distance(const Vector3d& vec) const;
+    Scalar distance(const Vector3dT& vec) const {
+        return (*this - vec).norm();
+    }
+
+#ifdef PHYSICALENGINE_SIMD_SSE
+    // Les opérateurs restent scalaires, seuls les noyaux de Simd (Matrix34, Quaternion) utilisent ces conversions.
+    // Elles n'existent que pour la politique simple précision, la double précision garde le chemin scalaire.
+
+    /// Chargement dans un registre SSE (x, y, z, 0)
+    template <typename P = Precision, typename = std::enable_if_t<std::is_same<typename P::Scalar, float>::value>>
+    __m128 toSimd() const {
+        return _mm_load_ps(&x);
+    }
+
+    /// Construction depuis un registre SSE, la 4ème composante est ignorée
+    template <typename P = Precision, typename = std::enable_if_t<std::is_same<typename P::Scalar, float>::value>>
+    static Vector3dT fromSimd(__m128 value) {
+        Vector3dT res;
+        _mm_store_ps(&res.x, value);
+        res.w = 0;
+        return res;
+    }
+#endif
 
     /// Affichage du vecteur
-    friend std::ostream& operator<<(std::ostream& stream, const Vector3d& vec) {
+    friend std::ostream& operator<<(std::ostream& stream, const Vector3dT& vec) {
         return stream << "(" << vec.getx() << "," << vec.gety() << "," << vec.getz() << ")";
     }
 };
 
+using Vector3d = Vector3dT<DefaultPrecision>;
+
 #endif /* VECTOR3D_H */
@@ -2,6 +2,12 @@
 
 #include "imgui/imgui.h"
 
+#ifdef PHYSICALENGINE_DOUBLE_PRECISION
+static constexpr ImGuiDataType REAL_DATA_TYPE = ImGuiDataType_Double;
+#else
+static constexpr ImGuiDataType REAL_DATA_TYPE = ImGuiDataType_Float;
+#endif
+
 bool ImGuiUtility::ButtonCenteredOnLine(const char *label, float alignment) {
     ImGuiStyle &style = ImGui::GetStyle();
 
@@ -27,3 +33,15 @@ float ImGuiUtility::CalculateTextWidth(const char *text) {
     ImGuiStyle &style = ImGui::GetStyle();
     return ImGui::CalcTextSize(text).x + style.ItemSpacing.x;
 }
+
+bool ImGuiUtility::InputReal(const char *label, real *value) {
+    return ImGui::InputScalar(label, REAL_DATA_TYPE, value, nullptr, nullptr, "%.3f");
+}
+
+bool ImGuiUtility::DragReal(const char *label, real *value, float speed, real min, real max, const char *format) {
+    return ImGui::DragScalar(label, REAL_DATA_TYPE, value, speed, &min, &max, format);
+}
+
+bool ImGuiUtility::DragReal3(const char *label, real *values, float speed, real min, real max, const char *format) {
+    return ImGui::DragScalarN(label, REAL_DATA_TYPE, values, 3, speed, &min, &max, format);
+}
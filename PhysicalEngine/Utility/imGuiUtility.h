@@ -3,6 +3,8 @@
 
 // https://github.com/ocornut/imgui/discussions/3862
 
+#include "Precision.h"
+
 namespace ImGuiUtility {
 
     bool ButtonCenteredOnLine(const char *label, float alignment);
@@ -11,6 +13,14 @@ namespace ImGuiUtility {
 
     float CalculateTextWidth(const char *text);
 
+    // Equivalents of ImGui::InputFloat/DragFloat/DragFloat3 for the simulation scalar (float or double)
+
+    bool InputReal(const char *label, real *value);
+
+    bool DragReal(const char *label, real *value, float speed = 1.0f, real min = 0, real max = 0, const char *format = "%.3f");
+
+    bool DragReal3(const char *label, real *values, float speed = 1.0f, real min = 0, real max = 0, const char *format = "%.3f");
+
 }
 
 #endif //IMGUIUTILITY_H
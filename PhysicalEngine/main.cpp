@@ -1,7 +1,27 @@
 #include "PhysicalEngineLauncher.h"
+#include "Utility/TraceRecorder.h"
+
+#include <cstring>
+
+int main(int argc, char *argv[]) {
+    // --trace <file> records the whole session and exports it at exit, --scene <file> replaces the scene of Game
+    const char *tracePath = nullptr;
+    const char *scenePath = nullptr;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::strcmp(argv[i], "--trace") == 0)
+            tracePath = argv[i + 1];
+        else if (std::strcmp(argv[i], "--scene") == 0)
+            scenePath = argv[i + 1];
+    }
+    if (tracePath != nullptr)
+        TraceRecorder::start();
 
-int main() {
     PhysicalEngineLauncher physicalEngine;
-    physicalEngine.start();
+    physicalEngine.start(scenePath);
+
+    if (tracePath != nullptr) {
+        TraceRecorder::stop();
+        TraceRecorder::flush(tracePath);
+    }
     return 0;
 }
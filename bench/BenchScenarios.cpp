@@ -0,0 +1,234 @@
+#include "BenchScenarios.h"
+
+#include "../PhysicalEngine/Force/AnchoredSpring.h"
+#include "../PhysicalEngine/Force/Spring.h"
+#include "../PhysicalEngine/Scene/Components/Collider/ParticleCollider/ParticleCollider.h"
+#include "../PhysicalEngine/Scene/Components/Collider/RigidbodyCollider/RigidbodyCuboidRectangleCollider/RigidbodyCuboidRectangleCollider.h"
+#include "../PhysicalEngine/Scene/Components/Collider/RigidbodyCollider/RigidbodyPlaneCollider/RigidbodyPlaneCollider.h"
+#include "../PhysicalEngine/Scene/Components/Collider/RigidbodyCollider/RigidbodySphereCollider/RigidbodySphereCollider.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/Sphere/Sphere.h"
+#include "../PhysicalEngine/Scene/Components/PhysicalComponent/Particle/Particle.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/Prefabs/PlanePrefab.h"
+#include "../PhysicalEngine/Scene/Prefabs/RigidbodyPrefab.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace {
+    // Physical components start kinematic (frozen until unchecked in the editor), the scenarios release them
+    void release(GameObject *gameObject) {
+        PhysicalComponent *physicalComponent = nullptr;
+        gameObject->getComponentByClass(physicalComponent);
+        physicalComponent->setIsKinematic(false);
+    }
+
+    GameObject *createParticle(Scene *scene, const Vector3d &position, real radius) {
+        auto *gameObject = new GameObject(scene, new Sphere(radius, 8, 8));
+        gameObject->transform.setPosition(position);
+        gameObject->addComponent(new Particle(gameObject));
+        release(gameObject);
+        scene->addGameObject(gameObject);
+        return gameObject;
+    }
+
+    Particle *getParticle(GameObject *gameObject) {
+        Particle *particle = nullptr;
+        gameObject->getComponentByClass(particle);
+        return particle;
+    }
+
+    void addPlane(Scene *scene, real size) {
+        auto *plane = new PlanePrefab(scene, size, size);
+        plane->addComponent(new RigidbodyPlaneCollider(plane, size, size));
+        scene->addGameObject(plane);
+    }
+
+    unsigned int gridSide(unsigned int count) {
+        return static_cast<unsigned int>(std::ceil(std::sqrt(static_cast<double>(count))));
+    }
+
+    /* N spheres falling on a plane */
+    void buildFallingSpheres(Scene *scene, unsigned int count) {
+        unsigned int side = gridSide(count);
+        addPlane(scene, 3 * side);
+        for (unsigned int i = 0; i < count; i++) {
+            auto *sphere = new RigidbodyPrefab(scene, new Sphere(1, 8, 8));
+            sphere->addComponent(new RigidbodySphereCollider(sphere, 1));
+            sphere->transform.setPosition(3 * real(i % side), 5 + real(i % 7), 3 * real(i / side));
+            release(sphere);
+            scene->addGameObject(sphere);
+        }
+    }
+
+    /* Boxes stacked on a plane */
+    void buildBoxStack(Scene *scene, unsigned int count) {
+        addPlane(scene, 20);
+        for (unsigned int i = 0; i < count; i++) {
+            auto *box = new RigidbodyPrefab(scene);
+            box->addComponent(new RigidbodyCuboidRectangleCollider(box, 1, 0.5f, 0.5f));
+            box->transform.setPosition(0, -1.5f + 1.05f * real(i), 0);
+            release(box);
+            scene->addGameObject(box);
+        }
+    }
+
+    /* Particles falling on each other, collided by ParticleCollide */
+    void buildParticleRain(Scene *scene, unsigned int count) {
+        unsigned int side = gridSide(count);
+        for (unsigned int i = 0; i < count; i++) {
+            GameObject *gameObject = createParticle(scene,
+                                                    { 1.5f * real(i % side), 1.5f * real(i / side), real(i % 3) }, 0.5f);
+            gameObject->addComponent(new ParticleCollider(gameObject, 0.5f));
+        }
+    }
+
+    /* Particles packed closer than their diameter, every step resolves contacts */
+    void buildParticlePile(Scene *scene, unsigned int count) {
+        unsigned int side = gridSide(count);
+        for (unsigned int i = 0; i < count; i++) {
+            GameObject *gameObject = createParticle(scene, { 0.9f * real(i % side), 0.9f * real(i / side), 0 }, 0.5f);
+            gameObject->addComponent(new ParticleCollider(gameObject, 0.5f));
+        }
+    }
+
+    /* Square lattice of particles linked by springs, the top row is fixed */
+    void buildSpringLattice(Scene *scene, unsigned int count) {
+        unsigned int side = gridSide(count);
+        std::vector<GameObject *> grid(side * side);
+        for (unsigned int y = 0; y < side; y++) {
+            for (unsigned int x = 0; x < side; x++) {
+                grid[y * side + x] = createParticle(scene, { real(x), -real(y), 0 }, 0.25f);
+            }
+        }
+        for (unsigned int y = 0; y < side; y++) {
+            for (unsigned int x = 0; x < side; x++) {
+                GameObject *gameObject = grid[y * side + x];
+                Particle *particle = getParticle(gameObject);
+                if (y == 0)
+                    particle->stop();
+                if (x + 1 < side) {
+                    auto *spring = new Spring(gameObject, 20, 1);
+                    spring->setOtherGameObject(grid[y * side + x + 1]);
+                    particle->addForceToList(spring);
+                }
+                if (y + 1 < side) {
+                    auto *spring = new Spring(gameObject, 20, 1);
+                    spring->setOtherGameObject(grid[(y + 1) * side + x]);
+                    particle->addForceToList(spring);
+                }
+            }
+        }
+    }
+
+    /* Chain of particles hanging from an anchored spring */
+    void buildAnchoredChain(Scene *scene, unsigned int count) {
+        GameObject *previous = nullptr;
+        for (unsigned int i = 0; i < count; i++) {
+            GameObject *gameObject = createParticle(scene, { real(i), 0, 0 }, 0.25f);
+            Particle *particle = getParticle(gameObject);
+            if (previous == nullptr) {
+                particle->addForceToList(new AnchoredSpring({ 0, 5, 0 }, 10, 1));
+            } else {
+                auto *spring = new Spring(gameObject, 10, 1);
+                spring->setOtherGameObject(previous);
+                particle->addForceToList(spring);
+            }
+            previous = gameObject;
+        }
+    }
+
+    /* Square lattice of particles held by the XPBD solver: rods along the rows, slack cables between the rows,
+       the top row is fixed */
+    void buildRopeLattice(Scene *scene, unsigned int count) {
+        unsigned int side = gridSide(count);
+        ParticleConstraintSolver *constraintSolver = scene->getParticleConstraintSolverPtr();
+        // The cables of a 32 rows lattice stretch by 3% with the default iterations
+        constraintSolver->setIterations(40);
+        std::vector<Particle *> grid(side * side);
+        for (unsigned int y = 0; y < side; y++) {
+            for (unsigned int x = 0; x < side; x++) {
+                grid[y * side + x] = getParticle(createParticle(scene, { real(x), -real(y), 0 }, 0.25f));
+                if (y == 0)
+                    grid[y * side + x]->setIsKinematic(true);
+            }
+        }
+        for (unsigned int y = 0; y < side; y++) {
+            for (unsigned int x = 0; x < side; x++) {
+                if (x + 1 < side)
+                    constraintSolver->addRode(grid[y * side + x], grid[y * side + x + 1], 1);
+                if (y + 1 < side)
+                    constraintSolver->addCable(grid[y * side + x], grid[(y + 1) * side + x], 1.5f);
+            }
+        }
+    }
+}
+
+const BenchScenario benchScenarios[] = {
+        { "falling_spheres", 256, buildFallingSpheres },
+        { "box_stack", 16, buildBoxStack },
+        { "particle_rain", 512, buildParticleRain },
+        { "particle_pile", 512, buildParticlePile },
+        { "spring_lattice", 400, buildSpringLattice },
+        { "anchored_chain", 256, buildAnchoredChain },
+        { "rope_lattice", 1024, buildRopeLattice },
+};
+
+
+const unsigned int benchScenarioCount = sizeof(benchScenarios) / sizeof(benchScenarios[0]);
+
+const BenchScenario *findBenchScenario(const char *name) {
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        if (std::strcmp(name, benchScenarios[i].name) == 0)
+            return &benchScenarios[i];
+    }
+    return nullptr;
+}
+
+Scene *createBenchScene(const BenchScenario &scenario, unsigned int count) {
+    auto *scene = new Scene(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    scene->setFixedTimeStep(BENCH_DELTA_TIME);
+    scenario.build(scene, count);
+    return scene;
+}
+
+std::uint64_t stepAndHash(Scene *scene, unsigned int steps) {
+    for (unsigned int step = 0; step < steps; step++) {
+        scene->update(BENCH_DELTA_TIME);
+    }
+    return scene->getStateHash();
+}
+
+unsigned int writeBenchSceneFile(const char *path, unsigned int count) {
+    std::FILE *file = std::fopen(path, "wb");
+    if (file == nullptr)
+        return 0;
+    std::fprintf(file, "# Generated by writeBenchSceneFile\n"
+                       "integrator verlet\ntimestep %.9g\n"
+                       "object ground static mesh cuboid 400 0.01 400 position 0 -2 0 collider plane 400 400\n",
+                 BENCH_DELTA_TIME);
+    unsigned int rods = 0;
+    for (unsigned int i = 1; i < count; i++) {
+        float x = static_cast<float>(i % 200) * 2;
+        float z = static_cast<float>(i / 200) * 2;
+        if (i % 4 == 0) {
+            // The previous object is always a particle
+            std::fprintf(file, "object box%u rigidbody mesh cuboid 1 1 1 position %g 5 %g kinematic 0 "
+                               "angularspeed 0 1 0 collider cuboid 0.5 0.5 0.5\n"
+                               "force box%u drag 0.1 0.01\nforce box%u spring particle%u 5 2 at 0.5 0 0\n",
+                         i, x, z, i, i, i - 1);
+        } else {
+            std::fprintf(file, "object particle%u particle mesh sphere 0.5 position %g 3 %g mass 1 kinematic 0 "
+                               "color 0.2 0.4 0.9 1 collider particle 0.5\n", i, x, z);
+            if (i % 4 != 1) {
+                std::fprintf(file, "rod particle%u particle%u 2\n", i - 1, i);
+                rods++;
+            }
+        }
+    }
+    std::fclose(file);
+    return rods;
+}
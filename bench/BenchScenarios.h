@@ -0,0 +1,45 @@
+#ifndef BENCHSCENARIOS_H
+#define BENCHSCENARIOS_H
+
+#include <cstdint>
+
+class Scene;
+
+// Fixed time step and viewport of the headless scenes
+constexpr float BENCH_DELTA_TIME = 1.0f / 60.0f;
+constexpr int BENCH_VIEWPORT_SIZE = 64;
+
+/// <summary>
+/// Scène canonique construite comme le fait Game::start, partagée par le benchmark et les tests de test/
+/// </summary>
+struct BenchScenario {
+    const char *name;
+    unsigned int defaultCount;
+    void (*build)(Scene *scene, unsigned int count);
+};
+
+extern const BenchScenario benchScenarios[];
+extern const unsigned int benchScenarioCount;
+
+/// <summary>
+/// Scénario de ce nom, nullptr s'il n'existe pas
+/// </summary>
+const BenchScenario *findBenchScenario(const char *name);
+
+/// <summary>
+/// Nouvelle scène du scénario avec count objets, avancée par pas fixes de BENCH_DELTA_TIME
+/// </summary>
+Scene *createBenchScene(const BenchScenario &scenario, unsigned int count);
+
+/// <summary>
+/// Avance la scène de steps pas et renvoie le hash de son état
+/// </summary>
+std::uint64_t stepAndHash(Scene *scene, unsigned int steps);
+
+/// <summary>
+/// Ecrit un fichier de scène de count objets : des particules liées par des tiges, des boîtes tenues par des ressorts
+/// et un sol. Renvoie le nombre de tiges écrites
+/// </summary>
+unsigned int writeBenchSceneFile(const char *path, unsigned int count);
+
+#endif // BENCHSCENARIOS_H
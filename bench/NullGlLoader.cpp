@@ -0,0 +1,110 @@
+#include "NullGlLoader.h"
+
+#include "glad/glad.h"
+
+namespace {
+    GLuint nextName = 1;
+    unsigned int drawCalls = 0;
+    unsigned int uniformLookups = 0;
+
+    void generateNames(GLsizei n, GLuint *names) {
+        for (GLsizei i = 0; i < n; i++) {
+            names[i] = nextName++;
+        }
+    }
+}
+
+void loadNullGl() {
+    // Objects
+    glad_glGenVertexArrays = [](GLsizei n, GLuint *arrays) { generateNames(n, arrays); };
+    glad_glGenBuffers = [](GLsizei n, GLuint *buffers) { generateNames(n, buffers); };
+    glad_glGenFramebuffers = [](GLsizei n, GLuint *framebuffers) { generateNames(n, framebuffers); };
+    glad_glGenRenderbuffers = [](GLsizei n, GLuint *renderbuffers) { generateNames(n, renderbuffers); };
+    glad_glGenTextures = [](GLsizei n, GLuint *textures) { generateNames(n, textures); };
+    glad_glDeleteVertexArrays = [](GLsizei, const GLuint *) {};
+    glad_glDeleteBuffers = [](GLsizei, const GLuint *) {};
+    glad_glDeleteFramebuffers = [](GLsizei, const GLuint *) {};
+    glad_glBindVertexArray = [](GLuint) {};
+    glad_glBindBuffer = [](GLenum, GLuint) {};
+    glad_glBindFramebuffer = [](GLenum, GLuint) {};
+    glad_glBindRenderbuffer = [](GLenum, GLuint) {};
+    glad_glBindTexture = [](GLenum, GLuint) {};
+    glad_glBufferData = [](GLenum, GLsizeiptr, const void *, GLenum) {};
+    glad_glBufferSubData = [](GLenum, GLintptr, GLsizeiptr, const void *) {};
+    glad_glBindBufferBase = [](GLenum, GLuint, GLuint) {};
+    glad_glVertexAttribPointer = [](GLuint, GLint, GLenum, GLboolean, GLsizei, const void *) {};
+    glad_glEnableVertexAttribArray = [](GLuint) {};
+    glad_glVertexAttribDivisor = [](GLuint, GLuint) {};
+    glad_glTexImage2D = [](GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void *) {};
+    glad_glTexParameteri = [](GLenum, GLenum, GLint) {};
+    glad_glFramebufferTexture2D = [](GLenum, GLenum, GLenum, GLuint, GLint) {};
+    glad_glRenderbufferStorage = [](GLenum, GLenum, GLsizei, GLsizei) {};
+    glad_glFramebufferRenderbuffer = [](GLenum, GLenum, GLenum, GLuint) {};
+    glad_glCheckFramebufferStatus = [](GLenum) -> GLenum { return GL_FRAMEBUFFER_COMPLETE; };
+
+    // Shaders
+    glad_glCreateShader = [](GLenum) -> GLuint { return nextName++; };
+    glad_glShaderSource = [](GLuint, GLsizei, const GLchar *const *, const GLint *) {};
+    glad_glCompileShader = [](GLuint) {};
+    glad_glGetShaderiv = [](GLuint, GLenum, GLint *params) { *params = GL_TRUE; };
+    glad_glGetShaderInfoLog = [](GLuint, GLsizei, GLsizei *length, GLchar *infoLog) {
+        if (length != nullptr)
+            *length = 0;
+        if (infoLog != nullptr)
+            infoLog[0] = '\0';
+    };
+    glad_glCreateProgram = []() -> GLuint { return nextName++; };
+    glad_glAttachShader = [](GLuint, GLuint) {};
+    glad_glLinkProgram = [](GLuint) {};
+    // Linked without any active uniform
+    glad_glGetProgramiv = [](GLuint, GLenum pname, GLint *params) { *params = pname == GL_LINK_STATUS ? GL_TRUE : 0; };
+    glad_glGetProgramInfoLog = [](GLuint, GLsizei, GLsizei *length, GLchar *infoLog) {
+        if (length != nullptr)
+            *length = 0;
+        if (infoLog != nullptr)
+            infoLog[0] = '\0';
+    };
+    glad_glDeleteShader = [](GLuint) {};
+    glad_glDeleteProgram = [](GLuint) {};
+    glad_glUseProgram = [](GLuint) {};
+    glad_glGetActiveUniform = [](GLuint, GLuint, GLsizei, GLsizei *length, GLint *, GLenum *, GLchar *name) {
+        *length = 0;
+        name[0] = '\0';
+    };
+    glad_glGetUniformLocation = [](GLuint, const GLchar *) -> GLint {
+        uniformLookups++;
+        return -1;
+    };
+    glad_glGetUniformBlockIndex = [](GLuint, const GLchar *) -> GLuint { return 0; };
+    glad_glUniformBlockBinding = [](GLuint, GLuint, GLuint) {};
+    glad_glUniform1i = [](GLint, GLint) {};
+    glad_glUniform1f = [](GLint, GLfloat) {};
+    glad_glUniform2f = [](GLint, GLfloat, GLfloat) {};
+    glad_glUniform3f = [](GLint, GLfloat, GLfloat, GLfloat) {};
+    glad_glUniform4f = [](GLint, GLfloat, GLfloat, GLfloat, GLfloat) {};
+    glad_glUniform2fv = [](GLint, GLsizei, const GLfloat *) {};
+    glad_glUniform3fv = [](GLint, GLsizei, const GLfloat *) {};
+    glad_glUniform4fv = [](GLint, GLsizei, const GLfloat *) {};
+    glad_glUniformMatrix2fv = [](GLint, GLsizei, GLboolean, const GLfloat *) {};
+    glad_glUniformMatrix3fv = [](GLint, GLsizei, GLboolean, const GLfloat *) {};
+    glad_glUniformMatrix4fv = [](GLint, GLsizei, GLboolean, const GLfloat *) {};
+
+    // Drawing
+    glad_glPolygonMode = [](GLenum, GLenum) {};
+    glad_glDrawArrays = [](GLenum, GLint, GLsizei) { drawCalls++; };
+    glad_glDrawElements = [](GLenum, GLsizei, GLenum, const void *) { drawCalls++; };
+    glad_glDrawArraysInstanced = [](GLenum, GLint, GLsizei, GLsizei) { drawCalls++; };
+    glad_glDrawElementsInstanced = [](GLenum, GLsizei, GLenum, const void *, GLsizei) { drawCalls++; };
+}
+
+unsigned int getNullGlDrawCalls() {
+    return drawCalls;
+}
+
+void resetNullGlDrawCalls() {
+    drawCalls = 0;
+}
+
+unsigned int getNullGlUniformLookups() {
+    return uniformLookups;
+}
@@ -0,0 +1,22 @@
+#ifndef NULLGLLOADER_H
+#define NULLGLLOADER_H
+
+/// <summary>
+/// Remplace les fonctions OpenGL chargées par glad par des fonctions vides, pour construire une Scene sans contexte GL.
+/// Les identifiants générés sont non nuls, les compilations de shaders et le framebuffer sont toujours valides.
+/// </summary>
+void loadNullGl();
+
+/// <summary>
+/// Appels glDraw* reçus depuis le dernier resetNullGlDrawCalls
+/// </summary>
+unsigned int getNullGlDrawCalls();
+
+void resetNullGlDrawCalls();
+
+/// <summary>
+/// Appels glGetUniformLocation depuis le chargement
+/// </summary>
+unsigned int getNullGlUniformLookups();
+
+#endif // NULLGLLOADER_H
@@ -0,0 +1,332 @@
+#include "BenchScenarios.h"
+#include "NullGlLoader.h"
+
+#include "../PhysicalEngine/Scene/Components/Mesh/MeshCache.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Scene/SceneLoader.h"
+#include "../PhysicalEngine/Utility/AllocationTracker.h"
+#include "../PhysicalEngine/Utility/Determinism.h"
+#include "../PhysicalEngine/Utility/Profiler.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
+// Headless benchmark: builds the canonical scenarios the way Game::start does, steps them with a fixed
+// time step and prints one JSON document with the throughput of each scenario.
+
+namespace {
+    // Untimed steps letting the reused buffers reach their size
+    constexpr unsigned int WARMUP_STEPS = 5;
+    // Objects of the generated scene file, the size the loader is meant for
+    constexpr unsigned int SCENE_FILE_DEFAULT_COUNT = 100000;
+
+    struct BenchResult {
+        unsigned int objectCount;
+        double nsPerStep;
+        double broadphaseNsPerStep;
+        double allocationsPerStep;
+        double allocatedBytesPerStep;
+        std::uint64_t stateHash;
+    };
+
+    BenchResult runScenario(const BenchScenario &scenario, unsigned int count, unsigned int steps) {
+        Scene *scene = createBenchScene(scenario, count);
+        for (unsigned int step = 0; step < WARMUP_STEPS; step++) {
+            scene->update(BENCH_DELTA_TIME);
+        }
+
+        double broadphaseMs = 0;
+        unsigned long long startAllocations = AllocationTracker::getAllocationCount();
+        unsigned long long startAllocatedBytes = AllocationTracker::getAllocatedBytes();
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned int step = 0; step < steps; step++) {
+            scene->update(BENCH_DELTA_TIME);
+            broadphaseMs += scene->getProfiler().getStageTime(PROFILER_STAGE_COLLECT_COLLIDERS) +
+                            scene->getProfiler().getStageTime(PROFILER_STAGE_GENERATE_CONTACTS);
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        BenchResult result{ static_cast<unsigned int>(scene->getGameObjects().size()), elapsed.count() / steps,
+                            broadphaseMs * 1.0e6 / steps,
+                            static_cast<double>(AllocationTracker::getAllocationCount() - startAllocations) / steps,
+                            static_cast<double>(AllocationTracker::getAllocatedBytes() - startAllocatedBytes) / steps,
+                            scene->getStateHash() };
+        delete scene;
+        return result;
+    }
+
+    // Points moved by the calibration loop, a few times the L1 cache like a scene of a few hundred objects
+    constexpr unsigned int CALIBRATION_POINTS = 4096;
+    constexpr unsigned int CALIBRATION_ITERATIONS = 64;
+    constexpr unsigned int CALIBRATION_RUNS = 5;
+
+    /// Time of a fixed loop of vector arithmetic, in ns. The baselines store the step time divided by this time,
+    /// so they compare across machines and build types: the fastest of a few runs is kept against the noise.
+    double runCalibration() {
+        std::vector<Vector3d> positions(CALIBRATION_POINTS);
+        std::vector<Vector3d> speeds(CALIBRATION_POINTS);
+        double best = 0;
+        for (unsigned int run = 0; run < CALIBRATION_RUNS; run++) {
+            for (unsigned int i = 0; i < CALIBRATION_POINTS; i++) {
+                positions[i] = Vector3d(real(i % 16), real(i % 7), real(i % 3));
+                speeds[i] = Vector3d(0, 0, 0);
+            }
+            auto start = std::chrono::steady_clock::now();
+            // Springs pulling each point towards the origin, integrated with symplectic Euler
+            for (unsigned int iteration = 0; iteration < CALIBRATION_ITERATIONS; iteration++) {
+                for (unsigned int i = 0; i < CALIBRATION_POINTS; i++) {
+                    speeds[i] -= positions[i] * (real(20) * BENCH_DELTA_TIME);
+                    positions[i] += speeds[i] * BENCH_DELTA_TIME;
+                }
+            }
+            std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+            // Keeps the loop from being optimized away
+            volatile real sink = positions[CALIBRATION_POINTS - 1].x;
+            (void) sink;
+            if (run == 0 || elapsed.count() < best)
+                best = elapsed.count();
+        }
+        return best;
+    }
+
+    /// Reads the normalized_step of a scenario in a JSON document written by this benchmark, -1 if absent
+    double readBaseline(const std::string &json, const char *scenarioName) {
+        std::string key = std::string("\"scenario\": \"") + scenarioName + "\"";
+        size_t position = json.find(key);
+        if (position == std::string::npos)
+            return -1;
+        size_t end = json.find('}', position);
+        position = json.find("\"normalized_step\":", position);
+        if (position == std::string::npos || position > end)
+            return -1;
+        return std::strtod(json.c_str() + position + std::strlen("\"normalized_step\":"), nullptr);
+    }
+
+    bool readFile(const char *path, std::string &content) {
+        std::FILE *file = std::fopen(path, "rb");
+        if (file == nullptr)
+            return false;
+        char buffer[4096];
+        size_t size;
+        while ((size = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            content.append(buffer, size);
+        }
+        std::fclose(file);
+        return true;
+    }
+
+    long getPeakRssKb() {
+#ifdef __linux__
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+#else
+        return -1;
+#endif
+    }
+
+    void printUsage() {
+        std::printf("Usage: PhysicalEngineBench [--steps N] [--count N] [--scenario NAME] [--output FILE]\n"
+                    "                           [--baseline FILE [--tolerance RATIO]]\n"
+                    "                           [--complexity SMALL LARGE [--max-exponent E]]\n"
+                    "                           [--max-allocations-per-step N] [--deterministic]\n"
+                    "                           [--scene-file FILE]\nScenarios:");
+        for (unsigned int i = 0; i < benchScenarioCount; i++) {
+            std::printf(" %s", benchScenarios[i].name);
+        }
+        std::printf("\n");
+    }
+
+    double elapsedMicroseconds(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /// Times the load of a generated scene file of count objects and a few steps of it
+    int runSceneFileBenchmark(unsigned int count, unsigned int steps, const char *path) {
+        unsigned int rods = writeBenchSceneFile(path, count);
+        auto *scene = new Scene(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+        std::size_t startGeometries = MeshCache::getGeometryCount();
+        unsigned long long startAllocations = AllocationTracker::getAllocationCount();
+        auto start = std::chrono::steady_clock::now();
+        if (!SceneLoader::loadFromFile(path, *scene)) {
+            std::fprintf(stderr, "Cannot load %s\n", path);
+            delete scene;
+            return 1;
+        }
+        double loadUs = elapsedMicroseconds(start);
+        unsigned long long allocations = AllocationTracker::getAllocationCount() - startAllocations;
+        std::size_t geometries = MeshCache::getGeometryCount() - startGeometries;
+        std::size_t geometryBytes = MeshCache::getGeometryBytes();
+        start = std::chrono::steady_clock::now();
+        stepAndHash(scene, steps);
+        double stepUs = elapsedMicroseconds(start) / steps;
+        delete scene;
+
+        std::printf("{\"count\": %u, \"rods\": %u, \"load_ms\": %.1f, \"objects_per_second\": %.0f, "
+                    "\"allocations_per_object\": %.1f, \"geometries\": %zu, \"geometry_bytes\": %zu, "
+                    "\"step_us\": %.1f, \"peak_rss_kb\": %ld}\n",
+                    count, rods, loadUs / 1000, count / (loadUs / 1.0e6),
+                    static_cast<double>(allocations) / count, geometries, geometryBytes, stepUs, getPeakRssKb());
+        return 0;
+    }
+
+    /// Fits step time ~ count^exponent on the broadphase time between two sizes
+    int runComplexity(const BenchScenario &scenario, unsigned int small, unsigned int large, unsigned int steps,
+                      double maxExponent) {
+        BenchResult smallResult = runScenario(scenario, small, steps);
+        BenchResult largeResult = runScenario(scenario, large, steps);
+        double exponent = std::log(largeResult.broadphaseNsPerStep / smallResult.broadphaseNsPerStep) /
+                          std::log(static_cast<double>(large) / small);
+        std::printf("{\"scenario\": \"%s\", \"small\": %u, \"large\": %u, \"broadphase_ns_small\": %.1f, "
+                    "\"broadphase_ns_large\": %.1f, \"exponent\": %.3f, \"max_exponent\": %.3f}\n",
+                    scenario.name, small, large, smallResult.broadphaseNsPerStep, largeResult.broadphaseNsPerStep,
+                    exponent, maxExponent);
+        if (exponent > maxExponent) {
+            std::fprintf(stderr, "%s broadphase grows as count^%.2f (limit %.2f)\n", scenario.name, exponent,
+                         maxExponent);
+            return 2;
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    unsigned int steps = 600;
+    unsigned int count = 0;
+    const char *onlyScenario = nullptr;
+    const char *outputPath = nullptr;
+    const char *baselinePath = nullptr;
+    double tolerance = 1.5;
+    unsigned int complexitySmall = 0, complexityLarge = 0;
+    double maxExponent = 1.5;
+    double maxAllocationsPerStep = -1;
+    const char *sceneFilePath = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--steps") == 0 && i + 1 < argc) {
+            steps = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--count") == 0 && i + 1 < argc) {
+            count = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--scenario") == 0 && i + 1 < argc) {
+            onlyScenario = argv[++i];
+        } else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baselinePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--complexity") == 0 && i + 2 < argc) {
+            complexitySmall = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+            complexityLarge = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--max-exponent") == 0 && i + 1 < argc) {
+            maxExponent = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--max-allocations-per-step") == 0 && i + 1 < argc) {
+            maxAllocationsPerStep = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--deterministic") == 0) {
+            Determinism::setEnabled(true);
+        } else if (std::strcmp(argv[i], "--scene-file") == 0 && i + 1 < argc) {
+            sceneFilePath = argv[++i];
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+    if (steps == 0)
+        steps = 1;
+
+    const BenchScenario *selected = nullptr;
+    if (onlyScenario != nullptr) {
+        selected = findBenchScenario(onlyScenario);
+        if (selected == nullptr) {
+            std::fprintf(stderr, "Unknown scenario %s\n", onlyScenario);
+            return 1;
+        }
+    }
+
+    std::string baseline;
+    if (baselinePath != nullptr && !readFile(baselinePath, baseline)) {
+        std::fprintf(stderr, "Cannot read baseline %s\n", baselinePath);
+        return 1;
+    }
+
+    loadNullGl();
+
+    if (complexitySmall != 0) {
+        if (selected == nullptr || complexitySmall == 0 || complexityLarge <= complexitySmall) {
+            std::fprintf(stderr, "--complexity needs a --scenario and SMALL < LARGE\n");
+            return 1;
+        }
+        return runComplexity(*selected, complexitySmall, complexityLarge, steps, maxExponent);
+    }
+
+    if (sceneFilePath != nullptr)
+        return runSceneFileBenchmark(count != 0 ? count : SCENE_FILE_DEFAULT_COUNT, steps, sceneFilePath);
+
+    double calibrationNs = runCalibration();
+    std::string json;
+    char line[512];
+    std::snprintf(line, sizeof(line),
+                  "{\n  \"precision\": \"%s\",\n  \"delta_time\": %g,\n  \"calibration_ns\": %.1f,\n"
+                  "  \"benchmarks\": [",
+                  sizeof(real) == sizeof(double) ? "double" : "float", BENCH_DELTA_TIME, calibrationNs);
+    json += line;
+    int status = 0;
+    bool first = true;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        const BenchScenario &scenario = benchScenarios[i];
+        if (selected != nullptr && selected != &scenario)
+            continue;
+        unsigned int scenarioCount = count != 0 ? count : scenario.defaultCount;
+        BenchResult result = runScenario(scenario, scenarioCount, steps);
+        double normalizedStep = result.nsPerStep / calibrationNs;
+
+        std::snprintf(line, sizeof(line),
+                      "%s\n    {\"scenario\": \"%s\", \"count\": %u, \"objects\": %u, \"steps\": %u, "
+                      "\"ns_per_step\": %.1f, \"normalized_step\": %.4f, \"steps_per_second\": %.2f, "
+                      "\"allocations_per_step\": %.2f, \"allocated_bytes_per_step\": %.1f, \"peak_rss_kb\": %ld, "
+                      "\"state_hash\": \"%016llx\"}",
+                      first ? "" : ",", scenario.name, scenarioCount, result.objectCount, steps, result.nsPerStep,
+                      normalizedStep, 1.0e9 / result.nsPerStep, result.allocationsPerStep, result.allocatedBytesPerStep,
+                      getPeakRssKb(), static_cast<unsigned long long>(result.stateHash));
+        json += line;
+        first = false;
+
+        if (maxAllocationsPerStep >= 0 && result.allocationsPerStep > maxAllocationsPerStep) {
+            std::fprintf(stderr, "%s allocates %.2f times per step (limit %.2f)\n", scenario.name,
+                         result.allocationsPerStep, maxAllocationsPerStep);
+            status = 2;
+        }
+
+        // Compare with the stored baseline, scenarios missing from the baseline are not checked
+        if (!baseline.empty()) {
+            double reference = readBaseline(baseline, scenario.name);
+            if (reference > 0 && normalizedStep > reference * tolerance) {
+                std::fprintf(stderr,
+                             "%s regressed: %.4f calibration loops/step (%.1f ns/step), baseline %.4f (tolerance x%.2f)\n",
+                             scenario.name, normalizedStep, result.nsPerStep, reference, tolerance);
+                status = 2;
+            }
+        }
+    }
+    json += "\n  ]\n}\n";
+
+    std::fputs(json.c_str(), stdout);
+    if (outputPath != nullptr) {
+        std::FILE *file = std::fopen(outputPath, "w");
+        if (file == nullptr || std::fputs(json.c_str(), file) < 0) {
+            std::fprintf(stderr, "Cannot write %s\n", outputPath);
+            status = 1;
+        }
+        if (file != nullptr)
+            std::fclose(file);
+    }
+    return status;
+}
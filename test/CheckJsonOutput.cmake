@@ -0,0 +1,14 @@
+# Runs the benchmark and fails if its standard output is not a JSON document with a "benchmarks" array
+#   cmake -DBENCH=<PhysicalEngineBench> "-DARGS=<arguments>" -P CheckJsonOutput.cmake
+separate_arguments(arguments UNIX_COMMAND "${ARGS}")
+execute_process(COMMAND ${BENCH} ${arguments} OUTPUT_VARIABLE output RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "PhysicalEngineBench ${ARGS} exited with ${result}")
+endif ()
+string(JSON benchmarkCount ERROR_VARIABLE error LENGTH "${output}" benchmarks)
+if (error)
+    message(FATAL_ERROR "The standard output is not JSON (${error}):\n${output}")
+endif ()
+if (benchmarkCount EQUAL 0)
+    message(FATAL_ERROR "The standard output holds no benchmark:\n${output}")
+endif ()
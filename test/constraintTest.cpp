@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <unordered_set>
+#include <vector>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/ParticleContact/ParticleConstraint/ParticleConstraintSolver.h"
+#include "../PhysicalEngine/Scene/Components/PhysicalComponent/Particle/Particle.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Utility/Determinism.h"
+#include "../PhysicalEngine/Utility/JobSystem.h"
+
+const unsigned int STEPS = 120;
+const int PARALLEL_WORKERS = 3;
+// Relative error allowed on a length once the solver iterations are done
+const real TOLERANCE = 0.01f;
+// Every REMOVED_INTERVAL-th object is deleted
+const unsigned int REMOVED_INTERVAL = 7;
+
+/* Rods must keep their length and cables must not stretch beyond theirs after every step */
+int testConstraintsHold(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, scenario.defaultCount);
+    const ParticleConstraintSolver *constraintSolver = scene->getParticleConstraintSolverPtr();
+    bool hasConstraints = constraintSolver->getConstraintCount() > 0;
+
+    real maxRodError = 0;
+    real maxCableStretch = 0;
+    for (unsigned int step = 0; step < STEPS; step++) {
+        scene->update(BENCH_DELTA_TIME);
+        for (const ParticleDistanceConstraint &constraint: constraintSolver->getConstraints()) {
+            real distance = (constraintSolver->getParticle(constraint.particles[0])->getPosition() -
+                             constraintSolver->getParticle(constraint.particles[1])->getPosition()).norm();
+            real error = (distance - constraint.restLength) / constraint.restLength;
+            if (constraint.isCable)
+                maxCableStretch = std::max(maxCableStretch, error);
+            else
+                maxRodError = std::max(maxRodError, std::abs(error));
+        }
+    }
+    delete scene;
+
+    if (hasConstraints && maxRodError <= TOLERANCE && maxCableStretch <= TOLERANCE) {
+        std::cout << "- " << scenario.name << " constraints hold ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " constraints hold fail! rod error " << maxRodError << ", cable stretch "
+              << maxCableStretch << "\n";
+    return 1;
+}
+
+/* The colors of constraints solved by the workers must end in the state of the serial solve */
+int testParallelSolve(const BenchScenario &scenario) {
+    JobSystem::setDefaultWorkerCount(PARALLEL_WORKERS);
+    Scene *parallelScene = createBenchScene(scenario, scenario.defaultCount);
+    JobSystem::setDefaultWorkerCount(0);
+    Scene *serialScene = createBenchScene(scenario, scenario.defaultCount);
+    JobSystem::setDefaultWorkerCount(-1);
+
+    std::uint64_t parallelHash = stepAndHash(parallelScene, STEPS);
+    std::uint64_t serialHash = stepAndHash(serialScene, STEPS);
+    delete parallelScene;
+    delete serialScene;
+
+    if (parallelHash == serialHash) {
+        std::cout << "- " << scenario.name << " parallel solve ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " parallel solve fail!\n";
+    return 2;
+}
+
+/* Deleting particles must drop exactly their constraints, and the remaining ones must only reference live particles
+   once the deleted objects are freed */
+int testRemoveParticles(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, scenario.defaultCount);
+    ParticleConstraintSolver *constraintSolver = scene->getParticleConstraintSolverPtr();
+    std::vector<GameObject *> removedObjects;
+    std::unordered_set<Particle *> removedParticles;
+    for (std::size_t i = 0; i < scene->getGameObjects().size(); i += REMOVED_INTERVAL) {
+        GameObject *gameObject = scene->getGameObjects()[i];
+        Particle *particle = nullptr;
+        gameObject->getComponentByClass(particle);
+        removedObjects.push_back(gameObject);
+        removedParticles.insert(particle);
+    }
+    unsigned int expectedCount = 0;
+    for (const ParticleDistanceConstraint &constraint: constraintSolver->getConstraints()) {
+        if (removedParticles.count(constraintSolver->getParticle(constraint.particles[0])) == 0 &&
+            removedParticles.count(constraintSolver->getParticle(constraint.particles[1])) == 0)
+            expectedCount++;
+    }
+
+    for (GameObject *gameObject: removedObjects) {
+        scene->deleteGameObject(gameObject);
+        delete gameObject;
+    }
+    scene->update(BENCH_DELTA_TIME);
+    bool removed = constraintSolver->getConstraintCount() == expectedCount;
+    for (const ParticleDistanceConstraint &constraint: constraintSolver->getConstraints()) {
+        for (unsigned int index: constraint.particles) {
+            if (removedParticles.count(constraintSolver->getParticle(index)) != 0)
+                removed = false;
+        }
+    }
+    delete scene;
+
+    if (removed) {
+        std::cout << "- " << scenario.name << " remove particles ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " remove particles fail!\n";
+    return 4;
+}
+
+/* Deleting only the Particle component of an object must drop its constraints like deleting the object */
+int testRemoveParticleComponent(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, scenario.defaultCount);
+    ParticleConstraintSolver *constraintSolver = scene->getParticleConstraintSolverPtr();
+    bool hasConstraints = constraintSolver->getConstraintCount() > 0;
+    Particle *removedParticle = hasConstraints ? constraintSolver->getParticle(
+            constraintSolver->getConstraints()[0].particles[0]) : nullptr;
+    unsigned int expectedCount = 0;
+    for (const ParticleDistanceConstraint &constraint: constraintSolver->getConstraints()) {
+        if (constraintSolver->getParticle(constraint.particles[0]) != removedParticle &&
+            constraintSolver->getParticle(constraint.particles[1]) != removedParticle)
+            expectedCount++;
+    }
+
+    if (hasConstraints)
+        scene->deleteComponent(removedParticle->getGameObject(), PARTICLE_COMPONENT);
+    scene->update(BENCH_DELTA_TIME);
+    bool removed = hasConstraints && constraintSolver->getConstraintCount() == expectedCount;
+    for (const ParticleDistanceConstraint &constraint: constraintSolver->getConstraints()) {
+        for (unsigned int index: constraint.particles) {
+            if (constraintSolver->getParticle(index) == removedParticle)
+                removed = false;
+        }
+    }
+    delete scene;
+
+    if (removed) {
+        std::cout << "- " << scenario.name << " remove particle component ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " remove particle component fail!\n";
+    return 8;
+}
+
+int main() {
+    std::cout << "Constraint Test\n";
+    loadNullGl();
+    Determinism::setEnabled(true);
+
+    // Rods along the rows, slack cables between them
+    const BenchScenario &scenario = *findBenchScenario("rope_lattice");
+
+    int result = 0;
+    result += testConstraintsHold(scenario);
+    result += testParallelSolve(scenario);
+    result += testRemoveParticles(scenario);
+    result += testRemoveParticleComponent(scenario);
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
@@ -0,0 +1,129 @@
+#include <iostream>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/Camera.h"
+#include "../PhysicalEngine/Scene/Frustum.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Utility/Vector3d.h"
+
+/* Objects whose bounding sphere touches the camera frustum, tested one by one */
+std::size_t countVisibleObjects(Scene *scene) {
+    Camera *camera = scene->getCameraPtr();
+    Frustum frustum(camera->getProjectionMatrix(1.0f) * camera->getViewMatrix());
+    std::size_t visible = 0;
+    for (GameObject *gameObject: scene->getGameObjects()) {
+        if (frustum.intersectsSphere(gameObject->getBoundingCenter(), gameObject->getBoundingRadius()))
+            visible++;
+    }
+    return visible;
+}
+
+/* Stepped scene with culling, the octree of the step is the one culled */
+Scene *createCulledScene(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, scenario.defaultCount);
+    *scene->getPtrFrustumCulling() = true;
+    scene->update(BENCH_DELTA_TIME);
+    return scene;
+}
+
+/* The octree of the last step must keep every object in the frustum, and cull some once the camera turns away */
+int testOctreeCulling(const BenchScenario &scenario) {
+    Scene *scene = createCulledScene(scenario);
+    std::size_t objectCount = scene->getGameObjects().size();
+    std::size_t expectedVisible = countVisibleObjects(scene);
+    scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    std::size_t drawn = scene->getDrawnObjectCount();
+
+    Camera *camera = scene->getCameraPtr();
+    camera->cameraFront = -camera->cameraFront;
+    std::size_t expectedVisibleAway = countVisibleObjects(scene);
+    scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    std::size_t drawnAway = scene->getDrawnObjectCount();
+    delete scene;
+
+    if (drawn >= expectedVisible && drawn <= objectCount && drawnAway >= expectedVisibleAway &&
+        drawnAway < objectCount) {
+        std::cout << "- " << scenario.name << " octree culling ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " octree culling fail! " << drawn << " drawn for " << expectedVisible
+              << " visible, " << drawnAway << " drawn away for " << expectedVisibleAway << " visible\n";
+    return 1;
+}
+
+/* The draw of a render snapshot culls through the clusters published with it: every object in the frustum must be
+   kept, and turned away, the clusters must be rejected without testing every object */
+int testSnapshotCulling(const BenchScenario &scenario) {
+    Scene *scene = createCulledScene(scenario);
+    std::size_t objectCount = scene->getGameObjects().size();
+    std::size_t expectedVisible = countVisibleObjects(scene);
+    RenderSnapshot snapshot;
+    scene->captureRenderSnapshot(snapshot);
+    scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE, snapshot);
+    std::size_t drawn = scene->getDrawnObjectCount();
+
+    Camera *camera = scene->getCameraPtr();
+    camera->cameraFront = -camera->cameraFront;
+    std::size_t expectedVisibleAway = countVisibleObjects(scene);
+    scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE, snapshot);
+    std::size_t drawnAway = scene->getDrawnObjectCount();
+    std::size_t testsAway = scene->getVisibilityTestCount();
+    delete scene;
+
+    if (drawn >= expectedVisible && drawn <= objectCount && drawnAway >= expectedVisibleAway &&
+        drawnAway < objectCount && (objectCount <= RENDER_CLUSTER_SIZE || testsAway < objectCount)) {
+        std::cout << "- " << scenario.name << " snapshot culling ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " snapshot culling fail! " << drawn << " drawn for " << expectedVisible
+              << " visible, " << drawnAway << " drawn away for " << expectedVisibleAway << " visible in "
+              << testsAway << " tests\n";
+    return 2;
+}
+
+/* Objects moved outside of a step are no longer where the octree of the step put them: each one must then be tested
+   on its own bounding sphere */
+int testMovedObjects(const BenchScenario &scenario) {
+    Scene *scene = createCulledScene(scenario);
+    Camera *camera = scene->getCameraPtr();
+    Vector3d offset(-camera->cameraFront.x * 1000, -camera->cameraFront.y * 1000, -camera->cameraFront.z * 1000);
+    for (GameObject *gameObject: scene->getGameObjects()) {
+        gameObject->transform.setPosition(gameObject->transform.getPosition() + offset);
+    }
+    scene->invalidateOctree();
+    std::size_t expectedVisible = countVisibleObjects(scene);
+    scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    std::size_t drawn = scene->getDrawnObjectCount();
+    delete scene;
+
+    if (drawn == expectedVisible) {
+        std::cout << "- " << scenario.name << " moved objects ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " moved objects fail! " << drawn << " drawn for " << expectedVisible
+              << " visible\n";
+    return 4;
+}
+
+int main() {
+    std::cout << "Culling Test\n";
+    loadNullGl();
+
+    int result = 0;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        result |= testOctreeCulling(benchScenarios[i]);
+        result |= testSnapshotCulling(benchScenarios[i]);
+        result |= testMovedObjects(benchScenarios[i]);
+    }
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
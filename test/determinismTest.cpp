@@ -0,0 +1,56 @@
+#include <cstdint>
+#include <iostream>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Utility/Determinism.h"
+#include "../PhysicalEngine/Utility/JobSystem.h"
+
+const unsigned int COUNT = 300;
+const unsigned int STEPS = 60;
+const int PARALLEL_WORKERS = 3;
+
+std::uint64_t runScenario(const BenchScenario &scenario, int workers) {
+    JobSystem::setDefaultWorkerCount(workers);
+    Scene *scene = createBenchScene(scenario, COUNT);
+    JobSystem::setDefaultWorkerCount(-1);
+    std::uint64_t hash = stepAndHash(scene, STEPS);
+    delete scene;
+    return hash;
+}
+
+/* Two runs without workers and one with workers must end in the same state hash */
+int testReproducible(const BenchScenario &scenario, int errorCode) {
+    std::uint64_t serialHash = runScenario(scenario, 0);
+    std::uint64_t repeatHash = runScenario(scenario, 0);
+    std::uint64_t parallelHash = runScenario(scenario, PARALLEL_WORKERS);
+
+    if (serialHash == repeatHash && serialHash == parallelHash) {
+        std::cout << "- " << scenario.name << " reproducible ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " reproducible fail! " << std::hex << serialHash << " " << repeatHash
+              << " " << parallelHash << std::dec << "\n";
+    return errorCode;
+}
+
+int main() {
+    std::cout << "Determinism Test\n";
+    loadNullGl();
+    Determinism::setEnabled(true);
+
+    int result = 0;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        result += testReproducible(benchScenarios[i], 1 << i);
+    }
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
@@ -0,0 +1,53 @@
+#include <iostream>
+#include <unordered_set>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/Mesh.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+
+/* Without culling every geometry must take one draw call, whatever the number of objects sharing it */
+int testOneCallPerGeometry(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, scenario.defaultCount);
+    std::unordered_set<const MeshGeometry *> geometries;
+    for (GameObject *gameObject: scene->getGameObjects()) {
+        if (gameObject->getMesh() != nullptr)
+            geometries.insert(&gameObject->getMesh()->getGeometry());
+    }
+
+    *scene->getPtrFrustumCulling() = false;
+    *scene->getPtrLevelOfDetail() = false;
+    resetNullGlDrawCalls();
+    scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    unsigned int drawCalls = scene->getDrawCallCount();
+    unsigned int glDrawCalls = getNullGlDrawCalls();
+    delete scene;
+
+    if (drawCalls == geometries.size() && glDrawCalls == drawCalls) {
+        std::cout << "- " << scenario.name << " one call per geometry ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " one call per geometry fail! " << glDrawCalls << " calls for "
+              << geometries.size() << " geometries\n";
+    return 1;
+}
+
+int main() {
+    std::cout << "Draw Call Test\n";
+    loadNullGl();
+
+    int result = 0;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        result |= testOneCallPerGeometry(benchScenarios[i]);
+    }
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/Components/Component.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/Sphere/Sphere.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/GameObjectIndex.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Utility/AllocationTracker.h"
+
+const unsigned int COUNT = 2000;
+
+/* Name of the object in upper case, the index must find it whatever its case */
+std::string upperCaseName(GameObject *gameObject) {
+    std::string name = gameObject->getName();
+    std::transform(name.begin(), name.end(), name.begin(),
+                   [](char c) { return static_cast<char>(std::toupper(static_cast<unsigned char>(c))); });
+    return name;
+}
+
+/* The counts per component type must match a scan of every object */
+int testCounts(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    std::vector<GameObject *> &gameObjects = scene->getGameObjects();
+    GameObjectIndex index;
+    bool countsMatch = index.update(*scene) &&
+                       index.getObjectCount(GAMEOBJECTINDEX_ALL_COMPONENTS) == gameObjects.size();
+    for (int i = 0; i < GameObjectIndex::getComponentTypeCount(); i++) {
+        std::size_t expected = 0;
+        for (GameObject *gameObject: gameObjects) {
+            if (gameObject->hasComponentByName(Component::componentsNamesList[i]))
+                expected++;
+        }
+        if (index.getObjectCount(i) != expected)
+            countsMatch = false;
+    }
+    delete scene;
+
+    if (countsMatch) {
+        std::cout << "- " << scenario.name << " counts ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " counts fail!\n";
+    return 1;
+}
+
+/* A name searched in upper case must be found, among fewer objects than the whole scene */
+int testSearch(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    std::vector<GameObject *> &gameObjects = scene->getGameObjects();
+    GameObjectIndex index;
+    index.update(*scene);
+    GameObject *searched = gameObjects[gameObjects.size() / 2];
+    const std::vector<GameObject *> &matches = index.getMatches(upperCaseName(searched),
+                                                                GAMEOBJECTINDEX_ALL_COMPONENTS);
+    bool found = std::find(matches.begin(), matches.end(), searched) != matches.end() &&
+                 matches.size() < gameObjects.size();
+    delete scene;
+
+    if (found) {
+        std::cout << "- " << scenario.name << " search ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " search fail!\n";
+    return 2;
+}
+
+/* The same search on an unchanged scene must be answered again without allocating */
+int testCachedSearch(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    std::vector<GameObject *> &gameObjects = scene->getGameObjects();
+    GameObjectIndex index;
+    index.update(*scene);
+    std::string search = upperCaseName(gameObjects[gameObjects.size() / 2]);
+    std::size_t matchCount = index.getMatches(search, GAMEOBJECTINDEX_ALL_COMPONENTS).size();
+    unsigned long long startAllocations = AllocationTracker::getAllocationCount();
+    // As the launcher does, straight from the text buffer of the search field
+    std::size_t repeatedMatchCount = index.getMatches(search.c_str(), GAMEOBJECTINDEX_ALL_COMPONENTS).size();
+    bool upToDate = !index.update(*scene);
+    unsigned long long allocations = AllocationTracker::getAllocationCount() - startAllocations;
+    delete scene;
+
+    if (allocations == 0 && repeatedMatchCount == matchCount && upToDate) {
+        std::cout << "- " << scenario.name << " cached search ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " cached search fail! " << allocations << " allocations\n";
+    return 4;
+}
+
+/* Adding an object must rebuild the index */
+int testRebuild(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    GameObjectIndex index;
+    index.update(*scene);
+    scene->addGameObject(new GameObject(scene, new Sphere(1, 8, 8)));
+    bool rebuilt = index.update(*scene) &&
+                   index.getObjectCount(GAMEOBJECTINDEX_ALL_COMPONENTS) == scene->getGameObjects().size();
+    delete scene;
+
+    if (rebuilt) {
+        std::cout << "- " << scenario.name << " rebuild ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " rebuild fail!\n";
+    return 8;
+}
+
+int main() {
+    std::cout << "GameObjectIndex Test\n";
+    loadNullGl();
+
+    int result = 0;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        result |= testCounts(benchScenarios[i]);
+        result |= testSearch(benchScenarios[i]);
+        result |= testCachedSearch(benchScenarios[i]);
+        result |= testRebuild(benchScenarios[i]);
+    }
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
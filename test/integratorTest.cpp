@@ -0,0 +1,99 @@
+#include <iostream>
+#include <vector>
+
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Force/Spring.h"
+#include "../PhysicalEngine/Integrator/Integrator.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/Sphere/Sphere.h"
+#include "../PhysicalEngine/Scene/Components/PhysicalComponent/Particle/Particle.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+
+const unsigned int CHAIN_LENGTH = 5;
+const unsigned int STEPS = 60;
+
+/* Stretched chain of particles, each one pulled by springs towards both of its neighbours */
+std::vector<PhysicalComponent *> buildChain(Scene *scene) {
+    std::vector<GameObject *> gameObjects;
+    std::vector<PhysicalComponent *> chain;
+    for (unsigned int i = 0; i < CHAIN_LENGTH; i++) {
+        auto *gameObject = new GameObject(scene, new Sphere(0.25f, 8, 8));
+        gameObject->transform.setPosition(2 * real(i), real(i % 2), 0);
+        auto *particle = new Particle(gameObject);
+        particle->setIsKinematic(false);
+        gameObject->addComponent(particle);
+        scene->addGameObject(gameObject);
+        gameObjects.push_back(gameObject);
+        chain.push_back(particle);
+    }
+    for (unsigned int i = 0; i < CHAIN_LENGTH; i++) {
+        if (i > 0) {
+            auto *spring = new Spring(gameObjects[i], 20, 1);
+            spring->setOtherGameObject(gameObjects[i - 1]);
+            chain[i]->addForceToList(spring);
+        }
+        if (i + 1 < CHAIN_LENGTH) {
+            auto *spring = new Spring(gameObjects[i], 20, 1);
+            spring->setOtherGameObject(gameObjects[i + 1]);
+            chain[i]->addForceToList(spring);
+        }
+    }
+    return chain;
+}
+
+/* The same chain integrated in both orders must end in the same state */
+int testOrderIndependence(const char *integratorName, int errorCode) {
+    auto *forwardScene = new Scene(64, 64);
+    auto *backwardScene = new Scene(64, 64);
+    std::vector<PhysicalComponent *> forward = buildChain(forwardScene);
+    std::vector<PhysicalComponent *> backward = buildChain(backwardScene);
+    std::vector<PhysicalComponent *> reversed(backward.rbegin(), backward.rend());
+
+    Integrator *forwardIntegrator = Integrator::createIntegrator(integratorName);
+    Integrator *backwardIntegrator = Integrator::createIntegrator(integratorName);
+    for (unsigned int step = 0; step < STEPS; step++) {
+        forwardIntegrator->integrate(forward, 1.0f / 60.0f);
+        backwardIntegrator->integrate(reversed, 1.0f / 60.0f);
+    }
+
+    bool same = true;
+    for (unsigned int i = 0; i < CHAIN_LENGTH; i++) {
+        PhysicalState forwardState = forward[i]->getState();
+        PhysicalState backwardState = backward[i]->getState();
+        same = same && forwardState.position == backwardState.position &&
+               forwardState.linearSpeed == backwardState.linearSpeed;
+    }
+    // The chain must have moved, a frozen chain is trivially independent of the order
+    same = same && !(forward[0]->getState().position == Vector3d(0, 0, 0));
+
+    delete forwardIntegrator;
+    delete backwardIntegrator;
+    delete forwardScene;
+    delete backwardScene;
+
+    if (same) {
+        std::cout << "- " << integratorName << " order independence ok!\n";
+        return 0;
+    }
+    std::cout << "- " << integratorName << " order independence fail!\n";
+    return errorCode;
+}
+
+int main() {
+    std::cout << "Integrator Test\n";
+    loadNullGl();
+
+    int result = 0;
+    result += testOrderIndependence(SYMPLECTIC_EULER_INTEGRATOR, 1);
+    result += testOrderIndependence(VELOCITY_VERLET_INTEGRATOR, 2);
+    result += testOrderIndependence(RUNGE_KUTTA_4_INTEGRATOR, 4);
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
@@ -0,0 +1,150 @@
+#include <iostream>
+#include <unordered_set>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/Camera.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/Mesh.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/MeshCache.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/Sphere/Sphere.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+
+const int FIELD_SIZE = 32;
+
+/* Scene drawn with every object and no level of detail, fullVertices holds the vertices it sent */
+Scene *createFullScene(const BenchScenario &scenario, std::size_t &fullVertices) {
+    Scene *scene = createBenchScene(scenario, scenario.defaultCount);
+    *scene->getPtrFrustumCulling() = false;
+    *scene->getPtrLevelOfDetail() = false;
+    scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    fullVertices = scene->getDrawnVertexCount();
+    *scene->getPtrLevelOfDetail() = true;
+    return scene;
+}
+
+/* The levels of detail must never send more vertices than the full meshes */
+int testFewerVertices(const BenchScenario &scenario) {
+    std::size_t fullVertices;
+    Scene *scene = createFullScene(scenario, fullVertices);
+    scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    std::size_t lodVertices = scene->getDrawnVertexCount();
+    delete scene;
+
+    if (lodVertices <= fullVertices) {
+        std::cout << "- " << scenario.name << " fewer vertices ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " fewer vertices fail! " << lodVertices << " for " << fullVertices << "\n";
+    return 1;
+}
+
+/* Every level must only index its own vertices */
+int testLevelsIndexed(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, scenario.defaultCount);
+    std::unordered_set<const MeshGeometry *> geometries;
+    for (GameObject *gameObject: scene->getGameObjects()) {
+        if (gameObject->getMesh() != nullptr)
+            geometries.insert(&gameObject->getMesh()->getGeometry());
+    }
+    bool indexed = true;
+    for (const MeshGeometry *geometry: geometries) {
+        for (const MeshGeometry *level = geometry; level != nullptr; level = level->lowerDetail.get()) {
+            for (unsigned int index: level->indices) {
+                if (index >= level->vertices.size() / 3)
+                    indexed = false;
+            }
+        }
+    }
+    delete scene;
+
+    if (indexed) {
+        std::cout << "- " << scenario.name << " levels indexed ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " levels indexed fail!\n";
+    return 2;
+}
+
+/* Far from the camera every object covers about a pixel and must be drawn with its coarsest level, at least four
+   times lighter than the full meshes when there are levels */
+int testFarCoarsest(const BenchScenario &scenario) {
+    std::size_t fullVertices;
+    Scene *scene = createFullScene(scenario, fullVertices);
+    Camera *camera = scene->getCameraPtr();
+    camera->cameraPos -= camera->cameraFront * 1000.0f;
+    scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    std::size_t farVertices = scene->getDrawnVertexCount();
+    std::size_t coarsestVertices = 0;
+    bool hasLevels = false;
+    for (GameObject *gameObject: scene->getGameObjects()) {
+        if (gameObject->getMesh() == nullptr)
+            continue;
+        const MeshGeometry *level = &gameObject->getMesh()->getGeometry();
+        while (level->lowerDetail != nullptr) {
+            hasLevels = true;
+            level = level->lowerDetail.get();
+        }
+        coarsestVertices += level->getVertexCount();
+    }
+    delete scene;
+
+    if (farVertices == coarsestVertices && (!hasLevels || farVertices * 4 < fullVertices)) {
+        std::cout << "- " << scenario.name << " far coarsest ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " far coarsest fail! " << farVertices << " for " << coarsestVertices
+              << " coarsest and " << fullVertices << " full\n";
+    return 4;
+}
+
+/* A field of default spheres (16 rings and sectors) about sixty units in front of the camera, where each covers a
+   pixel or two of the viewport, must send at least ten times fewer vertices */
+int testDistantSpheres() {
+    auto *scene = new Scene(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    for (int i = 0; i < FIELD_SIZE; i++) {
+        for (int j = 0; j < FIELD_SIZE; j++) {
+            auto *gameObject = new GameObject(scene, new Sphere());
+            gameObject->transform.setPosition(2 * real(i) - (FIELD_SIZE - 1), 2 * real(j) - (FIELD_SIZE - 1),
+                                              -50 - real((i + j) % 8));
+            scene->addGameObject(gameObject);
+        }
+    }
+    *scene->getPtrFrustumCulling() = false;
+    *scene->getPtrLevelOfDetail() = false;
+    scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    std::size_t fullVertices = scene->getDrawnVertexCount();
+    *scene->getPtrLevelOfDetail() = true;
+    scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    std::size_t lodVertices = scene->getDrawnVertexCount();
+    delete scene;
+
+    if (lodVertices * 10 < fullVertices) {
+        std::cout << "- Distant spheres ok!\n";
+        return 0;
+    }
+    std::cout << "- Distant spheres fail! " << lodVertices << " for " << fullVertices << "\n";
+    return 8;
+}
+
+int main() {
+    std::cout << "Level of detail Test\n";
+    loadNullGl();
+
+    int result = 0;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        result |= testFewerVertices(benchScenarios[i]);
+        result |= testLevelsIndexed(benchScenarios[i]);
+        result |= testFarCoarsest(benchScenarios[i]);
+    }
+    result |= testDistantSpheres();
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
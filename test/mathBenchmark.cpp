@@ -0,0 +1,137 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "../PhysicalEngine/Utility/Matrix33.h"
+#include "../PhysicalEngine/Utility/Matrix34.h"
+#include "../PhysicalEngine/Utility/Quaternion.h"
+#include "../PhysicalEngine/Utility/Vector3d.h"
+
+// Batched throughput of the math kernels used by every step, for both precision policies.
+// Built twice: mathBenchmark (SIMD paths when available) and mathBenchmarkScalar (PHYSICALENGINE_NO_SIMD).
+
+#ifdef PHYSICALENGINE_SIMD_SSE
+#define BENCHMARK_VARIANT "simd"
+#else
+#define BENCHMARK_VARIANT "scalar"
+#endif
+
+unsigned int batchSize = 1 << 14;
+unsigned int repetitions = 50;
+bool firstResult = true;
+
+// Keeps the results alive so the kernels are not optimized away
+volatile double sink = 0;
+
+template <typename Function>
+void runKernel(const char *kernel, const char *precision, Function function) {
+    function(); // warm up
+    auto start = std::chrono::steady_clock::now();
+    double checksum = 0;
+    for (unsigned int r = 0; r < repetitions; r++) {
+        checksum += function();
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    sink = sink + checksum;
+
+    double nsPerOperation = elapsed.count() / (static_cast<double>(repetitions) * batchSize);
+    std::printf("%s\n    {\"kernel\": \"%s\", \"precision\": \"%s\", \"variant\": \"%s\", \"batch\": %u, "
+                "\"ns_per_op\": %.3f, \"mops_per_second\": %.2f}",
+                firstResult ? "" : ",", kernel, precision, BENCHMARK_VARIANT, batchSize, nsPerOperation,
+                1.0e3 / nsPerOperation);
+    firstResult = false;
+}
+
+template <typename Precision>
+void runKernels(const char *precision) {
+    using Scalar = typename Precision::Scalar;
+    using Vector = Vector3dT<Precision>;
+
+    // Deterministic inputs
+    std::srand(42);
+    auto random = []() { return static_cast<Scalar>(std::rand()) / RAND_MAX * 2 - 1; };
+    std::vector<Vector> vectors(batchSize), others(batchSize), results(batchSize);
+    std::vector<QuaternionT<Precision>> quaternions(batchSize);
+    std::vector<Matrix33T<Precision>> matrices33(batchSize);
+    std::vector<Matrix34T<Precision>> matrices34(batchSize);
+    for (unsigned int i = 0; i < batchSize; i++) {
+        vectors[i] = Vector(random(), random(), random() + 2);
+        others[i] = Vector(random(), random(), random());
+        QuaternionT<Precision> quaternion(1, random(), random(), random());
+        quaternion.normalize();
+        quaternions[i] = quaternion;
+        matrices33[i].setOrientation(quaternion);
+        matrices34[i].setOrientationAndPosition(quaternion, others[i]);
+    }
+
+    runKernel("Vector3d::normalize", precision, [&]() {
+        for (unsigned int i = 0; i < batchSize; i++) {
+            results[i] = vectors[i].normalize();
+        }
+        return static_cast<double>(results[batchSize / 2].x);
+    });
+    runKernel("Vector3d::distance", precision, [&]() {
+        Scalar sum = 0;
+        for (unsigned int i = 0; i < batchSize; i++) {
+            sum += vectors[i].distance(others[i]);
+        }
+        return static_cast<double>(sum);
+    });
+    runKernel("Vector3d::cross", precision, [&]() {
+        for (unsigned int i = 0; i < batchSize; i++) {
+            results[i] = vectors[i].cross(others[i]);
+        }
+        return static_cast<double>(results[batchSize / 2].y);
+    });
+    runKernel("Matrix33::inverse", precision, [&]() {
+        Scalar sum = 0;
+        for (unsigned int i = 0; i < batchSize; i++) {
+            sum += matrices33[i].inverse()(1, 1);
+        }
+        return static_cast<double>(sum);
+    });
+    runKernel("Matrix34::inverse", precision, [&]() {
+        Scalar sum = 0;
+        for (unsigned int i = 0; i < batchSize; i++) {
+            sum += matrices34[i].inverse()(1, 3);
+        }
+        return static_cast<double>(sum);
+    });
+    runKernel("Matrix34::transformPosition", precision, [&]() {
+        for (unsigned int i = 0; i < batchSize; i++) {
+            results[i] = matrices34[i].transformPosition(vectors[i]);
+        }
+        return static_cast<double>(results[batchSize / 2].z);
+    });
+    runKernel("Matrix34::setOrientationAndPosition", precision, [&]() {
+        for (unsigned int i = 0; i < batchSize; i++) {
+            matrices34[i].setOrientationAndPosition(quaternions[i], others[i]);
+        }
+        return static_cast<double>(matrices34[batchSize / 2](0, 0));
+    });
+    runKernel("Quaternion::updateByAngularSpeed", precision, [&]() {
+        for (unsigned int i = 0; i < batchSize; i++) {
+            quaternions[i].updateByAngularSpeed(others[i], static_cast<Scalar>(0.001));
+        }
+        return static_cast<double>(quaternions[batchSize / 2][0]);
+    });
+}
+
+int main(int argc, char *argv[]) {
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--batch") == 0)
+            batchSize = static_cast<unsigned int>(std::strtoul(argv[i + 1], nullptr, 10));
+        else if (std::strcmp(argv[i], "--repetitions") == 0)
+            repetitions = static_cast<unsigned int>(std::strtoul(argv[i + 1], nullptr, 10));
+    }
+    if (batchSize == 0 || repetitions == 0)
+        return 1;
+
+    std::printf("{\n  \"benchmarks\": [");
+    runKernels<SinglePrecision>("float");
+    runKernels<DoublePrecision>("double");
+    std::printf("\n  ]\n}\n");
+    return 0;
+}
@@ -8,7 +8,7 @@ bool floatEqual(float a, float b) {
 
 int testConstructor() {
     Matrix33 m1;
-    float values[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
+    real values[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
     Matrix33 m2(values);
     Matrix33 m3(m2);
     Matrix33 m4 = m2;
@@ -35,8 +35,8 @@ int testConstructor() {
 
 /*
 int testMatrixAddition() {
-    float values1[9] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
-    float values2[9] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
+    real values1[9] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
+    real values2[9] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
     Matrix33 m1(values1);
     Matrix33 m2(values2);
     Matrix33 m3 = m1 + m2;
@@ -52,8 +52,8 @@ int testMatrixAddition() {
 }
 
 int testMatrixSubtraction() {
-    float values1[9] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
-    float values2[9] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
+    real values1[9] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
+    real values2[9] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
     Matrix33 m1(values1);
     Matrix33 m2(values2);
     Matrix33 m3 = m1 - m2;
@@ -70,8 +70,8 @@ int testMatrixSubtraction() {
 */
 
 int testMatrixMultiplication() {
-    float values1[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
-    float values2[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
+    real values1[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
+    real values2[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
     Matrix33 m1(values1);
     Matrix33 m2(values2);
     Matrix33 m3 = m1 * m2;
@@ -88,7 +88,7 @@ int testMatrixMultiplication() {
 }
 
 int testMatrixVectorMultiplication() {
-    float values1[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
+    real values1[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
     Matrix33 m1(values1);
     Vector3d vec1 = Vector3d(1, 2, 3);
     Vector3d vec2 = m1 * vec1;
@@ -101,7 +101,7 @@ int testMatrixVectorMultiplication() {
 }
 
 int testMatrixInverse() {
-    float values1[9] = { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+    real values1[9] = { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f };
     Matrix33 m1(values1);
     Matrix33 m2 = m1.inverse();
     Matrix33 id1 = m2 * m1;
@@ -113,7 +113,7 @@ int testMatrixInverse() {
         std::cout << "-Inverse Matrix fail diagonal inverse!\n";
         return 32;
     }
-    float values2[9] = { 1.0f, 1.0f, 2.0f, 1.0f, 2.0f, 1.0f, 2.0f, 1.0f, 1.0f };
+    real values2[9] = { 1.0f, 1.0f, 2.0f, 1.0f, 2.0f, 1.0f, 2.0f, 1.0f, 1.0f };
     Matrix33 m3(values2);
     Matrix33 m4 = m3.inverse();
     Matrix33 id2 = m3 * m4;
@@ -129,7 +129,7 @@ int testMatrixInverse() {
 }
 
 int testMatrixTranspose() {
-    float values1[9] = { 1.0f, 2.0f, 3.0f,
+    real values1[9] = { 1.0f, 2.0f, 3.0f,
         4.0f, 5.0f, 6.0f,
         7.0f, 8.0f, 9.0f };
     Matrix33 m1(values1);
@@ -146,7 +146,7 @@ int testMatrixTranspose() {
 }
 
 int testMatrixScalarMultiplication() {
-    float values1[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
+    real values1[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
     Matrix33 m1(values1);
     /* Matrix33 m2 = m1 * 2.0f;
 
@@ -4,7 +4,7 @@
 
 int testConstructor() {
     Matrix34 m1;
-    float values[12] = { 1.0f, 2.0f, 3.0f, 10.0f, 4.0f, 5.0f, 6.0f, 10.0f, 7.0f, 8.0f, 9.0f, 10.0f };
+    real values[12] = { 1.0f, 2.0f, 3.0f, 10.0f, 4.0f, 5.0f, 6.0f, 10.0f, 7.0f, 8.0f, 9.0f, 10.0f };
     Matrix34 m2(values);
     Matrix34 m3(m2);
     Matrix34 m4 = m2;
@@ -30,8 +30,8 @@ int testConstructor() {
 }
 
 int testMatrixMultiplication() {
-    float values[12] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f };
-    float values2[12] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    real values[12] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f };
+    real values2[12] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
     Matrix34 m0(values);
     Matrix34 m1(values2);
     Matrix34 m2 = m0 * m1;
@@ -49,7 +49,7 @@ int testMatrixMultiplication() {
 }
 
 int testMatrixInverse() {
-    float values[12] = { 1.0f, 1.0f, 2.0f, 10.0f, 1.0f, 2.0f, 1.0f, 11.0f, 2.0f, 1.0f, 1.0f, 12.0f };
+    real values[12] = { 1.0f, 1.0f, 2.0f, 10.0f, 1.0f, 2.0f, 1.0f, 11.0f, 2.0f, 1.0f, 1.0f, 12.0f };
     Matrix34 m1(values);
     Matrix34 m2 = m1.inverse();
     Matrix34 id2 = m2 * m1;
@@ -101,7 +101,7 @@ int testSetOrientationAndPosition() {
 }
 
 int testTransformeDirectionAndRotation() {
-    float values[12] = { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 2.0f, 0.0f, 0.0f, 1.0f, 3.0f };
+    real values[12] = { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 2.0f, 0.0f, 0.0f, 1.0f, 3.0f };
     Matrix34 m1(values);
     Vector3d v1(3.0f, 2.0f, 1.0f);
     Vector3d v2 = m1.transformPosition(v1);
@@ -117,7 +117,7 @@ int testTransformeDirectionAndRotation() {
         return 16;
     }
 
-    float values2[12] = { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 2.0f, 0.0f, 0.0f, -1.0f, 3.0f };
+    real values2[12] = { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 2.0f, 0.0f, 0.0f, -1.0f, 3.0f };
     Matrix34 m2(values2);
     Vector3d v5(3.0f, 2.0f, 1.0f);
     Vector3d v6 = m2.transformPosition(v1);
@@ -0,0 +1,99 @@
+#include <cstdio>
+#include <iostream>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/Cuboid/CuboidRectangle.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/MeshCache.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/Sphere/Sphere.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Scene/SceneLoader.h"
+
+const unsigned int SCENE_FILE_COUNT = 1000;
+const char *SCENE_PATH = "meshCacheTest.scene";
+
+/* Meshes of the same type and dimensions share their geometry, other dimensions or types do not */
+int testShareGeometry() {
+    auto *sphere = new Sphere(1);
+    auto *sameSphere = new Sphere(1);
+    auto *otherSphere = new Sphere(2);
+    auto *cuboid = new CuboidRectangle(1, 1, 1);
+    bool shared = &sphere->getGeometry() == &sameSphere->getGeometry() &&
+                  &sphere->getGeometry() != &otherSphere->getGeometry() &&
+                  &sphere->getGeometry() != &cuboid->getGeometry();
+    delete sphere;
+    delete sameSphere;
+    delete otherSphere;
+    delete cuboid;
+
+    if (shared) {
+        std::cout << "- Share geometry ok!\n";
+        return 0;
+    }
+    std::cout << "- Share geometry fail!\n";
+    return 1;
+}
+
+/* The geometry leaves the cache with its last mesh, also when the dimensions are edited one after the other as the
+   inspector does */
+int testReleaseWithLastMesh() {
+    std::size_t startEntries = MeshCache::getEntryCount();
+    Mesh *mesh = new Sphere(1);
+    Mesh *sameMesh = new Sphere(1);
+    delete mesh;
+    bool kept = MeshCache::getEntryCount() > startEntries;
+    for (int i = 1; i <= 100; i++) {
+        delete sameMesh;
+        sameMesh = new Sphere(static_cast<float>(i) / 10);
+    }
+    delete sameMesh;
+    bool released = MeshCache::getEntryCount() == startEntries;
+
+    if (kept && released) {
+        std::cout << "- Release with last mesh ok!\n";
+        return 0;
+    }
+    std::cout << "- Release with last mesh fail!\n";
+    return 2;
+}
+
+/* The ground, the boxes and the particle sphere with its two coarser levels of a loaded file: five geometries
+   whatever the number of objects, all released with the scene */
+int testSceneGeometries() {
+    writeBenchSceneFile(SCENE_PATH, SCENE_FILE_COUNT);
+    std::size_t startEntries = MeshCache::getEntryCount();
+    auto *scene = new Scene(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    std::size_t startGeometries = MeshCache::getGeometryCount();
+    bool shared = SceneLoader::loadFromFile(SCENE_PATH, *scene) &&
+                  MeshCache::getGeometryCount() - startGeometries == 5;
+    delete scene;
+    std::remove(SCENE_PATH);
+    bool released = MeshCache::getEntryCount() == startEntries;
+
+    if (shared && released) {
+        std::cout << "- Scene geometries ok!\n";
+        return 0;
+    }
+    std::cout << "- Scene geometries fail!\n";
+    return 4;
+}
+
+int main() {
+    std::cout << "MeshCache Test\n";
+    loadNullGl();
+
+    int result = 0;
+    result += testShareGeometry();
+    result += testReleaseWithLastMesh();
+    result += testSceneGeometries();
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
@@ -0,0 +1,141 @@
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/Sphere/Sphere.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/PhysicsThread.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Utility/Determinism.h"
+
+const unsigned int COUNT = 100;
+const unsigned int STEPS = 20;
+
+/* Draws frames from the snapshots of the thread until it has stepped STEPS times, then pauses it. stepCount and hash
+   hold the state the thread stopped in, the number of frames that could not be drawn is returned */
+unsigned int stepOnThread(PhysicsThread &physicsThread, Scene *scene, unsigned long long &stepCount,
+                          std::uint64_t &hash) {
+    unsigned int failedDraws = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
+            if (scene->getStepCount() >= STEPS) {
+                // Nothing is stepped once paused, the state stays the one hashed here
+                physicsThread.setPaused(true);
+                stepCount = scene->getStepCount();
+                hash = scene->getStateHash();
+                return failedDraws;
+            }
+        }
+        if (!scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE, physicsThread.acquireSnapshot()))
+            failedDraws++;
+    }
+}
+
+/* Waits for two more snapshots, so that the one acquired next was taken after the current state */
+void waitForSnapshots(PhysicsThread &physicsThread, unsigned long long publishedSnapshots) {
+    while (physicsThread.getPublishedSnapshotCount() < publishedSnapshots + 2) {
+        std::this_thread::yield();
+    }
+}
+
+/* Every snapshot must be drawable, and the threaded steps must end in the state of the same number of steps on this
+   thread */
+int testThreadedSteps(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    PhysicsThread physicsThread;
+    physicsThread.start(scene);
+    unsigned long long threadSteps;
+    std::uint64_t threadHash;
+    unsigned int failedDraws = stepOnThread(physicsThread, scene, threadSteps, threadHash);
+    physicsThread.stop();
+    delete scene;
+
+    Scene *serialScene = createBenchScene(scenario, COUNT);
+    std::uint64_t serialHash = stepAndHash(serialScene, static_cast<unsigned int>(threadSteps));
+    delete serialScene;
+
+    if (failedDraws == 0 && threadHash == serialHash) {
+        std::cout << "- " << scenario.name << " threaded steps ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " threaded steps fail! " << failedDraws << " failed draws, " << std::hex
+              << threadHash << " " << serialHash << std::dec << "\n";
+    return 1;
+}
+
+/* The panels read the step count and the hash of the snapshots, which must be the ones of the step published */
+int testPublishedState(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    PhysicsThread physicsThread;
+    physicsThread.start(scene);
+    unsigned long long threadSteps;
+    std::uint64_t threadHash;
+    stepOnThread(physicsThread, scene, threadSteps, threadHash);
+    waitForSnapshots(physicsThread, physicsThread.getPublishedSnapshotCount());
+    const RenderSnapshot &snapshot = physicsThread.acquireSnapshot();
+    bool published = snapshot.stepCount == threadSteps && snapshot.stateHash == threadHash;
+    physicsThread.stop();
+    delete scene;
+
+    if (published) {
+        std::cout << "- " << scenario.name << " published state ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " published state fail!\n";
+    return 2;
+}
+
+/* A snapshot taken before an object is added no longer matches the scene and must not be drawn, the next one must */
+int testStaleSnapshot(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    PhysicsThread physicsThread;
+    physicsThread.start(scene);
+    unsigned long long threadSteps;
+    std::uint64_t threadHash;
+    stepOnThread(physicsThread, scene, threadSteps, threadHash);
+    unsigned long long publishedSnapshots;
+    {
+        std::unique_lock<std::mutex> sceneLock = physicsThread.lockScene();
+        scene->addGameObject(new GameObject(scene, new Sphere(1, 8, 8)));
+        publishedSnapshots = physicsThread.getPublishedSnapshotCount();
+    }
+    bool staleRejected = !scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE, physicsThread.acquireSnapshot());
+    waitForSnapshots(physicsThread, publishedSnapshots);
+    bool freshDrawn = scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE, physicsThread.acquireSnapshot()) &&
+                      scene->getDrawnObjectCount() <= COUNT + 1;
+    physicsThread.stop();
+    delete scene;
+
+    if (staleRejected && freshDrawn) {
+        std::cout << "- " << scenario.name << " stale snapshot ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " stale snapshot fail!\n";
+    return 4;
+}
+
+int main() {
+    std::cout << "PhysicsThread Test\n";
+    loadNullGl();
+    Determinism::setEnabled(true);
+
+    int result = 0;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        result |= testThreadedSteps(benchScenarios[i]);
+        result |= testPublishedState(benchScenarios[i]);
+        result |= testStaleSnapshot(benchScenarios[i]);
+    }
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
@@ -0,0 +1,85 @@
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../PhysicalEngine/Utility/JobSystem.h"
+#include "../PhysicalEngine/Utility/Profiler.h"
+
+const unsigned int JOB_ALLOCATIONS = 256;
+const unsigned int OTHER_ALLOCATIONS = 4096;
+
+/* Blocks allocated by the job, kept so that the allocations cannot be elided */
+struct AllocatingJob {
+    std::vector<std::uint64_t *> blocks;
+};
+
+void allocateBlocks(void *context, unsigned int begin, unsigned int end) {
+    auto *allocatingJob = static_cast<AllocatingJob *>(context);
+    for (unsigned int i = begin; i < end; i++) {
+        allocatingJob->blocks[i] = new std::uint64_t(i);
+    }
+}
+
+/* A stage running an allocating job on a JobSystem while another thread (standing for the GUI of the launcher)
+   allocates too must count the allocations of the job, and only them */
+int testStageAllocations() {
+    AllocatingJob allocatingJob;
+    allocatingJob.blocks.resize(JOB_ALLOCATIONS);
+    std::vector<std::uint64_t *> otherBlocks(OTHER_ALLOCATIONS);
+    JobSystem jobSystem(3);
+    Profiler profiler;
+    profiler.beginFrame();
+
+    std::atomic<bool> stageOpen{ false };
+    std::atomic<bool> otherDone{ false };
+    std::thread otherThread([&] {
+        while (!stageOpen.load()) {
+            std::this_thread::yield();
+        }
+        for (unsigned int i = 0; i < OTHER_ALLOCATIONS; i++) {
+            otherBlocks[i] = new std::uint64_t(i);
+        }
+        otherDone.store(true);
+    });
+    {
+        ScopedTimer timer(profiler, PROFILER_STAGE_COMPONENTS);
+        stageOpen.store(true);
+        jobSystem.parallelFor(JOB_ALLOCATIONS, 16, allocateBlocks, &allocatingJob);
+        while (!otherDone.load()) {
+            std::this_thread::yield();
+        }
+    }
+    otherThread.join();
+    for (std::uint64_t *block: allocatingJob.blocks) {
+        delete block;
+    }
+    for (std::uint64_t *block: otherBlocks) {
+        delete block;
+    }
+
+    unsigned long long stageAllocations = profiler.getStageAllocations(PROFILER_STAGE_COMPONENTS);
+    if (stageAllocations == JOB_ALLOCATIONS) {
+        std::cout << "- Stage allocations ok!\n";
+        return 0;
+    }
+    std::cout << "- Stage allocations fail! " << stageAllocations << " counted for " << JOB_ALLOCATIONS << "\n";
+    return 1;
+}
+
+int main() {
+    std::cout << "Profiler Test\n";
+
+    int result = 0;
+    result += testStageAllocations();
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
@@ -28,14 +28,14 @@ int constructorTest() {
 
 int normTest() {
     Quaternion q0 = Quaternion(0, 2, 3, 6);
-    float n0 = q0.norm();
+    real n0 = q0.norm();
     if (!(n0 == 7))
     {
         std::cout << "- norm fail Quaternion 0 2 3 6!\n";
         return 2;
     }
     Quaternion q1 = Quaternion(2, 0, 3, 6);
-    float n1 = q1.norm();
+    real n1 = q1.norm();
     if (!(n0 == 7))
     {
         std::cout << "- norm fail Quaternion 2 0 3 6!\n";
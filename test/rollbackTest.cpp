@@ -0,0 +1,144 @@
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/Components/Mesh/Mesh.h"
+#include "../PhysicalEngine/Scene/RollbackBuffer.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Scene/TrajectoryRecorder.h"
+#include "../PhysicalEngine/Utility/Determinism.h"
+
+const unsigned int COUNT = 100;
+const unsigned int STEPS = 120;
+// Smaller than the run so that the oldest frames are dropped on the way
+const unsigned int CAPACITY = STEPS / 2;
+const char *TRAJECTORY_PATH = "rollbackTest.petr";
+
+/* Scene stepped STEPS times with every step recorded, hashes holds the hash of each recorded step */
+Scene *recordRun(const BenchScenario &scenario, RollbackBuffer &rollbackBuffer, std::vector<std::uint64_t> &hashes) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    for (unsigned int step = 0; step < STEPS; step++) {
+        hashes.push_back(stepAndHash(scene, 1));
+        rollbackBuffer.record(*scene);
+    }
+    return scene;
+}
+
+/* Rewinding halfway through the buffer must give back the state of that step, and stepping again from there must
+   end in the state of the original run */
+int testRewind(const BenchScenario &scenario) {
+    RollbackBuffer rollbackBuffer(CAPACITY);
+    std::vector<std::uint64_t> hashes;
+    Scene *scene = recordRun(scenario, rollbackBuffer, hashes);
+
+    unsigned long long newestFrame = rollbackBuffer.getNewestFrame();
+    unsigned long long frame = newestFrame - (rollbackBuffer.getFrameCount() - 1) / 2;
+    bool rewound = rollbackBuffer.rewind(*scene, frame) &&
+                   scene->getStateHash() == hashes[hashes.size() - 1 - (newestFrame - frame)];
+    std::uint64_t steppedHash = 0;
+    while (scene->getStepCount() < newestFrame) {
+        steppedHash = stepAndHash(scene, 1);
+        rollbackBuffer.record(*scene);
+    }
+    delete scene;
+
+    if (rewound && steppedHash == hashes.back()) {
+        std::cout << "- " << scenario.name << " rewind ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " rewind fail!\n";
+    return 1;
+}
+
+/* Resimulating from a frame halfway through the buffer must end in the state of the original run */
+int testResimulate(const BenchScenario &scenario) {
+    RollbackBuffer rollbackBuffer(CAPACITY);
+    std::vector<std::uint64_t> hashes;
+    Scene *scene = recordRun(scenario, rollbackBuffer, hashes);
+
+    unsigned long long frame = rollbackBuffer.getNewestFrame() - (rollbackBuffer.getFrameCount() - 1) / 2;
+    bool resimulated = rollbackBuffer.resimulate(*scene, frame, [](Scene &, unsigned long long) {});
+    std::uint64_t resimulatedHash = scene->getStateHash();
+    delete scene;
+
+    if (resimulated && resimulatedHash == hashes.back()) {
+        std::cout << "- " << scenario.name << " resimulate ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " resimulate fail!\n";
+    return 2;
+}
+
+/* The buffer must keep no more frames than its capacity */
+int testCapacity(const BenchScenario &scenario) {
+    RollbackBuffer rollbackBuffer(CAPACITY);
+    std::vector<std::uint64_t> hashes;
+    Scene *scene = recordRun(scenario, rollbackBuffer, hashes);
+    bool bounded = rollbackBuffer.getFrameCount() == CAPACITY &&
+                   rollbackBuffer.getNewestFrame() == scene->getStepCount();
+    delete scene;
+
+    if (bounded) {
+        std::cout << "- " << scenario.name << " capacity ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " capacity fail!\n";
+    return 4;
+}
+
+/* Rewinding across a structural change recreates the objects, the trajectory recording must stop before the recorded
+   bodies are deleted and the scene must keep stepping without it */
+int testRewindWhileRecording(const BenchScenario &scenario) {
+    RollbackBuffer rollbackBuffer(CAPACITY);
+    std::vector<std::uint64_t> hashes;
+    Scene *scene = recordRun(scenario, rollbackBuffer, hashes);
+
+    TrajectoryRecorder recorder;
+    bool started = recorder.start(TRAJECTORY_PATH, *scene);
+    if (started)
+        scene->setTrajectoryRecorder(&recorder);
+    stepAndHash(scene, 1);
+    scene->createGameObject(Mesh::meshNamesList[0]);
+    bool rewound = rollbackBuffer.rewind(*scene, rollbackBuffer.getNewestFrame()) && !recorder.isRecording();
+    stepAndHash(scene, 2);
+    scene->setTrajectoryRecorder(nullptr);
+
+    TrajectoryData data;
+    bool recorded = started && rewound && TrajectoryRecorder::load(TRAJECTORY_PATH, data) &&
+                    data.stepCounts.size() == 1;
+    delete scene;
+    std::remove(TRAJECTORY_PATH);
+
+    if (recorded) {
+        std::cout << "- " << scenario.name << " rewind while recording ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " rewind while recording fail!\n";
+    return 8;
+}
+
+int main() {
+    std::cout << "RollbackBuffer Test\n";
+    loadNullGl();
+    Determinism::setEnabled(true);
+
+    int result = 0;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        result |= testRewind(benchScenarios[i]);
+        result |= testResimulate(benchScenarios[i]);
+        result |= testCapacity(benchScenarios[i]);
+        result |= testRewindWhileRecording(benchScenarios[i]);
+    }
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
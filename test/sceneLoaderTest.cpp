@@ -0,0 +1,111 @@
+#include <cstdio>
+#include <iostream>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/ParticleContact/ParticleConstraint/ParticleConstraintSolver.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Scene/SceneLoader.h"
+
+const unsigned int COUNT = 5000;
+const unsigned int STEPS = 10;
+const char *SCENE_PATH = "sceneLoaderTest.scene";
+
+/* Every object and rod of a generated file must be in the scene, with the time step of the file, and the scene must
+   step */
+int testLoadFile() {
+    unsigned int rods = writeBenchSceneFile(SCENE_PATH, COUNT);
+    auto *scene = new Scene(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    bool loaded = SceneLoader::loadFromFile(SCENE_PATH, *scene) && scene->getGameObjects().size() == COUNT &&
+                  scene->getParticleConstraintSolverPtr()->getConstraintCount() == rods &&
+                  scene->getFixedTimeStep() == BENCH_DELTA_TIME;
+    stepAndHash(scene, STEPS);
+    loaded = loaded && scene->getStepCount() == STEPS;
+    delete scene;
+    std::remove(SCENE_PATH);
+
+    if (loaded) {
+        std::cout << "- Load file ok!\n";
+        return 0;
+    }
+    std::cout << "- Load file fail!\n";
+    return 1;
+}
+
+/* Names can be used before the line of their object */
+int testForwardReference() {
+    auto *scene = new Scene(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    bool loaded = SceneLoader::loadFromString("rod a b 1\nobject a particle\nobject b particle position 1 0 0\n",
+                                              *scene) &&
+                  scene->getGameObjects().size() == 2 &&
+                  scene->getParticleConstraintSolverPtr()->getConstraintCount() == 1;
+    delete scene;
+
+    if (loaded) {
+        std::cout << "- Forward reference ok!\n";
+        return 0;
+    }
+    std::cout << "- Forward reference fail!\n";
+    return 2;
+}
+
+/* An error anywhere in a file leaves the scene untouched */
+int testRejectError() {
+    auto *scene = new Scene(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    bool rejected = SceneLoader::loadFromString("object a particle\nobject b particle\nrod a b 1\n", *scene) &&
+                    !SceneLoader::loadFromString("object c particle\nrod c missing 1\n", *scene) &&
+                    scene->getGameObjects().size() == 2 &&
+                    scene->getParticleConstraintSolverPtr()->getConstraintCount() == 1;
+    delete scene;
+
+    if (rejected) {
+        std::cout << "- Reject error ok!\n";
+        return 0;
+    }
+    std::cout << "- Reject error fail!\n";
+    return 4;
+}
+
+/* A parent chain that loops back to its object is an error, a chain without loop is kept */
+int testRejectParentCycle() {
+    auto *scene = new Scene(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    bool rejected = !SceneLoader::loadFromString("object a static parent b\nobject b static parent a\n", *scene) &&
+                    !SceneLoader::loadFromString("object c static parent c\n", *scene) &&
+                    scene->getGameObjects().empty() &&
+                    SceneLoader::loadFromString("object d static parent e\nobject e static parent f\nobject f static\n",
+                                                *scene) &&
+                    scene->getGameObjects().size() == 3;
+    // The first matrix walks the whole chain, the objects are all at the origin
+    for (std::size_t i = 0; rejected && i < scene->getGameObjects().size(); i++) {
+        rejected = scene->getGameObjects()[i]->transform.getMatrix()(0, 3) == 0;
+    }
+    delete scene;
+
+    if (rejected) {
+        std::cout << "- Reject parent cycle ok!\n";
+        return 0;
+    }
+    std::cout << "- Reject parent cycle fail!\n";
+    return 8;
+}
+
+int main() {
+    std::cout << "SceneLoader Test\n";
+    loadNullGl();
+
+    int result = 0;
+    result += testLoadFile();
+    result += testForwardReference();
+    result += testRejectError();
+    result += testRejectParentCycle();
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
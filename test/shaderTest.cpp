@@ -0,0 +1,45 @@
+#include <iostream>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+
+/* The uniform locations are resolved when the shaders are linked, never while drawing, with or without culling and
+   levels of detail */
+int testNoLookupWhileDrawing(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, scenario.defaultCount);
+    unsigned int drawUniformLookups = getNullGlUniformLookups();
+    for (int options = 0; options < 4; options++) {
+        *scene->getPtrFrustumCulling() = (options & 1) != 0;
+        *scene->getPtrLevelOfDetail() = (options & 2) != 0;
+        scene->draw(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    }
+    unsigned int uniformLookups = getNullGlUniformLookups() - drawUniformLookups;
+    delete scene;
+
+    if (uniformLookups == 0) {
+        std::cout << "- " << scenario.name << " no lookup while drawing ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " no lookup while drawing fail! " << uniformLookups << " lookups\n";
+    return 1;
+}
+
+int main() {
+    std::cout << "Shader Test\n";
+    loadNullGl();
+
+    int result = 0;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        result |= testNoLookupWhileDrawing(benchScenarios[i]);
+    }
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
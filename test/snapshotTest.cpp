@@ -0,0 +1,99 @@
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Scene/SceneSnapshot.h"
+#include "../PhysicalEngine/Utility/Determinism.h"
+
+const unsigned int COUNT = 200;
+const unsigned int HALF_STEPS = 30;
+
+/* Restoring the snapshot in place must continue as the scene did after the capture */
+int testRestoreInPlace(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    stepAndHash(scene, HALF_STEPS);
+    SceneSnapshot snapshot;
+    snapshot.capture(*scene);
+    std::uint64_t continuedHash = stepAndHash(scene, HALF_STEPS);
+    bool restored = snapshot.restore(*scene);
+    std::uint64_t restoredHash = stepAndHash(scene, HALF_STEPS);
+    delete scene;
+
+    if (restored && restoredHash == continuedHash) {
+        std::cout << "- " << scenario.name << " restore in place ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " restore in place fail!\n";
+    return 1;
+}
+
+/* Restoring into an empty scene through a zero-copy view of the blob must continue as the captured scene */
+int testRestoreIntoEmpty(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    stepAndHash(scene, HALF_STEPS);
+    SceneSnapshot snapshot;
+    snapshot.capture(*scene);
+    std::uint64_t continuedHash = stepAndHash(scene, HALF_STEPS);
+    delete scene;
+
+    SceneSnapshot view;
+    auto *forkedScene = new Scene(BENCH_VIEWPORT_SIZE, BENCH_VIEWPORT_SIZE);
+    bool restored = view.setView(snapshot.getData(), snapshot.getSize()) && view.restore(*forkedScene);
+    std::uint64_t forkedHash = stepAndHash(forkedScene, HALF_STEPS);
+    delete forkedScene;
+
+    if (restored && forkedHash == continuedHash) {
+        std::cout << "- " << scenario.name << " restore into empty ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " restore into empty fail!\n";
+    return 2;
+}
+
+/* A blob whose parents loop must be refused, its transforms could not be restored */
+int testRejectParentCycle(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    SceneSnapshot snapshot;
+    snapshot.capture(*scene);
+    delete scene;
+
+    std::vector<unsigned char> blob(snapshot.getData(), snapshot.getData() + snapshot.getSize());
+    auto *header = reinterpret_cast<SnapshotHeader *>(blob.data());
+    auto *objects = reinterpret_cast<SnapshotObject *>(blob.data() + header->objectsOffset);
+    objects[0].parent = 1;
+    objects[1].parent = 0;
+    SceneSnapshot view;
+    bool rejected = header->objectCount >= 2 && !view.setView(blob.data(), blob.size()) && !view.isValid();
+
+    if (rejected) {
+        std::cout << "- " << scenario.name << " reject parent cycle ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " reject parent cycle fail!\n";
+    return 4;
+}
+
+int main() {
+    std::cout << "SceneSnapshot Test\n";
+    loadNullGl();
+    Determinism::setEnabled(true);
+
+    int result = 0;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        result |= testRestoreInPlace(benchScenarios[i]);
+        result |= testRestoreIntoEmpty(benchScenarios[i]);
+        result |= testRejectParentCycle(benchScenarios[i]);
+    }
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
@@ -0,0 +1,79 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/PhysicsThread.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Utility/TraceRecorder.h"
+
+const unsigned int EXPORTS = 20;
+const char *TRACE_PATH = "traceRecorderTest.json";
+
+/* Exports and restarts the trace as the F9 key does while a PhysicsThread and its job workers record into it:
+   every export must be written and every exported event must have been fully written */
+int testExportWhileRecording() {
+    const BenchScenario &scenario = *findBenchScenario("falling_spheres");
+    Scene *scene = createBenchScene(scenario, scenario.defaultCount);
+
+    TraceRecorder::start();
+    PhysicsThread physicsThread;
+    physicsThread.start(scene);
+    unsigned int failedExports = 0;
+    unsigned int events = 0;
+    unsigned int unnamedEvents = 0;
+    for (unsigned int i = 0; i < EXPORTS; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        if (!TraceRecorder::flush(TRACE_PATH)) {
+            failedExports++;
+            continue;
+        }
+        TraceRecorder::start();
+        std::FILE *file = std::fopen(TRACE_PATH, "r");
+        if (file == nullptr) {
+            failedExports++;
+            continue;
+        }
+        char line[512];
+        while (std::fgets(line, sizeof(line), file) != nullptr) {
+            if (std::strstr(line, "\"ph\":\"X\"") == nullptr)
+                continue;
+            events++;
+            if (std::strstr(line, "\"name\":\"(null)\"") != nullptr)
+                unnamedEvents++;
+        }
+        std::fclose(file);
+    }
+    physicsThread.stop();
+    TraceRecorder::stop();
+    std::remove(TRACE_PATH);
+    delete scene;
+
+    if (failedExports == 0 && unnamedEvents == 0 && events > 0) {
+        std::cout << "- Export while recording ok!\n";
+        return 0;
+    }
+    std::cout << "- Export while recording fail! " << failedExports << " failed exports, " << unnamedEvents
+              << " unnamed events out of " << events << "\n";
+    return 1;
+}
+
+int main() {
+    std::cout << "TraceRecorder Test\n";
+    loadNullGl();
+
+    int result = 0;
+    result += testExportWhileRecording();
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
@@ -0,0 +1,93 @@
+#include <cstdio>
+#include <iostream>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Scene/TrajectoryPlayer.h"
+#include "../PhysicalEngine/Scene/TrajectoryRecorder.h"
+
+const unsigned int COUNT = 200;
+const unsigned int STEPS = 120;
+const char *TRAJECTORY_PATH = "trajectoryPlayerTest.petr";
+
+bool record(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    TrajectoryRecorder recorder;
+    // Queue as long as the run, a dropped frame would make the file incomplete
+    bool started = recorder.start(TRAJECTORY_PATH, *scene, {}, TrajectoryRecorder::DEFAULT_FRAMES_PER_CHUNK, STEPS);
+    if (started) {
+        scene->setTrajectoryRecorder(&recorder);
+        stepAndHash(scene, STEPS);
+        recorder.stop();
+        scene->setTrajectoryRecorder(nullptr);
+    }
+    delete scene;
+    return started;
+}
+
+/* Plays a recorded file into a fresh scene: scrubbing back and forth to the last frame must place the bodies as
+   recorded */
+int testScrub(const BenchScenario &scenario) {
+    TrajectoryData data;
+    bool played = record(scenario) && TrajectoryRecorder::load(TRAJECTORY_PATH, data);
+
+    Scene *scene = createBenchScene(scenario, COUNT);
+    TrajectoryPlayer player;
+    played = played && player.open(TRAJECTORY_PATH) && player.getFrameCount() == STEPS &&
+             player.apply(*scene, STEPS / 2) && player.apply(*scene, 0) && player.apply(*scene, STEPS - 1);
+    for (std::size_t body = 0; played && body < data.bodies.size(); body++) {
+        Vector3d position = scene->getGameObjects()[data.bodies[body]]->transform.getPosition();
+        played = static_cast<float>(position.x) == data.getValue(STEPS - 1, TRAJECTORY_COLUMN_POSITION_X, body) &&
+                 static_cast<float>(position.z) == data.getValue(STEPS - 1, TRAJECTORY_COLUMN_POSITION_Z, body);
+    }
+    player.close();
+    delete scene;
+    std::remove(TRAJECTORY_PATH);
+
+    if (played) {
+        std::cout << "- " << scenario.name << " scrub ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " scrub fail!\n";
+    return 1;
+}
+
+/* A frame past the end of the file must be refused */
+int testFrameOutOfRange(const BenchScenario &scenario) {
+    bool refused = record(scenario);
+    Scene *scene = createBenchScene(scenario, COUNT);
+    TrajectoryPlayer player;
+    refused = refused && player.open(TRAJECTORY_PATH) && !player.apply(*scene, STEPS);
+    player.close();
+    delete scene;
+    std::remove(TRAJECTORY_PATH);
+
+    if (refused) {
+        std::cout << "- " << scenario.name << " frame out of range ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " frame out of range fail!\n";
+    return 2;
+}
+
+int main() {
+    std::cout << "TrajectoryPlayer Test\n";
+    loadNullGl();
+
+    int result = 0;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        result |= testScrub(benchScenarios[i]);
+    }
+    result |= testFrameOutOfRange(*findBenchScenario("falling_spheres"));
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
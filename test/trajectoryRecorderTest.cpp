@@ -0,0 +1,103 @@
+#include <cstdio>
+#include <iostream>
+
+#include "../bench/BenchScenarios.h"
+#include "../bench/NullGlLoader.h"
+#include "../PhysicalEngine/Scene/Components/PhysicalComponent/PhysicalComponent.h"
+#include "../PhysicalEngine/Scene/GameObject.h"
+#include "../PhysicalEngine/Scene/Scene.h"
+#include "../PhysicalEngine/Scene/TrajectoryRecorder.h"
+
+const unsigned int COUNT = 200;
+const unsigned int STEPS = 120;
+const char *TRAJECTORY_PATH = "trajectoryRecorderTest.petr";
+
+/* Records every body of the scenario while stepping, then reads the file back: every frame of every body must be
+   there, and the last one must hold the state of the scene */
+int testRecordAndLoad(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    TrajectoryRecorder recorder;
+    // Queue as long as the run, a dropped frame would make the file incomplete
+    bool started = recorder.start(TRAJECTORY_PATH, *scene, {}, TrajectoryRecorder::DEFAULT_FRAMES_PER_CHUNK, STEPS);
+    if (started) {
+        scene->setTrajectoryRecorder(&recorder);
+        stepAndHash(scene, STEPS);
+        recorder.stop();
+        scene->setTrajectoryRecorder(nullptr);
+    }
+
+    TrajectoryData data;
+    bool complete = started && TrajectoryRecorder::load(TRAJECTORY_PATH, data) && recorder.getDroppedFrames() == 0 &&
+                    data.stepCounts.size() == STEPS && data.bodies.size() == recorder.getBodyCount() &&
+                    data.stepCounts.back() == scene->getStepCount();
+    for (std::size_t body = 0; complete && body < data.bodies.size(); body++) {
+        PhysicalComponent *physicalComponent = nullptr;
+        scene->getGameObjects()[data.bodies[body]]->getComponentByClass(physicalComponent);
+        PhysicalState state = physicalComponent->getState();
+        complete = data.getValue(STEPS - 1, TRAJECTORY_COLUMN_POSITION_Y, body) ==
+                   static_cast<float>(state.position.y) &&
+                   data.getValue(STEPS - 1, TRAJECTORY_COLUMN_ORIENTATION_W, body) ==
+                   static_cast<float>(state.orientation[0]) &&
+                   data.getValue(STEPS - 1, TRAJECTORY_COLUMN_LINEAR_SPEED_Y, body) ==
+                   static_cast<float>(state.linearSpeed.y);
+    }
+    delete scene;
+    std::remove(TRAJECTORY_PATH);
+
+    if (complete) {
+        std::cout << "- " << scenario.name << " record and load ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " record and load fail!\n";
+    return 1;
+}
+
+/* Deleting the physical component of a recorded body must stop the recording before the component is freed */
+int testDeleteRecordedComponent(const BenchScenario &scenario) {
+    Scene *scene = createBenchScene(scenario, COUNT);
+    TrajectoryRecorder recorder;
+    bool started = recorder.start(TRAJECTORY_PATH, *scene);
+    if (started)
+        scene->setTrajectoryRecorder(&recorder);
+    stepAndHash(scene, 1);
+    PhysicalComponent *physicalComponent = nullptr;
+    for (GameObject *gameObject: scene->getGameObjects()) {
+        gameObject->getComponentByClass(physicalComponent);
+        if (physicalComponent != nullptr) {
+            scene->deleteComponent(gameObject, physicalComponent->getName());
+            break;
+        }
+    }
+    bool stopped = started && physicalComponent != nullptr && !recorder.isRecording();
+    stepAndHash(scene, 2);
+    scene->setTrajectoryRecorder(nullptr);
+    delete scene;
+    std::remove(TRAJECTORY_PATH);
+
+    if (stopped) {
+        std::cout << "- " << scenario.name << " delete recorded component ok!\n";
+        return 0;
+    }
+    std::cout << "- " << scenario.name << " delete recorded component fail!\n";
+    return 2;
+}
+
+int main() {
+    std::cout << "TrajectoryRecorder Test\n";
+    loadNullGl();
+
+    int result = 0;
+    for (unsigned int i = 0; i < benchScenarioCount; i++) {
+        result |= testRecordAndLoad(benchScenarios[i]);
+        result |= testDeleteRecordedComponent(benchScenarios[i]);
+    }
+
+    if (result == 0)
+        std::cout << "All tests passed!\n";
+    else
+        std::cout << "Some tests failed!\n";
+
+    std::cout << "Error code: " << result << " : " << std::hex << "0x" << result << "\n\n";
+
+    return result;
+}
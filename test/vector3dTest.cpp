@@ -106,7 +106,7 @@ int testScalarDivision() {
 
 int testNorm() {
     Vector3d v1(1.0f, 2.0f, 3.0f);
-    float norm = v1.norm();
+    real norm = v1.norm();
 
     if (floatEqual(norm, 3.74166f))
     {
@@ -134,9 +134,9 @@ int testNormalize() {
 int testDistance() {
     Vector3d v1(1.0f, 2.0f, 3.0f);
     Vector3d v2(4.0f, 5.0f, 6.0f);
-    float distance = v1.distance(v2);
+    real distance = v1.distance(v2);
 
-    if (distance == 5.196152f)
+    if (static_cast<float>(distance) == 5.196152f)
     {
         std::cout << "- Distance ok!\n";
         return 0;
@@ -145,6 +145,22 @@ int testDistance() {
     return 512;
 }
 
+int testPrecisionPolicies() {
+    // Far from the origin a unit step is lost in single precision but kept in double precision
+    Vector3dT<SinglePrecision> f1(1.0e8f, 0.0f, 0.0f);
+    Vector3dT<DoublePrecision> d1(1.0e8, 0.0, 0.0);
+    Vector3dT<SinglePrecision> f2 = f1 + Vector3dT<SinglePrecision>(1.0f, 0.0f, 0.0f);
+    Vector3dT<DoublePrecision> d2 = d1 + Vector3dT<DoublePrecision>(1.0, 0.0, 0.0);
+
+    if (f2.distance(f1) == 0.0f && d2.distance(d1) == 1.0)
+    {
+        std::cout << "- Precision policies ok!\n";
+        return 0;
+    }
+    std::cout << "- Precision policies fail!\n";
+    return 1024;
+}
+
 int main() {
     std::cout << "Vector3d Test\n";
 
@@ -159,6 +175,7 @@ int main() {
     result += testNormalize();
     result += testNorm();
     result += testDistance();
+    result += testPrecisionPolicies();
 
     if (result == 0)
         std::cout << "All tests passed!\n";